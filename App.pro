@@ -0,0 +1,192 @@
+lessThan(QT_MAJOR_VERSION, 5):error("You need at least Qt 5.9 to build PokeFinder")
+equals(QT_MAJOR_VERSION, 5):lessThan(QT_MINOR_VERSION, 9):error("You need at least Qt 5.9 to build PokeFinder")
+
+QT += concurrent network widgets
+CONFIG += c++1z lrelease embed_translations
+
+TARGET = PokeFinder
+TEMPLATE = app
+VERSION = 2.4.1
+QMAKE_TARGET_DESCRIPTION = PokeFinder
+QMAKE_TARGET_COPYRIGHT = Admiral_Fish
+
+RC_ICONS += Images/pokefinder.ico
+ICON += Images/pokefinder.icns
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+include(Core/Core.pri)
+
+TRANSLATIONS += \
+    i18n/PokeFinder_en.ts \
+    i18n/PokeFinder_fr.ts \
+    i18n/PokeFinder_es.ts \
+    i18n/PokeFinder_de.ts \
+    i18n/PokeFinder_it.ts \
+    i18n/PokeFinder_ja.ts \
+    i18n/PokeFinder_ko.ts \
+    i18n/PokeFinder_zh_Hans_CN.ts
+
+RESOURCES += \
+    QDarkStyleSheet/qdarkstyle/style.qrc \
+    resources.qrc
+
+FORMS += \
+    Forms/Controls/EggSettings.ui \
+    Forms/Controls/IVFilter.ui \
+    Forms/Gen3/Eggs3.ui \
+    Forms/Gen3/GameCube.ui \
+    Forms/Gen3/GameCubeRTC.ui \
+    Forms/Gen3/GameCubeSeedFinder.ui \
+    Forms/Gen3/IDs3.ui \
+    Forms/Gen3/JirachiPattern.ui \
+    Forms/Gen3/PIDtoIVs.ui \
+    Forms/Gen3/PokeSpot.ui \
+    Forms/Gen3/ProfileEditor3.ui \
+    Forms/Gen3/ProfileManager3.ui \
+    Forms/Gen3/SeedToTime3.ui \
+    Forms/Gen3/SpindaPainter.ui \
+    Forms/Gen3/Stationary3.ui \
+    Forms/Gen3/Wild3.ui \
+    Forms/Gen4/ChainedSID.ui \
+    Forms/Gen4/Eggs4.ui \
+    Forms/Gen4/IDs4.ui \
+    Forms/Gen4/ProfileEditor4.ui \
+    Forms/Gen4/ProfileManager4.ui \
+    Forms/Gen4/RoamerMap.ui \
+    Forms/Gen4/SearchCalls.ui \
+    Forms/Gen4/SearchCoinFlips.ui \
+    Forms/Gen4/SeedtoTime4.ui \
+    Forms/Gen4/Stationary4.ui \
+    Forms/Gen4/Wild4.ui \
+    Forms/MainWindow.ui \
+    Forms/Util/EncounterLookup.ui \
+    Forms/Util/IVCalculator.ui \
+    Forms/Util/IVtoPID.ui \
+    Forms/Util/Researcher.ui
+
+HEADERS += \
+    Core/Gen3/GameCubeRTCSearcher.hpp \
+    Forms/Controls/CheckList.hpp \
+    Forms/Controls/EggSettings.hpp \
+    Forms/Controls/GraphicsPixmapItem.hpp \
+    Forms/Controls/IVFilter.hpp \
+    Forms/Controls/Label.hpp \
+    Forms/Controls/ProfilePanel.hpp \
+    Forms/Controls/ProgressBar.hpp \
+    Forms/Controls/TableView.hpp \
+    Forms/Controls/TextBox.hpp \
+    Forms/Gen3/Eggs3.hpp \
+    Forms/Gen3/GameCube.hpp \
+    Forms/Gen3/GameCubeRTC.hpp \
+    Forms/Gen3/GameCubeSeedFinder.hpp \
+    Forms/Gen3/IDs3.hpp \
+    Forms/Gen3/JirachiPattern.hpp \
+    Forms/Gen3/PIDtoIVs.hpp \
+    Forms/Gen3/PokeSpot.hpp \
+    Forms/Gen3/ProfileEditor3.hpp \
+    Forms/Gen3/ProfileManager3.hpp \
+    Forms/Gen3/SeedToTime3.hpp \
+    Forms/Gen3/SpindaPainter.hpp \
+    Forms/Gen3/Stationary3.hpp \
+    Forms/Gen3/Wild3.hpp \
+    Forms/Gen4/ChainedSID.hpp \
+    Forms/Gen4/Eggs4.hpp \
+    Forms/Gen4/IDs4.hpp \
+    Forms/Gen4/ProfileEditor4.hpp \
+    Forms/Gen4/ProfileManager4.hpp \
+    Forms/Gen4/RoamerMap.hpp \
+    Forms/Gen4/SearchCalls.hpp \
+    Forms/Gen4/SearchCoinFlips.hpp \
+    Forms/Gen4/SeedtoTime4.hpp \
+    Forms/Gen4/Stationary4.hpp \
+    Forms/Gen4/Wild4.hpp \
+    Forms/MainWindow.hpp \
+    Forms/Util/EncounterLookup.hpp \
+    Forms/Util/IVCalculator.hpp \
+    Forms/Util/IVtoPID.hpp \
+    Forms/Util/Researcher.hpp \
+    Models/Gen3/Egg3Model.hpp \
+    Models/Gen3/IDs3Model.hpp \
+    Models/Gen3/PokeSpotModel.hpp \
+    Models/Gen3/Profile3Model.hpp \
+    Models/Gen3/Searcher3Model.hpp \
+    Models/Gen3/SeedToTime3Model.hpp \
+    Models/Gen3/Stationary3Model.hpp \
+    Models/Gen3/Wild3Model.hpp \
+    Models/Gen4/Egg4Model.hpp \
+    Models/Gen4/IDs4Model.hpp \
+    Models/Gen4/Profile4Model.hpp \
+    Models/Gen4/Searcher4Model.hpp \
+    Models/Gen4/SeedtoTime4Model.hpp \
+    Models/Gen4/Stationary4Model.hpp \
+    Models/Gen4/Wild4Model.hpp \
+    Models/TableExporter.hpp \
+    Models/TableModel.hpp \
+    Models/Util/IVtoPIDModel.hpp \
+    Models/Util/ResearcherModel.hpp \
+    Util/ResearcherFrame.hpp \
+    Util/TableUtility.hpp
+
+SOURCES += \
+    Core/Gen3/GameCubeRTCSearcher.cpp \
+    Forms/Controls/CheckList.cpp \
+    Forms/Controls/EggSettings.cpp \
+    Forms/Controls/GraphicsPixmapItem.cpp \
+    Forms/Controls/IVFilter.cpp \
+    Forms/Controls/Label.cpp \
+    Forms/Controls/ProfilePanel.cpp \
+    Forms/Controls/ProgressBar.cpp \
+    Forms/Controls/TableView.cpp \
+    Forms/Controls/TextBox.cpp \
+    Forms/Gen3/Eggs3.cpp \
+    Forms/Gen3/GameCube.cpp \
+    Forms/Gen3/GameCubeRTC.cpp \
+    Forms/Gen3/GameCubeSeedFinder.cpp \
+    Forms/Gen3/IDs3.cpp \
+    Forms/Gen3/JirachiPattern.cpp \
+    Forms/Gen3/PIDtoIVs.cpp \
+    Forms/Gen3/PokeSpot.cpp \
+    Forms/Gen3/ProfileEditor3.cpp \
+    Forms/Gen3/ProfileManager3.cpp \
+    Forms/Gen3/SeedToTime3.cpp \
+    Forms/Gen3/SpindaPainter.cpp \
+    Forms/Gen3/Stationary3.cpp \
+    Forms/Gen3/Wild3.cpp \
+    Forms/Gen4/ChainedSID.cpp \
+    Forms/Gen4/Eggs4.cpp \
+    Forms/Gen4/IDs4.cpp \
+    Forms/Gen4/ProfileEditor4.cpp \
+    Forms/Gen4/ProfileManager4.cpp \
+    Forms/Gen4/RoamerMap.cpp \
+    Forms/Gen4/SearchCalls.cpp \
+    Forms/Gen4/SearchCoinFlips.cpp \
+    Forms/Gen4/SeedtoTime4.cpp \
+    Forms/Gen4/Stationary4.cpp \
+    Forms/Gen4/Wild4.cpp \
+    Forms/MainWindow.cpp \
+    Forms/Util/EncounterLookup.cpp \
+    Forms/Util/IVCalculator.cpp \
+    Forms/Util/IVtoPID.cpp \
+    Forms/Util/Researcher.cpp \
+    Models/Gen3/Egg3Model.cpp \
+    Models/Gen3/IDs3Model.cpp \
+    Models/Gen3/PokeSpotModel.cpp \
+    Models/Gen3/Profile3Model.cpp \
+    Models/Gen3/Searcher3Model.cpp \
+    Models/Gen3/SeedToTime3Model.cpp \
+    Models/Gen3/Stationary3Model.cpp \
+    Models/Gen3/Wild3Model.cpp \
+    Models/Gen4/Egg4Model.cpp \
+    Models/Gen4/IDs4Model.cpp \
+    Models/Gen4/Profile4Model.cpp \
+    Models/Gen4/Searcher4Model.cpp \
+    Models/Gen4/SeedtoTime4Model.cpp \
+    Models/Gen4/Stationary4Model.cpp \
+    Models/Gen4/Wild4Model.cpp \
+    Models/TableExporter.cpp \
+    Models/Util/IVtoPIDModel.cpp \
+    Models/Util/ResearcherModel.cpp \
+    Util/ResearcherFrame.cpp \
+    Util/TableUtility.cpp \
+    main.cpp
@@ -0,0 +1,24 @@
+lessThan(QT_MAJOR_VERSION, 5):error("You need at least Qt 5.9 to build PokeFinderBatch")
+equals(QT_MAJOR_VERSION, 5):lessThan(QT_MINOR_VERSION, 9):error("You need at least Qt 5.9 to build PokeFinderBatch")
+
+QT = core concurrent
+CONFIG += c++1z console
+CONFIG -= app_bundle
+
+TARGET = PokeFinderBatch
+TEMPLATE = app
+VERSION = 2.4.1
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+include(../Core/Core.pri)
+
+RESOURCES += \
+    ../resources.qrc
+
+HEADERS += \
+    BatchJob.hpp
+
+SOURCES += \
+    BatchJob.cpp \
+    main.cpp
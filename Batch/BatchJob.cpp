@@ -0,0 +1,369 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QElapsedTimer>
+#include "BatchJob.hpp"
+#include <Core/Gen3/Encounters3.hpp>
+#include <Core/Gen3/Frame3Columns.hpp>
+#include <Core/Gen3/Generator3.hpp>
+#include <Core/Gen3/Searcher3.hpp>
+#include <Core/Gen4/Encounters4.hpp>
+#include <Core/Gen4/Frame4Columns.hpp>
+#include <Core/Gen4/Generator4.hpp>
+#include <Core/Gen4/Searcher4.hpp>
+#include <Core/Util/ResultWriter.hpp>
+
+namespace
+{
+    TableWriter::Format getFormat(const QString &format)
+    {
+        if (format == "binary")
+        {
+            return TableWriter::Binary;
+        }
+        if (format == "csv")
+        {
+            return TableWriter::CSV;
+        }
+        return TableWriter::TSV;
+    }
+
+    template <typename T, typename Columns>
+    std::function<QVariant(const T &, int)> getFormatter(const Columns &columns)
+    {
+        return [ = ](const T & item, int column)
+        {
+            return columns.getData(item, column);
+        };
+    }
+
+    template <typename Area>
+    bool findArea(const QVector<Area> &areas, u32 location, Area &area)
+    {
+        for (const auto &entry : areas)
+        {
+            if (entry.getLocation() == location)
+            {
+                area = entry;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Same walk over the filter's IV ranges as IVSearcher3/IVSearcher4
+    template <typename Searcher, typename T>
+    void searchIVs(Searcher &searcher, const QVector<u8> &min, const QVector<u8> &max, ResultWriter<T> &writer)
+    {
+        for (u8 a = min.at(0); a <= max.at(0); a++)
+        {
+            for (u8 b = min.at(1); b <= max.at(1); b++)
+            {
+                for (u8 c = min.at(2); c <= max.at(2); c++)
+                {
+                    for (u8 d = min.at(3); d <= max.at(3); d++)
+                    {
+                        for (u8 e = min.at(4); e <= max.at(4); e++)
+                        {
+                            for (u8 f = min.at(5); f <= max.at(5); f++)
+                            {
+                                writer.append(searcher.search(a, b, c, d, e, f));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+BatchJob::BatchJob(const QJsonObject &data, int index)
+{
+    this->data = data;
+    name = data.contains("name") ? data["name"].toString() : QString("Job %1").arg(index + 1);
+}
+
+void BatchJob::run()
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    int generation = data["generation"].toInt();
+    QString mode = data["mode"].toString();
+
+    if (data["output"].toString().isEmpty())
+    {
+        error = "No output file given";
+    }
+    else if (mode != "search" && mode != "generate")
+    {
+        error = QString("Unknown mode \"%1\"").arg(mode);
+    }
+    else if (generation == 3)
+    {
+        mode == "search" ? search3() : generate3();
+    }
+    else if (generation == 4)
+    {
+        mode == "search" ? search4() : generate4();
+    }
+    else
+    {
+        error = QString("Unsupported generation %1").arg(generation);
+    }
+
+    elapsed = timer.elapsed();
+}
+
+QString BatchJob::getName() const
+{
+    return name;
+}
+
+QString BatchJob::getError() const
+{
+    return error;
+}
+
+u64 BatchJob::getResults() const
+{
+    return results;
+}
+
+qint64 BatchJob::getElapsed() const
+{
+    return elapsed;
+}
+
+bool BatchJob::search3()
+{
+    Profile3 profile(data["profile"].toObject());
+    FrameCompare compare(data["compare"].toObject());
+    auto method = static_cast<Method>(data["method"].toInt());
+
+    Searcher3 searcher(profile.getTID(), profile.getSID(), getNumber("genderRatio"), compare);
+    searcher.setup(method);
+
+    if (isWild())
+    {
+        auto type = static_cast<Encounter>(data["encounter"].toInt());
+        EncounterArea3 area;
+        if (!findArea(Encounters3(type, profile).getEncounters(), getNumber("location"), area))
+        {
+            error = QString("Location %1 has no encounters of this type").arg(getNumber("location"));
+            return false;
+        }
+
+        searcher.setEncounterType(type);
+        searcher.setLeadType(static_cast<Lead>(getNumber("lead", Lead::None)));
+        searcher.setEncounter(area);
+    }
+
+    Searcher3Columns columns(method);
+    ResultWriter<Frame3> writer(data["output"].toString(), getFormat(data["format"].toString()), columns.getHeader(),
+                                getFormatter<Frame3>(columns));
+    if (!writer.open())
+    {
+        error = QString("Unable to open %1").arg(data["output"].toString());
+        return false;
+    }
+
+    searchIVs(searcher, compare.getMin(), compare.getMax(), writer);
+
+    results = writer.getRows();
+    if (!writer.close())
+    {
+        error = QString("Unable to write %1").arg(data["output"].toString());
+        return false;
+    }
+    return true;
+}
+
+bool BatchJob::generate3()
+{
+    Profile3 profile(data["profile"].toObject());
+    FrameCompare compare(data["compare"].toObject());
+
+    Generator3 generator(getNumber("maxResults", 100000), getNumber("initialFrame", 1), getNumber("seed"), profile.getTID(), profile.getSID(),
+                         getNumber("offset"), getNumber("genderRatio"));
+    generator.setup(static_cast<Method>(data["method"].toInt()));
+
+    QStringList header;
+    std::function<QVariant(const Frame3 &, int)> formatter;
+    if (isWild())
+    {
+        auto type = static_cast<Encounter>(data["encounter"].toInt());
+        EncounterArea3 area;
+        if (!findArea(Encounters3(type, profile).getEncounters(), getNumber("location"), area))
+        {
+            error = QString("Location %1 has no encounters of this type").arg(getNumber("location"));
+            return false;
+        }
+
+        generator.setEncounterType(type);
+        generator.setLeadType(static_cast<Lead>(getNumber("lead", Lead::None)));
+        generator.setSynchNature(getNumber("synchNature"));
+        generator.setEncounter(area);
+        Wild3Columns columns;
+        header = columns.getHeader();
+        formatter = getFormatter<Frame3>(columns);
+    }
+    else
+    {
+        Stationary3Columns columns;
+        header = columns.getHeader();
+        formatter = getFormatter<Frame3>(columns);
+    }
+
+    ResultWriter<Frame3> writer(data["output"].toString(), getFormat(data["format"].toString()), header, formatter);
+    if (!writer.open())
+    {
+        error = QString("Unable to open %1").arg(data["output"].toString());
+        return false;
+    }
+
+    writer.append(generator.generate(compare));
+
+    results = writer.getRows();
+    if (!writer.close())
+    {
+        error = QString("Unable to write %1").arg(data["output"].toString());
+        return false;
+    }
+    return true;
+}
+
+bool BatchJob::search4()
+{
+    Profile4 profile(data["profile"].toObject());
+    FrameCompare compare(data["compare"].toObject());
+    auto method = static_cast<Method>(data["method"].toInt());
+
+    Searcher4 searcher(profile.getTID(), profile.getSID(), getNumber("genderRatio"), getNumber("minDelay"), getNumber("maxDelay"),
+                       getNumber("minFrame", 1), getNumber("maxFrame", 1), compare, method);
+
+    if (isWild())
+    {
+        auto type = static_cast<Encounter>(data["encounter"].toInt());
+        EncounterArea4 area;
+        if (!findArea(Encounters4(type, getNumber("time"), profile).getEncounters(), getNumber("location"), area))
+        {
+            error = QString("Location %1 has no encounters of this type").arg(getNumber("location"));
+            return false;
+        }
+
+        searcher.setEncounterType(type);
+        searcher.setLeadType(static_cast<Lead>(getNumber("lead", Lead::None)));
+        searcher.setEncounter(area);
+    }
+
+    Searcher4Columns columns(method, !isWild());
+    ResultWriter<Frame4> writer(data["output"].toString(), getFormat(data["format"].toString()), columns.getHeader(),
+                                getFormatter<Frame4>(columns));
+    if (!writer.open())
+    {
+        error = QString("Unable to open %1").arg(data["output"].toString());
+        return false;
+    }
+
+    searchIVs(searcher, compare.getMin(), compare.getMax(), writer);
+
+    results = writer.getRows();
+    if (!writer.close())
+    {
+        error = QString("Unable to write %1").arg(data["output"].toString());
+        return false;
+    }
+    return true;
+}
+
+bool BatchJob::generate4()
+{
+    Profile4 profile(data["profile"].toObject());
+    FrameCompare compare(data["compare"].toObject());
+    auto method = static_cast<Method>(data["method"].toInt());
+
+    Generator4 generator(getNumber("maxResults", 100000), getNumber("initialFrame", 1), getNumber("seed"), profile.getTID(), profile.getSID(),
+                         getNumber("offset"), method, getNumber("genderRatio"));
+
+    QStringList header;
+    std::function<QVariant(const Frame4 &, int)> formatter;
+    if (isWild())
+    {
+        auto type = static_cast<Encounter>(data["encounter"].toInt());
+        EncounterArea4 area;
+        if (!findArea(Encounters4(type, getNumber("time"), profile).getEncounters(), getNumber("location"), area))
+        {
+            error = QString("Location %1 has no encounters of this type").arg(getNumber("location"));
+            return false;
+        }
+
+        generator.setEncounterType(type);
+        generator.setLeadType(static_cast<Lead>(getNumber("lead", Lead::None)));
+        generator.setSynchNature(getNumber("synchNature"));
+        generator.setEncounter(area);
+        Wild4Columns columns(method);
+        header = columns.getHeader();
+        formatter = getFormatter<Frame4>(columns);
+    }
+    else
+    {
+        Stationary4Columns columns(method);
+        header = columns.getHeader();
+        formatter = getFormatter<Frame4>(columns);
+    }
+
+    ResultWriter<Frame4> writer(data["output"].toString(), getFormat(data["format"].toString()), header, formatter);
+    if (!writer.open())
+    {
+        error = QString("Unable to open %1").arg(data["output"].toString());
+        return false;
+    }
+
+    writer.append(generator.generate(compare));
+
+    results = writer.getRows();
+    if (!writer.close())
+    {
+        error = QString("Unable to write %1").arg(data["output"].toString());
+        return false;
+    }
+    return true;
+}
+
+u32 BatchJob::getNumber(const QString &key, u32 defaultValue) const
+{
+    QJsonValue value = data[key];
+    if (value.isString())
+    {
+        bool ok;
+        u32 number = value.toString().toUInt(&ok, 0);
+        return ok ? number : defaultValue;
+    }
+    if (value.isDouble())
+    {
+        return static_cast<u32>(value.toDouble());
+    }
+    return defaultValue;
+}
+
+bool BatchJob::isWild() const
+{
+    return data.contains("encounter");
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef BATCHJOB_HPP
+#define BATCHJOB_HPP
+
+#include <QJsonObject>
+#include <Core/Util/Global.hpp>
+
+// One search or generator run described by a job file entry:
+// {
+//     "name": "label for the summary",
+//     "generation": 3 or 4,
+//     "mode": "search" or "generate",
+//     "profile": profile object as saved in settings,
+//     "method": Method, "genderRatio": number,
+//     "compare": filter object as stored in session provenance, the IV range is also the search range,
+//     "encounter": Encounter, "location": number, "time": 0-2 (Gen 4), "lead": Lead, "synchNature": number,
+//     "minDelay", "maxDelay", "minFrame", "maxFrame": Gen 4 search ranges,
+//     "seed", "initialFrame", "maxResults", "offset": generator settings,
+//     "output": file name, "format": "tsv", "csv" or "binary"
+// }
+// Jobs without an encounter are stationary. Numbers may be given as strings, "0x" prefixed strings are hexadecimal.
+class BatchJob
+{
+
+public:
+    BatchJob() = default;
+    BatchJob(const QJsonObject &data, int index);
+    void run();
+    QString getName() const;
+    QString getError() const;
+    u64 getResults() const;
+    qint64 getElapsed() const;
+
+private:
+    QJsonObject data;
+    QString name;
+    QString error;
+    u64 results{};
+    qint64 elapsed{};
+
+    bool search3();
+    bool generate3();
+    bool search4();
+    bool generate4();
+    u32 getNumber(const QString &key, u32 defaultValue = 0) const;
+    bool isWild() const;
+
+};
+
+#endif // BATCHJOB_HPP
@@ -0,0 +1,120 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QMutex>
+#include <QTextStream>
+#include <QtConcurrent>
+#include <Batch/BatchJob.hpp>
+#include <Core/Util/SearchScheduler.hpp>
+#include <Core/Util/Translator.hpp>
+
+// Runs every job of a JSON job file on a shared thread pool:
+// { "threads": optional pool size, "jobs": [ job, ... ] }
+// See BatchJob.hpp for the fields of a job.
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    a.setApplicationName("PokeFinder");
+    a.setOrganizationName("PokeFinder Team");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Runs PokeFinder searches and generators from a JSON job file");
+    parser.addHelpOption();
+    parser.addPositionalArgument("jobs", "JSON job file");
+    QCommandLineOption threadsOption({ "t", "threads" }, "Number of jobs to run at once", "count");
+    parser.addOption(threadsOption);
+    parser.process(a);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    if (parser.positionalArguments().size() != 1)
+    {
+        parser.showHelp(1);
+    }
+
+    QFile file(parser.positionalArguments().at(0));
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        err << "Unable to open " << file.fileName() << "\n";
+        return 1;
+    }
+
+    QJsonParseError error;
+    QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &error);
+    file.close();
+    if (!document.isObject())
+    {
+        err << "Invalid job file: " << error.errorString() << "\n";
+        return 1;
+    }
+
+    QJsonObject data = document.object();
+    int threads = parser.isSet(threadsOption) ? parser.value(threadsOption).toInt() : data["threads"].toInt();
+    if (threads > 0)
+    {
+        SearchScheduler::getInstance().setThreadCount(threads);
+    }
+
+    // Species and location names are written in English regardless of the GUI language
+    Translator::setLocale("en");
+
+    QVector<BatchJob> jobs;
+    QJsonArray entries = data["jobs"].toArray();
+    for (int i = 0; i < entries.size(); i++)
+    {
+        jobs.append(BatchJob(entries.at(i).toObject(), i));
+    }
+
+    QMutex mutex;
+    QtConcurrent::blockingMap(jobs, [&](BatchJob &job)
+    {
+        job.run();
+
+        QMutexLocker locker(&mutex);
+        if (job.getError().isEmpty())
+        {
+            out << job.getName() << ": " << job.getResults() << " results in " << job.getElapsed() << " ms" << "\n";
+        }
+        else
+        {
+            err << job.getName() << ": " << job.getError() << "\n";
+        }
+        out.flush();
+        err.flush();
+    });
+
+    int failed = 0;
+    for (const auto &job : jobs)
+    {
+        if (!job.getError().isEmpty())
+        {
+            failed++;
+        }
+    }
+    out << jobs.size() - failed << " of " << jobs.size() << " jobs finished" << "\n";
+    out.flush();
+
+    return failed == 0 ? 0 : 1;
+}
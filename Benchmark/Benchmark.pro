@@ -0,0 +1,57 @@
+lessThan(QT_MAJOR_VERSION, 5):error("You need at least Qt 5.9 to build PokeFinderBenchmark")
+equals(QT_MAJOR_VERSION, 5):lessThan(QT_MINOR_VERSION, 9):error("You need at least Qt 5.9 to build PokeFinderBenchmark")
+
+QT = core concurrent
+CONFIG += c++1z console
+CONFIG -= app_bundle
+
+TARGET = PokeFinderBenchmark
+TEMPLATE = app
+VERSION = 2.4.1
+
+DEFINES += QT_DEPRECATED_WARNINGS APP_VERSION=\\\"$$VERSION\\\"
+
+include(../Core/Core.pri)
+
+RESOURCES += \
+    ../resources.qrc
+
+# Reference holds frozen copies of the engines from before their optimization, kept as the verifier's oracle
+HEADERS += \
+    Reference/Egg.hpp \
+    Reference/Egg3.hpp \
+    Reference/Egg4.hpp \
+    Reference/Frame.hpp \
+    Reference/Frame3.hpp \
+    Reference/Frame4.hpp \
+    Reference/FrameCompare.hpp \
+    Reference/Generator.hpp \
+    Reference/Generator3.hpp \
+    Reference/Generator4.hpp \
+    Reference/LCRNG.hpp \
+    Reference/MTRNG.hpp \
+    Reference/Searcher.hpp \
+    Reference/Searcher3.hpp \
+    Reference/Searcher4.hpp \
+    Verifier.hpp \
+    Workloads.hpp
+
+SOURCES += \
+    Reference/Egg.cpp \
+    Reference/Egg3.cpp \
+    Reference/Egg4.cpp \
+    Reference/Frame.cpp \
+    Reference/Frame3.cpp \
+    Reference/Frame4.cpp \
+    Reference/FrameCompare.cpp \
+    Reference/Generator.cpp \
+    Reference/Generator3.cpp \
+    Reference/Generator4.cpp \
+    Reference/LCRNG.cpp \
+    Reference/MTRNG.cpp \
+    Reference/Searcher.cpp \
+    Reference/Searcher3.cpp \
+    Reference/Searcher4.cpp \
+    Verifier.cpp \
+    Workloads.cpp \
+    main.cpp
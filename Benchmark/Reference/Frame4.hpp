@@ -0,0 +1,59 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef REFERENCE_FRAME4_HPP
+#define REFERENCE_FRAME4_HPP
+
+#include <Benchmark/Reference/Frame.hpp>
+
+namespace Reference
+{
+    class Frame4 : public Frame
+    {
+
+    public:
+        Frame4();
+        Frame4(u16 tid, u16 sid, u16 psv);
+        void setInheritance(u16 iv1, u16 iv2, u16 par1, u16 par2, u16 par3, u16 inh1, u16 inh2,
+                            u16 inh3, const QVector<u8> &parent1, const QVector<u8> &parent2, bool broken = false);
+        void setInheritance(int index, QChar value);
+        void setPID(u32 pid, u16 genderRatio);
+        void setPID(u16 high, u16 low, u16 genderRatio);
+        QString getCall() const;
+        QString chatotPitch() const;
+        u32 getInitialSeed() const;
+        void setInitialSeed(const u32 &value);
+        u32 getSeed() const;
+        void setSeed(const u32 &value);
+        u32 getOccidentary() const;
+        void setOccidentary(const u32 &value);
+        void setEggFrame(const u32 &value);
+        u32 getEggFrame() const;
+        void xorFrame();
+
+    private:
+        u32 occidentary{};
+        u32 eggFrame{};
+        u32 seed{};
+        u32 initialSeed{};
+
+    };
+}
+
+#endif // REFERENCE_FRAME4_HPP
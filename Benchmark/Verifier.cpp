@@ -0,0 +1,687 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QEventLoop>
+#include "Verifier.hpp"
+#include <Benchmark/Reference/Egg3.hpp>
+#include <Benchmark/Reference/Egg4.hpp>
+#include <Benchmark/Reference/Generator3.hpp>
+#include <Benchmark/Reference/Generator4.hpp>
+#include <Benchmark/Reference/MTRNG.hpp>
+#include <Benchmark/Reference/Searcher3.hpp>
+#include <Benchmark/Reference/Searcher4.hpp>
+#include <Core/Gen3/Egg3.hpp>
+#include <Core/Gen3/Encounters3.hpp>
+#include <Core/Gen3/Generator3.hpp>
+#include <Core/Gen3/IVSearcher3.hpp>
+#include <Core/Gen3/LockInfo.hpp>
+#include <Core/Gen3/Profile3.hpp>
+#include <Core/Gen3/Searcher3.hpp>
+#include <Core/Gen4/Egg4.hpp>
+#include <Core/Gen4/Encounters4.hpp>
+#include <Core/Gen4/Generator4.hpp>
+#include <Core/Gen4/IVSearcher4.hpp>
+#include <Core/Gen4/Profile4.hpp>
+#include <Core/Gen4/Searcher4.hpp>
+#include <Core/RNG/MTKernel.hpp>
+#include <Core/RNG/MTRNG.hpp>
+
+namespace
+{
+    const QVector<u8> genderRatios = { 0, 31, 63, 127, 191, 255 };
+    const QVector<Encounter> wildEncounters = { Encounter::Grass, Encounter::Surfing, Encounter::OldRod, Encounter::GoodRod, Encounter::SuperRod };
+    const QVector<Lead> cuteCharmLeads = { Lead::CuteCharmFemale, Lead::CuteCharm25M, Lead::CuteCharm50M, Lead::CuteCharm75M, Lead::CuteCharm875M };
+
+    // Shared by the current and the reference frames, which only differ in how they store the lock reason
+    template <typename Frame>
+    QStringList getFields(const Frame &frame)
+    {
+        QVector<u64> values =
+        {
+            frame.getFrame(), frame.getPID(), frame.getSeed(), frame.getAbility(), frame.getGender(), frame.getNature(),
+            frame.getHidden(), frame.getPower(), frame.getEncounterSlot(), frame.getLevel(), static_cast<u64>(frame.getLeadType()),
+            frame.getEggFrame()
+        };
+
+        QStringList fields;
+        for (u64 value : values)
+        {
+            fields.append(QString::number(value));
+        }
+        for (int i = 0; i < 6; i++)
+        {
+            fields.append(QString::number(frame.getIV(i)));
+            fields.append(frame.getInheritance(i));
+        }
+
+        return fields;
+    }
+
+    QStringList getExtraFields(const Frame3 &frame)
+    {
+        return { frame.getLockReasonString() };
+    }
+
+    QStringList getExtraFields(const Reference::Frame3 &frame)
+    {
+        return { frame.getLockReason() };
+    }
+
+    QStringList getExtraFields(const Frame4 &frame)
+    {
+        return { QString::number(frame.getInitialSeed()), QString::number(frame.getOccidentary()) };
+    }
+
+    QStringList getExtraFields(const Reference::Frame4 &frame)
+    {
+        return { QString::number(frame.getInitialSeed()), QString::number(frame.getOccidentary()) };
+    }
+
+    template <typename Frame>
+    QStringList getAllFields(const Frame &frame)
+    {
+        return getFields(frame) + getExtraFields(frame);
+    }
+
+    // Runs a searcher over every IV combination of a box in the order the chunked searches report them
+    template <typename Frame, typename Searcher>
+    QVector<Frame> searchBox(Searcher searcher, const QVector<u8> &min, const QVector<u8> &max)
+    {
+        QVector<Frame> frames;
+        for (u8 hp = min.at(0); hp <= max.at(0); hp++)
+        {
+            for (u8 atk = min.at(1); atk <= max.at(1); atk++)
+            {
+                for (u8 def = min.at(2); def <= max.at(2); def++)
+                {
+                    for (u8 spa = min.at(3); spa <= max.at(3); spa++)
+                    {
+                        for (u8 spd = min.at(4); spd <= max.at(4); spd++)
+                        {
+                            for (u8 spe = min.at(5); spe <= max.at(5); spe++)
+                            {
+                                frames.append(searcher.search(hp, atk, def, spa, spd, spe));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return frames;
+    }
+
+    // Runs the same box the way the search windows do, as a job on the search scheduler
+    template <typename IVSearcher, typename Frame, typename Searcher>
+    QVector<Frame> searchScheduled(const Searcher &searcher, const QVector<u8> &min, const QVector<u8> &max)
+    {
+        QVector<Frame> frames;
+        QEventLoop loop;
+
+        auto *ivSearcher = new IVSearcher(searcher, min, max);
+        QObject::connect(ivSearcher, &IVSearcher::updateProgress, &loop, [&](const QVector<Frame> &results) { frames.append(results); });
+        QObject::connect(ivSearcher, &IVSearcher::finished, &loop, &QEventLoop::quit);
+
+        ivSearcher->startSearch();
+        loop.exec();
+        return frames;
+    }
+}
+
+Verifier::Verifier(u32 seed, u32 rounds, QTextStream &log) :
+    random(seed), seed(seed), rounds(rounds), log(log)
+{
+}
+
+bool Verifier::run()
+{
+    log << "Verifying with seed " << seed << " over " << rounds << " rounds" << "\n";
+    log.flush();
+
+    verifyKernels();
+    verifyGenerator3();
+    verifyGenerator4();
+    verifyEgg3();
+    verifyEgg4();
+    verifySearcher3();
+    verifySearcher4();
+
+    log << (failures == 0 ? "All checks passed" : QString("%1 checks failed").arg(failures)) << "\n";
+    log.flush();
+    return failures == 0;
+}
+
+// Every available Mersenne Twister kernel against the reference twister, on raw output and through Egg4
+void Verifier::verifyKernels()
+{
+    QString selected = MTKernel::getName();
+    QStringList kernels = MTKernel::getKernels();
+
+    for (u32 round = 0; round < rounds; round++)
+    {
+        u32 mtSeed = random();
+        u32 initialFrame = 1 + next(2000);
+        u32 maxFrame = initialFrame + next(2000);
+        Method method = next(2) == 0 ? Method::Gen4Normal : Method::Gen4Masuada;
+        Compare compare = nextCompare(false);
+        u8 genderRatio = genderRatios.at(next(genderRatios.size()));
+        QString parameters = QString("seed %1, method %2, frames %3-%4").arg(mtSeed, 8, 16, QChar('0')).arg(static_cast<int>(method)).arg(initialFrame).arg(maxFrame);
+
+        QVector<u32> referenceStream;
+        Reference::MersenneTwister referenceMT(mtSeed);
+        for (int i = 0; i < 1500; i++)
+        {
+            referenceStream.append(referenceMT.nextUInt());
+        }
+
+        Reference::Egg4 referenceEgg(maxFrame, initialFrame, 12345, 54321, method, mtSeed, genderRatio);
+        QVector<Reference::Frame4> reference = referenceEgg.generate(compare.reference);
+
+        Egg4 egg(maxFrame, initialFrame, 12345, 54321, method, mtSeed, genderRatio);
+        for (const QString &kernel : kernels)
+        {
+            MTKernel::setKernel(kernel);
+
+            QVector<u32> stream;
+            MersenneTwister mt(mtSeed);
+            for (int i = 0; i < 1500; i++)
+            {
+                stream.append(mt.nextUInt());
+            }
+
+            if (stream != referenceStream)
+            {
+                failures++;
+                log << "FAIL MersenneTwister " << kernel << ": " << parameters << "\n";
+            }
+            check("Egg4 " + kernel, parameters, reference, egg.generate(compare.current));
+        }
+    }
+
+    MTKernel::setKernel(selected);
+}
+
+// Generation started at a later frame jumps the RNG ahead, both it and one whole pass must match the reference
+void Verifier::verifyGenerator3()
+{
+    const QVector<Method> methods = { Method::Method1, Method::Method2, Method::Method4, Method::MethodH1, Method::MethodH2, Method::MethodH4 };
+    const QVector<Game> games = { Game::Ruby, Game::Sapphire, Game::Emerald, Game::FireRed, Game::LeafGreen };
+
+    for (u32 round = 0; round < rounds; round++)
+    {
+        Method method = methods.at(next(methods.size()));
+        u32 initialSeed = random();
+        u32 initialFrame = 1 + next(100000);
+        u32 count = 2 + next(3000);
+        u32 split = 1 + next(count - 1);
+        u32 offset = next(3);
+        u8 genderRatio = genderRatios.at(next(genderRatios.size()));
+        Compare compare = nextCompare(true);
+
+        Encounter encounter = Encounter::Stationary;
+        Lead lead = Lead::None;
+        EncounterArea3 area;
+        if (method == Method::MethodH1 || method == Method::MethodH2 || method == Method::MethodH4)
+        {
+            encounter = wildEncounters.at(next(wildEncounters.size()));
+            QVector<EncounterArea3> areas = Encounters3(encounter, Profile3("Verifier", games.at(next(games.size())), 12345, 54321)).getEncounters();
+            if (!areas.isEmpty())
+            {
+                area = areas.at(next(areas.size()));
+            }
+
+            switch (next(3))
+            {
+                case 0:
+                    lead = Lead::Synchronize;
+                    break;
+                case 1:
+                    lead = cuteCharmLeads.at(next(cuteCharmLeads.size()));
+                    break;
+                default:
+                    break;
+            }
+        }
+        u8 synchNature = next(25);
+
+        auto configure = [&](auto &generator)
+        {
+            generator.setup(method);
+            generator.setEncounterType(encounter);
+            generator.setLeadType(lead);
+            generator.setSynchNature(synchNature);
+            generator.setEncounter(area);
+        };
+
+        auto generate = [&](u32 maxResults, u32 frame)
+        {
+            Generator3 generator(maxResults, frame, initialSeed, 12345, 54321, offset, genderRatio);
+            configure(generator);
+            return generator.generate(compare.current);
+        };
+
+        Reference::Generator3 generator(count, initialFrame, initialSeed, 12345, 54321, offset, genderRatio);
+        configure(generator);
+        QVector<Reference::Frame3> reference = generator.generate(compare.reference);
+
+        QString parameters = QString("seed %1, method %2, frames %3+%4 split at %5, encounter %6, lead %7")
+                             .arg(initialSeed, 8, 16, QChar('0')).arg(static_cast<int>(method)).arg(initialFrame).arg(count).arg(split).arg(static_cast<int>(encounter)).arg(static_cast<int>(lead));
+        check("Generator3", parameters, reference, generate(count, initialFrame));
+        check("Generator3 split", parameters, reference, generate(split, initialFrame) + generate(count - split, initialFrame + split));
+    }
+}
+
+void Verifier::verifyGenerator4()
+{
+    const QVector<Method> methods = { Method::Method1, Method::MethodJ, Method::MethodK, Method::ChainedShiny, Method::WondercardIVs };
+    const QVector<Game> games = { Game::Diamond, Game::Pearl, Game::Platinum, Game::HeartGold, Game::SoulSilver };
+
+    for (u32 round = 0; round < rounds; round++)
+    {
+        Method method = methods.at(next(methods.size()));
+        u32 initialSeed = random();
+        u32 initialFrame = 1 + next(100000);
+        u32 count = 2 + next(3000);
+        u32 split = 1 + next(count - 1);
+        u32 offset = next(3);
+        u8 genderRatio = genderRatios.at(next(genderRatios.size()));
+        Compare compare = nextCompare(true);
+
+        Encounter encounter = Encounter::Stationary;
+        Lead lead = Lead::None;
+        EncounterArea4 area;
+        if ((method == Method::MethodJ || method == Method::MethodK) && next(4) != 0)
+        {
+            encounter = wildEncounters.at(next(wildEncounters.size()));
+            Game game = method == Method::MethodJ ? games.at(next(3)) : games.at(3 + next(2));
+            QVector<EncounterArea4> areas = Encounters4(encounter, static_cast<int>(next(3)), Profile4("Verifier", game, 12345, 54321)).getEncounters();
+            if (!areas.isEmpty())
+            {
+                area = areas.at(next(areas.size()));
+            }
+        }
+        if (method == Method::MethodJ || method == Method::MethodK)
+        {
+            switch (next(4))
+            {
+                case 0:
+                    lead = Lead::Synchronize;
+                    break;
+                case 1:
+                    lead = cuteCharmLeads.at(next(cuteCharmLeads.size()));
+                    break;
+                case 2:
+                    lead = method == Method::MethodK ? Lead::SuctionCups : Lead::None;
+                    break;
+                default:
+                    break;
+            }
+        }
+        u8 synchNature = next(25);
+
+        auto configure = [&](auto &generator)
+        {
+            generator.setEncounterType(encounter);
+            generator.setLeadType(lead);
+            generator.setSynchNature(synchNature);
+            generator.setEncounter(area);
+        };
+
+        auto generate = [&](u32 maxResults, u32 frame)
+        {
+            Generator4 generator(maxResults, frame, initialSeed, 12345, 54321, offset, method, genderRatio);
+            configure(generator);
+            return generator.generate(compare.current);
+        };
+
+        Reference::Generator4 generator(count, initialFrame, initialSeed, 12345, 54321, offset, method, genderRatio);
+        configure(generator);
+        QVector<Reference::Frame4> reference = generator.generate(compare.reference);
+
+        QString parameters = QString("seed %1, method %2, frames %3+%4 split at %5, encounter %6, lead %7")
+                             .arg(initialSeed, 8, 16, QChar('0')).arg(static_cast<int>(method)).arg(initialFrame).arg(count).arg(split).arg(static_cast<int>(encounter)).arg(static_cast<int>(lead));
+        check("Generator4", parameters, reference, generate(count, initialFrame));
+        check("Generator4 split", parameters, reference, generate(split, initialFrame) + generate(count - split, initialFrame + split));
+    }
+}
+
+void Verifier::verifyEgg3()
+{
+    const QVector<Method> methods =
+    {
+        Method::EBredPID, Method::EBred, Method::EBredSplit, Method::EBredAlternate, Method::RSBred, Method::RSBredSplit,
+        Method::RSBredAlternate, Method::FRLGBred, Method::FRLGBredSplit, Method::FRLGBredAlternate
+    };
+
+    for (u32 round = 0; round < rounds; round++)
+    {
+        Method method = methods.at(next(methods.size()));
+        u32 eggSeed = method == Method::EBredPID || method == Method::EBred || method == Method::EBredSplit || method == Method::EBredAlternate ? 0 : next(0x10000);
+        u32 initialFrame = 1 + next(5000);
+        u32 maxFrame = initialFrame + 1 + next(2000);
+        u32 split = initialFrame + next(maxFrame - initialFrame);
+        u8 genderRatio = genderRatios.at(next(genderRatios.size()));
+        Compare compare = nextCompare(true);
+        QVector<u8> parent1 = nextIVs();
+        QVector<u8> parent2 = nextIVs();
+        u8 minRedraw = next(3);
+        u8 maxRedraw = minRedraw + next(3);
+        int compatability = next(2) == 0 ? 20 : 50 + static_cast<int>(next(21));
+        u8 calibration = 18 + next(3);
+        bool everstone = next(2) == 0;
+        u8 everstoneNature = next(25);
+        u16 pickupSeed = next(0x10000);
+        u32 minPickup = 1 + next(100);
+        u32 maxPickup = minPickup + next(100);
+
+        auto configure = [&](auto &egg)
+        {
+            egg.setParents(parent1, parent2);
+            egg.setMinRedraw(minRedraw);
+            egg.setMaxRedraw(maxRedraw);
+            egg.setCompatability(compatability);
+            egg.setCalibration(calibration);
+            egg.setEverstone(everstone);
+            egg.setEverstoneNature(everstoneNature);
+            egg.setPickupSeed(pickupSeed);
+            egg.setMinPickup(minPickup);
+            egg.setMaxPickup(maxPickup);
+        };
+
+        auto generate = [&](u32 frame, u32 last)
+        {
+            Egg3 egg(last, frame, 12345, 54321, method, genderRatio, eggSeed);
+            configure(egg);
+            return egg.generate(compare.current);
+        };
+
+        Reference::Egg3 egg(maxFrame, initialFrame, 12345, 54321, method, genderRatio, eggSeed);
+        configure(egg);
+        QVector<Reference::Frame3> reference = egg.generate(compare.reference);
+        QVector<Frame3> whole = generate(initialFrame, maxFrame);
+        QVector<Frame3> result = generate(initialFrame, split) + generate(split + 1, maxFrame);
+
+        // Emerald PIDs are sorted by the frame they were started on, which ties between redraws
+        if (method == Method::EBredPID)
+        {
+            auto order = [](const auto &frame1, const auto &frame2) { return getAllFields(frame1) < getAllFields(frame2); };
+            std::sort(reference.begin(), reference.end(), order);
+            std::sort(whole.begin(), whole.end(), order);
+            std::sort(result.begin(), result.end(), order);
+        }
+
+        QString parameters = QString("seed %1, method %2, frames %3-%4 split at %5").arg(eggSeed).arg(static_cast<int>(method)).arg(initialFrame).arg(maxFrame).arg(split);
+        check("Egg3", parameters, reference, whole);
+        check("Egg3 split", parameters, reference, result);
+    }
+}
+
+void Verifier::verifyEgg4()
+{
+    const QVector<Method> methods = { Method::Gen4Normal, Method::Gen4Masuada, Method::DPPtIVs, Method::HGSSIVs };
+
+    for (u32 round = 0; round < rounds; round++)
+    {
+        Method method = methods.at(next(methods.size()));
+        u32 eggSeed = random();
+        u32 initialFrame = 1 + next(3000);
+        u32 count = 2 + next(2000);
+        u32 split = 1 + next(count - 1);
+        u8 genderRatio = genderRatios.at(next(genderRatios.size()));
+        Compare compare = nextCompare(method == Method::DPPtIVs || method == Method::HGSSIVs);
+        QVector<u8> parent1 = nextIVs();
+        QVector<u8> parent2 = nextIVs();
+
+        // The PID methods take the last frame while the IV methods take a count
+        bool pid = method == Method::Gen4Normal || method == Method::Gen4Masuada;
+        auto generate = [&](u32 frame, u32 frames)
+        {
+            Egg4 egg(pid ? frame + frames - 1 : frames, frame, 12345, 54321, method, eggSeed, genderRatio);
+            egg.setParents(parent1, parent2);
+            return egg.generate(compare.current);
+        };
+
+        Reference::Egg4 egg(pid ? initialFrame + count - 1 : count, initialFrame, 12345, 54321, method, eggSeed, genderRatio);
+        egg.setParents(parent1, parent2);
+        QVector<Reference::Frame4> reference = egg.generate(compare.reference);
+
+        QString parameters = QString("seed %1, method %2, frames %3+%4 split at %5").arg(eggSeed, 8, 16, QChar('0')).arg(static_cast<int>(method)).arg(initialFrame).arg(count).arg(split);
+        check("Egg4", parameters, reference, generate(initialFrame, count));
+        check("Egg4 split", parameters, reference, generate(initialFrame, split) + generate(initialFrame + split, count - split));
+    }
+}
+
+// Searches must find the same frames in the same order as the reference, both in one loop and as scheduled chunks
+void Verifier::verifySearcher3()
+{
+    const QVector<Method> methods =
+    {
+        Method::Method1, Method::Method2, Method::Method4, Method::MethodH1, Method::MethodH2, Method::MethodH4,
+        Method::XD, Method::Colo, Method::XDColo, Method::Channel
+    };
+    const QVector<Game> games = { Game::Ruby, Game::Sapphire, Game::Emerald, Game::FireRed, Game::LeafGreen };
+    const QVector<Lead> leads = { Lead::None, Lead::Synchronize, Lead::CuteCharm, Lead::Search };
+
+    for (u32 round = 0; round < rounds; round++)
+    {
+        Method method = methods.at(next(methods.size()));
+        Compare compare = nextCompare(false);
+        u8 genderRatio = genderRatios.at(next(genderRatios.size()));
+        QVector<u8> min = nextIVs();
+        QVector<u8> max = min;
+        for (u8 i = 0; i < 3; i++)
+        {
+            u8 stat = next(6);
+            max[stat] = qMin(31, min.at(stat) + 3);
+        }
+
+        int shadow = 0;
+        Encounter encounter = Encounter::Stationary;
+        EncounterArea3 area;
+        Lead lead = Lead::None;
+        if (method == Method::XD || method == Method::Colo)
+        {
+            shadow = static_cast<int>(next(ShadowTeam::loadShadowTeams(method).size()));
+        }
+        else if (method == Method::MethodH1 || method == Method::MethodH2 || method == Method::MethodH4)
+        {
+            encounter = wildEncounters.at(next(wildEncounters.size()));
+            QVector<EncounterArea3> areas = Encounters3(encounter, Profile3("Verifier", games.at(next(games.size())), 12345, 54321)).getEncounters();
+            if (!areas.isEmpty())
+            {
+                area = areas.at(next(areas.size()));
+            }
+            lead = leads.at(next(leads.size()));
+        }
+
+        auto configure = [&](auto &searcher)
+        {
+            searcher.setup(method);
+            if (method == Method::XD || method == Method::Colo)
+            {
+                searcher.setupNatureLock(shadow);
+            }
+            else if (method == Method::MethodH1 || method == Method::MethodH2 || method == Method::MethodH4)
+            {
+                searcher.setEncounter(area);
+                searcher.setEncounterType(encounter);
+                searcher.setLeadType(lead);
+            }
+        };
+
+        Reference::Searcher3 referenceSearcher(12345, 54321, genderRatio, compare.reference);
+        configure(referenceSearcher);
+        Searcher3 searcher(12345, 54321, genderRatio, compare.current);
+        configure(searcher);
+
+        QVector<Reference::Frame3> reference = searchBox<Reference::Frame3>(referenceSearcher, min, max);
+
+        QString parameters = QString("method %1, IVs %2/%3/%4/%5/%6/%7").arg(static_cast<int>(method)).arg(min.at(0)).arg(min.at(1)).arg(min.at(2)).arg(min.at(3)).arg(min.at(4)).arg(min.at(5));
+        check("Searcher3", parameters, reference, searchBox<Frame3>(searcher, min, max));
+        check("IVSearcher3", parameters, reference, searchScheduled<IVSearcher3, Frame3>(searcher, min, max));
+    }
+}
+
+void Verifier::verifySearcher4()
+{
+    const QVector<Method> methods = { Method::Method1, Method::MethodJ, Method::MethodK, Method::ChainedShiny, Method::WondercardIVs };
+    const QVector<Game> games = { Game::Diamond, Game::Pearl, Game::Platinum, Game::HeartGold, Game::SoulSilver };
+
+    for (u32 round = 0; round < rounds; round++)
+    {
+        Method method = methods.at(next(methods.size()));
+        Compare compare = nextCompare(false);
+        QVector<u8> min = nextIVs();
+        QVector<u8> max = min;
+        for (u8 i = 0; i < 2; i++)
+        {
+            u8 stat = next(6);
+            max[stat] = qMin(31, min.at(stat) + 2);
+        }
+        u8 genderRatio = genderRatios.at(next(genderRatios.size()));
+        u32 minDelay = next(1000);
+        u32 maxDelay = minDelay + next(40);
+        u32 minFrame = 1 + next(50);
+        u32 maxFrame = minFrame + next(40);
+
+        Encounter encounter = Encounter::Stationary;
+        EncounterArea4 area;
+        Lead lead = Lead::None;
+        if (method == Method::MethodJ || method == Method::MethodK)
+        {
+            if (next(4) != 0)
+            {
+                encounter = wildEncounters.at(next(wildEncounters.size()));
+                Game game = method == Method::MethodJ ? games.at(next(3)) : games.at(3 + next(2));
+                QVector<EncounterArea4> areas = Encounters4(encounter, static_cast<int>(next(3)), Profile4("Verifier", game, 12345, 54321)).getEncounters();
+                if (!areas.isEmpty())
+                {
+                    area = areas.at(next(areas.size()));
+                }
+            }
+
+            QVector<Lead> leads = { Lead::None, Lead::Synchronize, Lead::CuteCharm, Lead::Search };
+            if (method == Method::MethodK)
+            {
+                leads.append(Lead::SuctionCups);
+            }
+            lead = leads.at(next(leads.size()));
+        }
+
+        auto configure = [&](auto &searcher)
+        {
+            if (method == Method::MethodJ || method == Method::MethodK)
+            {
+                searcher.setEncounter(area);
+                searcher.setEncounterType(encounter);
+                searcher.setLeadType(lead);
+            }
+        };
+
+        Reference::Searcher4 referenceSearcher(12345, 54321, genderRatio, minDelay, maxDelay, minFrame, maxFrame, compare.reference, method);
+        configure(referenceSearcher);
+        Searcher4 searcher(12345, 54321, genderRatio, minDelay, maxDelay, minFrame, maxFrame, compare.current, method);
+        configure(searcher);
+
+        QVector<Reference::Frame4> reference = searchBox<Reference::Frame4>(referenceSearcher, min, max);
+
+        QString parameters = QString("method %1, IVs %2/%3/%4/%5/%6/%7").arg(static_cast<int>(method)).arg(min.at(0)).arg(min.at(1)).arg(min.at(2)).arg(min.at(3)).arg(min.at(4)).arg(min.at(5));
+        check("Searcher4", parameters, reference, searchBox<Frame4>(searcher, min, max));
+        check("IVSearcher4", parameters, reference, searchScheduled<IVSearcher4, Frame4>(searcher, min, max));
+    }
+}
+
+u32 Verifier::next(u32 max)
+{
+    return max == 0 ? 0 : random() % max;
+}
+
+// Either no filter, or a loose one so the frames that pass still cover every branch. The reference
+// filter indexes the nature, power and slot lists directly, so they are always filled like the windows do
+Verifier::Compare Verifier::nextCompare(bool ivs)
+{
+    int gender = 0;
+    int ability = 0;
+    QVector<u8> min(6, 0);
+    QVector<bool> natures(25, true);
+    QVector<bool> powers(16, true);
+    QVector<bool> encounters(12, true);
+
+    if (next(2) != 0)
+    {
+        if (ivs)
+        {
+            for (u8 &iv : min)
+            {
+                iv = next(8);
+            }
+        }
+
+        for (int i = 0; i < natures.size(); i++)
+        {
+            natures[i] = next(2) == 0;
+        }
+
+        gender = static_cast<int>(next(3));
+        ability = static_cast<int>(next(3));
+    }
+
+    return
+    {
+        FrameCompare(gender, ability, false, false, min, QVector<u8>(6, 31), natures, powers, encounters),
+        Reference::FrameCompare(gender, ability, false, false, min, QVector<u8>(6, 31), natures, powers, encounters)
+    };
+}
+
+QVector<u8> Verifier::nextIVs()
+{
+    QVector<u8> ivs(6);
+    for (u8 &iv : ivs)
+    {
+        iv = next(32);
+    }
+    return ivs;
+}
+
+template <typename ReferenceFrame, typename Frame>
+void Verifier::check(const QString &name, const QString &parameters, const QVector<ReferenceFrame> &reference, const QVector<Frame> &result)
+{
+    QString reason;
+    if (reference.size() != result.size())
+    {
+        reason = QString("%1 frames instead of %2").arg(result.size()).arg(reference.size());
+    }
+    else
+    {
+        for (int i = 0; i < reference.size(); i++)
+        {
+            if (getAllFields(reference.at(i)) != getAllFields(result.at(i)))
+            {
+                reason = QString("frame %1 differs").arg(reference.at(i).getFrame());
+                break;
+            }
+        }
+    }
+
+    if (!reason.isEmpty())
+    {
+        failures++;
+        log << "FAIL " << name << ": " << parameters << ": " << reason << "\n";
+        log.flush();
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef VERIFIER_HPP
+#define VERIFIER_HPP
+
+#include <QTextStream>
+#include <Benchmark/Reference/FrameCompare.hpp>
+#include <Core/Parents/FrameCompare.hpp>
+#include <random>
+
+// Randomized differential checks of the optimized engines against the frozen copies in Reference,
+// which keep the generators and searchers as they were before any optimization: every Mersenne
+// Twister kernel, generators run whole and started at a jumped ahead frame, and searches run
+// sequentially and as scheduled chunks. Failing rounds are reported with the seed to replay them.
+class Verifier
+{
+
+public:
+    Verifier(u32 seed, u32 rounds, QTextStream &log);
+    bool run();
+
+private:
+    std::mt19937 random;
+    u32 seed;
+    u32 rounds;
+    QTextStream &log;
+    u32 failures{};
+
+    struct Compare
+    {
+        FrameCompare current;
+        Reference::FrameCompare reference;
+    };
+
+    void verifyKernels();
+    void verifyGenerator3();
+    void verifyGenerator4();
+    void verifyEgg3();
+    void verifyEgg4();
+    void verifySearcher3();
+    void verifySearcher4();
+
+    u32 next(u32 max);
+    Compare nextCompare(bool ivs);
+    QVector<u8> nextIVs();
+    template <typename ReferenceFrame, typename Frame>
+    void check(const QString &name, const QString &parameters, const QVector<ReferenceFrame> &reference, const QVector<Frame> &result);
+
+};
+
+#endif // VERIFIER_HPP
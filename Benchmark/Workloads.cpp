@@ -0,0 +1,217 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QEventLoop>
+#include <QtConcurrent>
+#include "Workloads.hpp"
+#include <Core/Gen3/Searcher3.hpp>
+#include <Core/Gen4/EggSearcher4.hpp>
+#include <Core/Gen4/Encounters4.hpp>
+#include <Core/Gen4/Generator4.hpp>
+#include <Core/Gen4/Profile4.hpp>
+#include <Core/RNG/LCRNG.hpp>
+
+#define CHUNKS 64
+#define SEED 0x5EEDB00F
+#define TID 12345
+#define SID 54321
+
+namespace
+{
+    FrameCompare getCompare(bool shiny)
+    {
+        return FrameCompare(0, 0, shiny, false, QVector<u8>(6, 0), QVector<u8>(6, 31), QVector<bool>(), QVector<bool>(), QVector<bool>());
+    }
+}
+
+Workload::Workload(const QString &name, const QString &unit, int chunks, u32 scale)
+    : chunks(chunks), scale(scale), name(name), unit(unit)
+{
+}
+
+QString Workload::getName() const
+{
+    return name;
+}
+
+QString Workload::getUnit() const
+{
+    return unit;
+}
+
+Sample Workload::run()
+{
+    QVector<Sample> samples(chunks);
+    Sample *first = samples.data();
+    QtConcurrent::blockingMap(samples, [this, first](Sample &sample)
+    {
+        sample = runChunk(static_cast<int>(&sample - first));
+    });
+
+    Sample total{};
+    for (const auto &sample : samples)
+    {
+        total.work += sample.work;
+        total.results += sample.results;
+    }
+    return total;
+}
+
+Sample Workload::runChunk(int /*chunk*/) const
+{
+    return Sample{};
+}
+
+
+RNGCacheWorkload::RNGCacheWorkload(u32 scale)
+    : Workload("RNGCache", "IV pairs", CHUNKS, scale), cache(Method::Method1)
+{
+}
+
+Sample RNGCacheWorkload::runChunk(int chunk) const
+{
+    Sample sample{};
+    PokeRNG rng(SEED + static_cast<u32>(chunk));
+
+    for (u32 i = 0; i < 0x4000 * scale; i++)
+    {
+        PokeRNG spread(rng.nextUInt());
+        u32 first = spread.nextUInt() & 0x7FFF0000;
+        u32 second = spread.nextUInt() & 0x7FFF0000;
+
+        sample.results += static_cast<u64>(cache.recoverLower16BitsIV(first, second).size());
+        sample.work++;
+    }
+
+    return sample;
+}
+
+
+RNGEuclideanWorkload::RNGEuclideanWorkload(u32 scale)
+    : Workload("RNGEuclidean", "IV pairs", CHUNKS, scale), euclidean(Method::XDColo)
+{
+}
+
+Sample RNGEuclideanWorkload::runChunk(int chunk) const
+{
+    Sample sample{};
+    XDRNG rng(SEED + static_cast<u32>(chunk));
+
+    for (u32 i = 0; i < 0x4000 * scale; i++)
+    {
+        XDRNG spread(rng.nextUInt());
+        u32 first = spread.nextUInt() & 0x7FFF0000;
+        u32 second = spread.nextUInt() & 0x7FFF0000;
+
+        sample.results += static_cast<u64>(euclidean.recoverLower16BitsIV(first, second).size());
+        sample.work++;
+    }
+
+    return sample;
+}
+
+
+Generator4Workload::Generator4Workload(u32 scale)
+    : Workload("Generator4 MethodJ Wild", "frames", CHUNKS, scale), compare(getCompare(false))
+{
+    Encounters4 encounters(Encounter::Grass, 0, Profile4("Benchmark", Game::Diamond, TID, SID));
+    area = encounters.getEncounters().first();
+}
+
+Sample Generator4Workload::runChunk(int chunk) const
+{
+    u32 frames = 0x8000 * scale;
+
+    Generator4 generator(frames, 1, SEED + static_cast<u32>(chunk), TID, SID, 0, Method::MethodJ, 0);
+    generator.setEncounterType(Encounter::Grass);
+    generator.setEncounter(area);
+
+    return Sample{ frames, static_cast<u64>(generator.generate(compare).size()) };
+}
+
+
+Searcher3Workload::Searcher3Workload(u32 scale)
+    : Workload("Searcher3 XD", "IV sets", CHUNKS, scale), compare(getCompare(false))
+{
+}
+
+Sample Searcher3Workload::runChunk(int chunk) const
+{
+    Sample sample{};
+
+    Searcher3 searcher(TID, SID, 0, compare);
+    searcher.setup(Method::XD);
+    searcher.setupNatureLock(0);
+
+    // Walk the IV space with an odd stride so every chunk covers a spread of combinations
+    u32 count = 0x800 * scale;
+    for (u32 i = 0; i < count; i++)
+    {
+        u32 ivs = ((static_cast<u32>(chunk) * count + i) * 0x9E3779B1) >> 2;
+        QVector<Frame3> frames = searcher.search(ivs & 31, (ivs >> 5) & 31, (ivs >> 10) & 31,
+                                                 (ivs >> 15) & 31, (ivs >> 20) & 31, (ivs >> 25) & 31);
+
+        sample.results += static_cast<u64>(frames.size());
+        sample.work++;
+    }
+
+    return sample;
+}
+
+
+EggSearcher4Workload::EggSearcher4Workload(u32 scale)
+    : Workload("EggSearcher4", "seeds", 16, scale), compare(getCompare(true))
+{
+}
+
+Sample EggSearcher4Workload::run()
+{
+    Sample sample{};
+    int remaining = chunks;
+    QEventLoop loop;
+
+    // The searchers share the search scheduler, so its thread count decides how many chunks run at once
+    for (int chunk = 0; chunk < chunks; chunk++)
+    {
+        Egg4 generatorIV(10, 1, TID, SID, Method::DPPtIVs, 0, 0);
+        generatorIV.setParents({ 31, 31, 31, 31, 31, 31 }, { 0, 0, 0, 0, 0, 0 });
+        Egg4 generatorPID(10, 1, TID, SID, Method::Gen4Normal, 0, 0);
+
+        u32 minDelay = 600 + static_cast<u32>(chunk) * scale;
+        auto *search = new EggSearcher4(generatorIV, generatorPID, compare, minDelay, minDelay + scale - 1, 2);
+
+        QObject::connect(search, &EggSearcher4::updateProgress, &loop, [&sample](const QVector<Frame4> &frames, const ProgressReport &)
+        {
+            sample.results += static_cast<u64>(frames.size());
+        });
+        QObject::connect(search, &EggSearcher4::finished, &loop, [&]
+        {
+            if (--remaining == 0)
+            {
+                loop.quit();
+            }
+        });
+
+        sample.work += 256 * 24 * scale;
+        search->startSearch();
+    }
+
+    loop.exec();
+    return sample;
+}
@@ -0,0 +1,134 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef WORKLOADS_HPP
+#define WORKLOADS_HPP
+
+#include <QString>
+#include <Core/Gen4/EncounterArea4.hpp>
+#include <Core/Parents/FrameCompare.hpp>
+#include <Core/RNG/RNGCache.hpp>
+#include <Core/RNG/RNGEuclidean.hpp>
+
+struct Sample
+{
+    u64 work;
+    u64 results;
+};
+
+// A fixed-seed workload split into a fixed number of chunks so the amount of work
+// and the results found do not depend on how many threads run it. Workloads that
+// drive their own searchers override run() instead of runChunk().
+class Workload
+{
+
+public:
+    Workload(const QString &name, const QString &unit, int chunks, u32 scale);
+    virtual ~Workload() = default;
+    QString getName() const;
+    QString getUnit() const;
+    virtual Sample run();
+
+protected:
+    int chunks;
+    u32 scale;
+
+    virtual Sample runChunk(int chunk) const;
+
+private:
+    QString name;
+    QString unit;
+
+};
+
+// IV pairs of real Method 1 spreads handed to RNGCache
+class RNGCacheWorkload : public Workload
+{
+
+public:
+    RNGCacheWorkload(u32 scale);
+
+protected:
+    Sample runChunk(int chunk) const override;
+
+private:
+    RNGCache cache;
+
+};
+
+// IV pairs of real XD spreads handed to RNGEuclidean
+class RNGEuclideanWorkload : public Workload
+{
+
+public:
+    RNGEuclideanWorkload(u32 scale);
+
+protected:
+    Sample runChunk(int chunk) const override;
+
+private:
+    RNGEuclidean euclidean;
+
+};
+
+// Method J grass encounters in Diamond
+class Generator4Workload : public Workload
+{
+
+public:
+    Generator4Workload(u32 scale);
+
+protected:
+    Sample runChunk(int chunk) const override;
+
+private:
+    EncounterArea4 area;
+    FrameCompare compare;
+
+};
+
+// A spread of IV combinations searched with the XD method
+class Searcher3Workload : public Workload
+{
+
+public:
+    Searcher3Workload(u32 scale);
+
+protected:
+    Sample runChunk(int chunk) const override;
+
+private:
+    FrameCompare compare;
+
+};
+
+// Combined IV and PID egg searches, each chunk is its own searcher over part of the delay range
+class EggSearcher4Workload : public Workload
+{
+
+public:
+    EggSearcher4Workload(u32 scale);
+    Sample run() override;
+
+private:
+    FrameCompare compare;
+
+};
+
+#endif // WORKLOADS_HPP
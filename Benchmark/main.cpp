@@ -0,0 +1,265 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QProcess>
+#include <QSysInfo>
+#include <QTextStream>
+#include <QThread>
+#include <Benchmark/Verifier.hpp>
+#include <Benchmark/Workloads.hpp>
+#include <Core/RNG/MTKernel.hpp>
+#include <Core/Util/SearchScheduler.hpp>
+#include <memory>
+#include <random>
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+    // Peak resident memory of the process so far in KiB, every sample runs in its own process so this is per sample
+    qint64 getPeakMemory()
+    {
+#ifdef Q_OS_WIN
+        PROCESS_MEMORY_COUNTERS counters;
+        if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return static_cast<qint64>(counters.PeakWorkingSetSize / 1024);
+        }
+        return 0;
+#else
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+#ifdef Q_OS_MACOS
+        return usage.ru_maxrss / 1024;
+#else
+        return usage.ru_maxrss;
+#endif
+#endif
+    }
+
+    QVector<int> getThreadCounts(const QString &text)
+    {
+        QVector<int> threads;
+
+        if (text.isEmpty())
+        {
+            int ideal = QThread::idealThreadCount();
+            for (int count = 1; count < ideal; count *= 2)
+            {
+                threads.append(count);
+            }
+            threads.append(ideal);
+        }
+        else
+        {
+            for (const QString &count : text.split(','))
+            {
+                if (count.toInt() > 0)
+                {
+                    threads.append(count.toInt());
+                }
+            }
+        }
+
+        return threads;
+    }
+
+    QJsonObject runSample(Workload &workload, int threads)
+    {
+        // The scheduler sizes the global pool, which the QtConcurrent workloads run on too
+        SearchScheduler::getInstance().setThreadCount(threads);
+
+        QElapsedTimer timer;
+        timer.start();
+        Sample sample = workload.run();
+        double seconds = timer.nsecsElapsed() / 1e9;
+
+        QJsonObject result;
+        result["name"] = workload.getName();
+        result["unit"] = workload.getUnit();
+        result["threads"] = threads;
+        result["work"] = static_cast<double>(sample.work);
+        result["results"] = static_cast<double>(sample.results);
+        result["seconds"] = seconds;
+        result["rate"] = sample.work / seconds;
+        result["resultRate"] = sample.results / seconds;
+        result["peakMemory"] = getPeakMemory();
+        return result;
+    }
+}
+
+// Runs every workload once per thread count and writes the measurements as JSON,
+// or runs the differential checks of the optimized paths with --verify
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    a.setApplicationName("PokeFinder");
+    a.setOrganizationName("PokeFinder Team");
+    a.setApplicationVersion(APP_VERSION);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Measures the throughput of the PokeFinder engines on fixed-seed workloads");
+    parser.addHelpOption();
+    QCommandLineOption threadsOption({ "t", "threads" }, "Comma separated thread counts, powers of two up to the core count by default", "counts");
+    QCommandLineOption scaleOption({ "s", "scale" }, "Multiplier for the size of every workload", "scale", "1");
+    QCommandLineOption filterOption({ "w", "workload" }, "Only run workloads whose name contains this text", "name");
+    QCommandLineOption outputOption({ "o", "output" }, "Write the results to a file instead of stdout", "file");
+    QCommandLineOption kernelOption({ "k", "kernel" }, "Mersenne Twister kernel to use instead of the fastest one", "name");
+    QCommandLineOption verifyOption("verify", "Check the optimized engines against the frozen reference engines instead of measuring");
+    QCommandLineOption roundsOption("rounds", "Random cases per engine when verifying", "rounds", "25");
+    QCommandLineOption seedOption("seed", "Seed of the random cases when verifying, random by default", "seed");
+    QCommandLineOption sampleOption("sample", "Run one workload at the first thread count and print its measurement, used for the child processes", "name");
+    parser.addOption(threadsOption);
+    parser.addOption(scaleOption);
+    parser.addOption(filterOption);
+    parser.addOption(outputOption);
+    parser.addOption(kernelOption);
+    parser.addOption(verifyOption);
+    parser.addOption(roundsOption);
+    parser.addOption(seedOption);
+    parser.addOption(sampleOption);
+    parser.process(a);
+
+    QTextStream err(stderr);
+
+    if (parser.isSet(kernelOption) && !MTKernel::setKernel(parser.value(kernelOption)))
+    {
+        err << "Unknown kernel, available: " << MTKernel::getKernels().join(", ") << "\n";
+        return 1;
+    }
+
+    if (parser.isSet(verifyOption))
+    {
+        u32 seed = parser.isSet(seedOption) ? parser.value(seedOption).toUInt() : std::random_device()();
+        Verifier verifier(seed, parser.value(roundsOption).toUInt(), err);
+        return verifier.run() ? 0 : 1;
+    }
+
+    u32 scale = qMax(1u, parser.value(scaleOption).toUInt());
+    QVector<int> threadCounts = getThreadCounts(parser.value(threadsOption));
+    QString filter = parser.value(filterOption);
+
+    std::vector<std::unique_ptr<Workload>> workloads;
+    workloads.emplace_back(new RNGCacheWorkload(scale));
+    workloads.emplace_back(new RNGEuclideanWorkload(scale));
+    workloads.emplace_back(new Generator4Workload(scale));
+    workloads.emplace_back(new Searcher3Workload(scale));
+    workloads.emplace_back(new EggSearcher4Workload(scale));
+
+    if (parser.isSet(sampleOption))
+    {
+        for (const auto &workload : workloads)
+        {
+            if (workload->getName() == parser.value(sampleOption) && !threadCounts.isEmpty())
+            {
+                QTextStream(stdout) << QJsonDocument(runSample(*workload, threadCounts.first())).toJson(QJsonDocument::Compact);
+                return 0;
+            }
+        }
+        return 1;
+    }
+
+    // Each sample runs in a fresh process so the peak memory of one workload does not carry over to the next
+    QJsonArray results;
+    for (const auto &workload : workloads)
+    {
+        if (!workload->getName().contains(filter, Qt::CaseInsensitive))
+        {
+            continue;
+        }
+
+        double baseRate = 0;
+        double baseResults = 0;
+        for (int threads : threadCounts)
+        {
+            QStringList arguments = { "--sample", workload->getName(), "--threads", QString::number(threads), "--scale", QString::number(scale) };
+            if (parser.isSet(kernelOption))
+            {
+                arguments << "--kernel" << parser.value(kernelOption);
+            }
+
+            QProcess process;
+            process.setProcessChannelMode(QProcess::ForwardedErrorChannel);
+            process.start(QCoreApplication::applicationFilePath(), arguments);
+            process.waitForFinished(-1);
+
+            QJsonObject result = QJsonDocument::fromJson(process.readAllStandardOutput()).object();
+            if (process.exitStatus() != QProcess::NormalExit || process.exitCode() != 0 || result.isEmpty())
+            {
+                err << "Unable to run " << workload->getName() << " [" << threads << " threads]" << "\n";
+                return 1;
+            }
+
+            double rate = result["rate"].toDouble();
+            if (baseRate == 0)
+            {
+                baseRate = rate;
+                baseResults = result["results"].toDouble();
+            }
+            result["speedup"] = rate / baseRate;
+            results.append(result);
+
+            err << workload->getName() << " [" << threads << " threads]: " << QString::number(rate, 'f', 0) << " " << workload->getUnit()
+                << "/s, " << static_cast<u64>(result["results"].toDouble()) << " results" << "\n";
+            if (result["results"].toDouble() != baseResults)
+            {
+                err << "Warning: results differ from the first run (" << static_cast<u64>(baseResults) << ")" << "\n";
+            }
+            err.flush();
+        }
+    }
+
+    QJsonObject report;
+    report["version"] = a.applicationVersion();
+    report["cpu"] = QSysInfo::currentCpuArchitecture();
+    report["kernel"] = QString(MTKernel::getName());
+    report["idealThreads"] = QThread::idealThreadCount();
+    report["scale"] = static_cast<int>(scale);
+    report["results"] = results;
+
+    QByteArray json = QJsonDocument(report).toJson();
+    if (parser.isSet(outputOption))
+    {
+        QFile file(parser.value(outputOption));
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            err << "Unable to open " << file.fileName() << "\n";
+            return 1;
+        }
+        file.write(json);
+    }
+    else
+    {
+        QTextStream(stdout) << json;
+    }
+
+    return 0;
+}
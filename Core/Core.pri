@@ -0,0 +1,17 @@
+# Links a target against the static Core library built by Core/Core.pro
+
+QT *= concurrent
+INCLUDEPATH += $$PWD/..
+DEPENDPATH += $$PWD
+
+CORE_DIR = $$shadowed($$PWD)
+win32:CONFIG(release, debug|release):CORE_DIR = $$CORE_DIR/release
+else:win32:CONFIG(debug, debug|release):CORE_DIR = $$CORE_DIR/debug
+
+LIBS += -L$$CORE_DIR -lPokeFinderCore
+
+win32:!win32-g++:PRE_TARGETDEPS += $$CORE_DIR/PokeFinderCore.lib
+else:PRE_TARGETDEPS += $$CORE_DIR/libPokeFinderCore.a
+
+# Core is built with link time optimization in release, so its users have to link with it too
+CONFIG(release, debug|release):!no_ltcg:CONFIG += ltcg
@@ -0,0 +1,188 @@
+lessThan(QT_MAJOR_VERSION, 5):error("You need at least Qt 5.9 to build PokeFinder")
+equals(QT_MAJOR_VERSION, 5):lessThan(QT_MINOR_VERSION, 9):error("You need at least Qt 5.9 to build PokeFinder")
+
+QT = core concurrent
+CONFIG += c++1z staticlib
+
+TARGET = PokeFinderCore
+TEMPLATE = lib
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ..
+
+# The engines are built with heavier optimization than the UI, and with link time
+# optimization in release so the targets that link Core can inline across it
+!msvc {
+    QMAKE_CXXFLAGS_RELEASE -= -O2
+    QMAKE_CXXFLAGS_RELEASE += -O3
+}
+CONFIG(release, debug|release):!no_ltcg:CONFIG += ltcg
+
+# Per-ISA kernels are selected at runtime from the CPU features, build with
+# CONFIG+=no_simd_kernels to only use the portable versions
+!no_simd_kernels:!msvc:contains(QT_ARCH, "(i386|x86_64)") {
+    CONFIG += simd
+    DEFINES += SIMD_KERNELS
+
+    SSE2_SOURCES += RNG/MTKernelSSE2.cpp
+    AVX2_SOURCES += RNG/MTKernelAVX2.cpp
+    AVX512F_SOURCES += RNG/MTKernelAVX512.cpp
+}
+
+# Per-stage search counters, build with CONFIG+=profile_stages to fill the profiling panel
+profile_stages:DEFINES += PROFILE_STAGES
+
+HEADERS += \
+    Gen3/DateTime3.hpp \
+    Gen3/Egg3.hpp \
+    Gen3/EncounterArea3.hpp \
+    Gen3/Encounters3.hpp \
+    Gen3/Frame3.hpp \
+    Gen3/Frame3Columns.hpp \
+    Gen3/GameCubeSeedSearcher.hpp \
+    Gen3/Generator3.hpp \
+    Gen3/IDFrame3.hpp \
+    Gen3/IDSearcher3.hpp \
+    Gen3/IVSearcher3.hpp \
+    Gen3/LockInfo.hpp \
+    Gen3/Profile3.hpp \
+    Gen3/Searcher3.hpp \
+    Gen3/SeedToTimeCalc3.hpp \
+    Gen3/SeedToTimeSearcher3.hpp \
+    Gen3/ShadowLock.hpp \
+    Gen4/ChainedSIDCalc.hpp \
+    Gen4/DateTime.hpp \
+    Gen4/Egg4.hpp \
+    Gen4/EggSearcher4.hpp \
+    Gen4/EncounterArea4.hpp \
+    Gen4/Encounters4.hpp \
+    Gen4/Frame4.hpp \
+    Gen4/Frame4Columns.hpp \
+    Gen4/Generator4.hpp \
+    Gen4/HGSSRoamer.hpp \
+    Gen4/IDFrame4.hpp \
+    Gen4/IDSearcher4.hpp \
+    Gen4/IVSearcher4.hpp \
+    Gen4/Profile4.hpp \
+    Gen4/Searcher4.hpp \
+    Gen4/SeedtoTimeCalc4.hpp \
+    Gen4/SeedtoTimeSearcher4.hpp \
+    Parents/Egg.hpp \
+    Parents/EncounterArea.hpp \
+    Parents/Frame.hpp \
+    Parents/FrameCompare.hpp \
+    Parents/Generator.hpp \
+    Parents/IDFilter.hpp \
+    Parents/Pokemon.hpp \
+    Parents/Profile.hpp \
+    Parents/Searcher.hpp \
+    Parents/Slot.hpp \
+    RNG/IRNG.hpp \
+    RNG/IRNG64.hpp \
+    RNG/LCRNG.hpp \
+    RNG/LCRNG64.hpp \
+    RNG/MTKernel.hpp \
+    RNG/MTRNG.hpp \
+    RNG/RNGCache.hpp \
+    RNG/RNGEuclidean.hpp \
+    RNG/RNGList.hpp \
+    RNG/RNGWindow.hpp \
+    RNG/SFMT.hpp \
+    RNG/TinyMT.hpp \
+    Util/Characteristic.hpp \
+    Util/ChunkResults.hpp \
+    Util/Encounter.hpp \
+    Util/EncounterSlot.hpp \
+    Util/Game.hpp \
+    Util/Global.hpp \
+    Util/IVChecker.hpp \
+    Util/IVtoPIDCalc.hpp \
+    Util/IVtoPIDFrame.hpp \
+    Util/IVtoPIDSearcher.hpp \
+    Util/Language.hpp \
+    Util/Lead.hpp \
+    Util/LockReason.hpp \
+    Util/Method.hpp \
+    Util/Nature.hpp \
+    Util/Power.hpp \
+    Util/ProfileStore.hpp \
+    Util/ResultWriter.hpp \
+    Util/SearchProgress.hpp \
+    Util/SearchScheduler.hpp \
+    Util/SessionFile.hpp \
+    Util/ShadowType.hpp \
+    Util/StageProfile.hpp \
+    Util/TableWriter.hpp \
+    Util/Translator.hpp \
+    Util/Utilities.hpp
+
+SOURCES += \
+    Gen3/DateTime3.cpp \
+    Gen3/Egg3.cpp \
+    Gen3/EncounterArea3.cpp \
+    Gen3/Encounters3.cpp \
+    Gen3/Frame3.cpp \
+    Gen3/Frame3Columns.cpp \
+    Gen3/GameCubeSeedSearcher.cpp \
+    Gen3/Generator3.cpp \
+    Gen3/IDFrame3.cpp \
+    Gen3/IDSearcher3.cpp \
+    Gen3/IVSearcher3.cpp \
+    Gen3/LockInfo.cpp \
+    Gen3/Profile3.cpp \
+    Gen3/Searcher3.cpp \
+    Gen3/SeedToTimeCalc3.cpp \
+    Gen3/SeedToTimeSearcher3.cpp \
+    Gen3/ShadowLock.cpp \
+    Gen4/ChainedSIDCalc.cpp \
+    Gen4/DateTime.cpp \
+    Gen4/Egg4.cpp \
+    Gen4/EggSearcher4.cpp \
+    Gen4/EncounterArea4.cpp \
+    Gen4/Encounters4.cpp \
+    Gen4/Frame4.cpp \
+    Gen4/Frame4Columns.cpp \
+    Gen4/Generator4.cpp \
+    Gen4/HGSSRoamer.cpp \
+    Gen4/IDFrame4.cpp \
+    Gen4/IDSearcher4.cpp \
+    Gen4/IVSearcher4.cpp \
+    Gen4/Profile4.cpp \
+    Gen4/Searcher4.cpp \
+    Gen4/SeedtoTimeCalc4.cpp \
+    Gen4/SeedtoTimeSearcher4.cpp \
+    Parents/Egg.cpp \
+    Parents/EncounterArea.cpp \
+    Parents/Frame.cpp \
+    Parents/FrameCompare.cpp \
+    Parents/Generator.cpp \
+    Parents/IDFilter.cpp \
+    Parents/Pokemon.cpp \
+    Parents/Profile.cpp \
+    Parents/Searcher.cpp \
+    Parents/Slot.cpp \
+    RNG/LCRNG.cpp \
+    RNG/LCRNG64.cpp \
+    RNG/MTKernel.cpp \
+    RNG/MTRNG.cpp \
+    RNG/RNGCache.cpp \
+    RNG/RNGEuclidean.cpp \
+    RNG/SFMT.cpp \
+    RNG/TinyMT.cpp \
+    Util/Characteristic.cpp \
+    Util/EncounterSlot.cpp \
+    Util/IVChecker.cpp \
+    Util/IVtoPIDCalc.cpp \
+    Util/IVtoPIDFrame.cpp \
+    Util/IVtoPIDSearcher.cpp \
+    Util/Nature.cpp \
+    Util/Power.cpp \
+    Util/ProfileStore.cpp \
+    Util/SearchProgress.cpp \
+    Util/SearchScheduler.cpp \
+    Util/SessionFile.cpp \
+    Util/StageProfile.cpp \
+    Util/TableWriter.cpp \
+    Util/Translator.cpp \
+    Util/Utilities.cpp
@@ -0,0 +1,44 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef DATETIME3_HPP
+#define DATETIME3_HPP
+
+#include <QDateTime>
+#include <Core/Util/Global.hpp>
+
+class DateTime3
+{
+
+public:
+    DateTime3() = default;
+    DateTime3(const QDateTime &dateTime, u16 seed, u32 frame);
+    QString getDateTime() const;
+    QDateTime getQDateTime() const;
+    u16 getSeed() const;
+    u32 getFrame() const;
+
+private:
+    QDateTime dateTime;
+    u16 seed{};
+    u32 frame{};
+
+};
+
+#endif // DATETIME3_HPP
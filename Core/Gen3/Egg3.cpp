@@ -19,6 +19,7 @@
 
 #include "Egg3.hpp"
 #include <Core/RNG/LCRNG.hpp>
+#include <Core/RNG/RNGList.hpp>
 
 Egg3::Egg3()
 {
@@ -116,11 +117,11 @@ QVector<Frame3> Egg3::generate(const FrameCompare &compare) const
     switch (frameType)
     {
         case Method::EBredPID:
-            return generateEmeraldPID(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateEmeraldPID(compare));
         case Method::EBred:
         case Method::EBredSplit:
         case Method::EBredAlternate:
-            return generateEmeraldIVs(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateEmeraldIVs(compare));
         case Method::RSBred:
         case Method::RSBredAlternate:
         case Method::RSBredSplit:
@@ -128,8 +129,8 @@ QVector<Frame3> Egg3::generate(const FrameCompare &compare) const
         case Method::FRLGBred:
         case Method::FRLGBredAlternate:
             {
-                auto lower = generateLower(compare);
-                return lower.isEmpty() ? QVector<Frame3>() : generateUpper(lower, compare);
+                auto lower = PROFILE_CALL(profile, Stage::Generation, maxResults, generateLower(compare));
+                return lower.isEmpty() ? QVector<Frame3>() : PROFILE_CALL(profile, Stage::Generation, static_cast<u64>(lower.size()), generateUpper(lower, compare));
             }
         default:
             return QVector<Frame3>();
@@ -199,34 +200,29 @@ QVector<Frame3> Egg3::generateEmeraldPID(const FrameCompare &compare) const
     u32 i;
     u32 pid = 0;
 
-    PokeRNG rng(seed, initialFrame - 1);
-    QVector<u16> rngList(maxResults + 19);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<PokeRNG, 32> rngList(PokeRNG(seed, initialFrame - 1));
 
     u32 val = initialFrame;
 
     u32 max = maxResults - initialFrame + 1;
-    for (u32 cnt = 0; cnt < max; cnt++, val++)
+    for (u32 cnt = 0; cnt < max; cnt++, val++, rngList.advanceFrame())
     {
         for (u8 redraw = minRedraw; redraw <= maxRedraw; redraw++)
         {
             Frame3 frame(tid, sid, psv);
-            if (((rngList.at(cnt) * 100) / 0xFFFF) < compatability)
+            if (((rngList.at(0) * 100) / 0xFFFF) < compatability)
             {
                 u16 offset = calibration + 3 * redraw;
 
                 i = 1;
 
-                bool flag = everstone ? (rngList.at(cnt + i++) >> 15) == 0 : false;
+                bool flag = everstone ? (rngList.at(i++) >> 15) == 0 : false;
 
                 PokeRNG trng((val - offset) & 0xFFFF);
 
                 if (!flag)
                 {
-                    pid = ((rngList.at(cnt + i) % 0xFFFE) + 1) | (trng.nextUInt() & 0xFFFF0000);
+                    pid = ((rngList.at(i) % 0xFFFE) + 1) | (trng.nextUInt() & 0xFFFF0000);
 
                     frame.setPID(pid, genderRatio);
                 }
@@ -242,7 +238,7 @@ QVector<Frame3> Egg3::generateEmeraldPID(const FrameCompare &compare) const
                             break;
                         }
 
-                        pid = rngList.at(cnt + i++) | (trng.nextUInt() & 0xFFFF0000);
+                        pid = rngList.at(i++) | (trng.nextUInt() & 0xFFFF0000);
                     }
                     while (pid % 25 != everstoneNature);
 
@@ -275,19 +271,14 @@ QVector<Frame3> Egg3::generateEmeraldIVs(const FrameCompare &compare) const
 {
     QVector<Frame3> frames;
 
-    PokeRNG rng(seed, initialFrame - 1);
-    QVector<u16> rngList(maxResults + 10);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<PokeRNG, 16> rngList(PokeRNG(seed, initialFrame - 1));
 
     u32 max = maxResults - initialFrame + 1;
-    for (u32 cnt = 0; cnt < max; cnt++)
+    for (u32 cnt = 0; cnt < max; cnt++, rngList.advanceFrame())
     {
         Frame3 frame(tid, sid, psv);
-        frame.setInheritance(rngList.at(cnt + iv1), rngList.at(cnt + iv2), rngList.at(cnt + par1), rngList.at(cnt + par2), rngList.at(cnt + par3),
-                             rngList.at(cnt + inh1), rngList.at(cnt + inh2), rngList.at(cnt + inh3), parent1, parent2, true);
+        frame.setInheritance(rngList.at(iv1), rngList.at(iv2), rngList.at(par1), rngList.at(par2), rngList.at(par3),
+                             rngList.at(inh1), rngList.at(inh2), rngList.at(inh3), parent1, parent2, true);
 
         if (compare.compareIVs(frame))
         {
@@ -303,21 +294,16 @@ QVector<QPair<u32, u16>> Egg3::generateLower(const FrameCompare &compare) const
 {
     QVector<QPair<u32, u16>> frames;
 
-    PokeRNG rng(seed, initialFrame - 1);
-    QVector<u16> rngList(maxResults + 2);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<PokeRNG, 2> rngList(PokeRNG(seed, initialFrame - 1));
 
     u32 max = maxResults - initialFrame + 1;
-    for (u32 cnt = 0; cnt < max; cnt++)
+    for (u32 cnt = 0; cnt < max; cnt++, rngList.advanceFrame())
     {
-        if (((rngList.at(cnt) * 100) / 0xFFFF) < compatability)
+        if (((rngList.at(0) * 100) / 0xFFFF) < compatability)
         {
             Frame3 frame;
 
-            u16 pid = (rngList.at(cnt + 1) % 0xFFFE) + 1;
+            u16 pid = (rngList.at(1) % 0xFFFE) + 1;
             frame.setPID(pid, genderRatio);
             if (compare.compareGender(frame))
             {
@@ -333,20 +319,15 @@ QVector<Frame3> Egg3::generateUpper(const QVector<QPair<u32, u16>> &lower, const
 {
     QVector<Frame3> upper;
 
-    PokeRNG rng(pickupSeed, minPickup - 1);
-    QVector<u16> rngList(maxPickup + 12);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<PokeRNG, 16> rngList(PokeRNG(pickupSeed, minPickup - 1));
 
     u32 max = maxPickup - minPickup + 1;
-    for (u32 cnt = 0; cnt < max; cnt++)
+    for (u32 cnt = 0; cnt < max; cnt++, rngList.advanceFrame())
     {
         Frame3 frame(tid, sid, psv);
-        frame.setPID(rngList.at(cnt), genderRatio);
-        frame.setInheritance(rngList.at(cnt + iv1), rngList.at(cnt + iv2), rngList.at(cnt + par1), rngList.at(cnt + par2), rngList.at(cnt + par3),
-                             rngList.at(cnt + inh1), rngList.at(cnt + inh2), rngList.at(cnt + inh3), parent1, parent2);
+        frame.setPID(rngList.at(0), genderRatio);
+        frame.setInheritance(rngList.at(iv1), rngList.at(iv2), rngList.at(par1), rngList.at(par2), rngList.at(par3),
+                             rngList.at(inh1), rngList.at(inh2), rngList.at(inh3), parent1, parent2);
 
         if (compare.compareIVs(frame))
         {
@@ -18,150 +18,123 @@
  */
 
 #include <QFile>
+#include <QHash>
 #include "Encounters3.hpp"
 
-Encounters3::Encounters3(Encounter type, const Profile3 &profile)
-{
-    this->type = type;
-    this->profile = profile;
-    pokemon = Pokemon::loadPersonal(3);
-}
-
-QVector<EncounterArea3> Encounters3::getEncounters() const
+namespace
 {
-    QVector<EncounterArea3> encounters;
-    for (const auto &data : getData())
+    u16 getValue(const char *data, int offset, int length)
     {
-        for (const auto &encounter : getArea(data))
-        {
-            if (encounter.getType() == type)
-            {
-                encounters.append(encounter);
-            }
-        }
+        auto *bytes = reinterpret_cast<const u8 *>(data + offset);
+        return length == 1 ? bytes[0] : static_cast<u16>((bytes[0] << 8) | bytes[1]);
     }
 
-    return encounters;
-}
-
-QByteArrayList Encounters3::getData() const
-{
-    QString path;
-    int size = 122;
-    switch (profile.getVersion())
+    QVector<Slot> getSlots(const char *data, int offset, int count)
     {
-        case Game::Emerald:
-            path = ":/encounters/emerald.bin";
-            break;
-        case Game::Ruby:
-            path = ":/encounters/ruby.bin";
-            break;
-        case Game::Sapphire:
-            path = ":/encounters/sapphire.bin";
-            break;
-        case Game::FireRed:
-            path = ":/encounters/firered.bin";
-            break;
-        case Game::LeafGreen:
-        default:
-            path = ":/encounters/leafgreen.bin";
-            break;
-    }
+        const QVector<Pokemon> &pokemon = Pokemon::loadPersonal(3);
 
-    QByteArray data;
-    QFile file(path);
-    if (file.open(QIODevice::ReadOnly))
-    {
-        data = file.readAll();
-        file.close();
+        QVector<Slot> encounters;
+        for (int i = 0; i < count; i++)
+        {
+            u8 min = getValue(data, offset + i * 4, 1);
+            u8 max = getValue(data, offset + 1 + i * 4, 1);
+            u16 specie = getValue(data, offset + 2 + i * 4, 2);
+            encounters.append(Slot(specie, min, max, pokemon.at(specie)));
+        }
+        return encounters;
     }
 
-    QByteArrayList encounters;
-    for (int i = 0; i < data.size(); i += size)
+    // Every area of one game by encounter type, parsed once and shared by all lookups
+    QHash<int, QVector<EncounterArea3>> parseTable(const QString &path)
     {
-        encounters.append(data.mid(i, size));
-    }
+        const QVector<Pokemon> &pokemon = Pokemon::loadPersonal(3);
 
-    return encounters;
-}
-
-QVector<EncounterArea3> Encounters3::getArea(const QByteArray &data) const
-{
-    QVector<EncounterArea3> encounters;
-    u8 location = getValue(data, 0, 1);
-    u16 delay = getValue(data, 1, 2);
-
-    if (getValue(data, 3, 1) == 1 || getValue(data, 3, 1) == 2)
-    {
-        QVector<Slot> grass;
-        for (int i = 0; i < 12; i++)
+        QByteArray table;
+        QFile file(path);
+        if (file.open(QIODevice::ReadOnly))
         {
-            u8 level = getValue(data, 6 + i * 3, 1);
-            u16 specie = getValue(data, 7 + i * 3, 2);
-            grass.append(Slot(specie, level, pokemon.at(specie)));
+            table = file.readAll();
+            file.close();
         }
 
-        u16 val = getValue(data, 3, 1);
-        encounters.append(EncounterArea3(location, delay, val == 1 ? Encounter::Grass : Encounter::SafariZone, grass));
-    }
-    if (getValue(data, 4, 1) == 1)
-    {
-        QVector<Slot> rock;
-        for (int i = 0; i < 5; i++)
-        {
-            u8 min = getValue(data, 42 + i * 4, 1);
-            u8 max = getValue(data, 43 + i * 4, 1);
-            u16 specie = getValue(data, 44 + i * 4, 2);
-            rock.append(Slot(specie, min, max, pokemon.at(specie)));
-        }
-        encounters.append(EncounterArea3(location, delay, Encounter::RockSmash, rock));
-    }
-    if (getValue(data, 5, 1) == 1)
-    {
-        QVector<Slot> surf;
-        for (int i = 0; i < 5; i++)
+        QHash<int, QVector<EncounterArea3>> encounters;
+        for (int offset = 0; offset + 122 <= table.size(); offset += 122)
         {
-            u8 min = getValue(data, 62 + i * 4, 1);
-            u8 max = getValue(data, 63 + i * 4, 1);
-            u16 specie = getValue(data, 64 + i * 4, 2);
-            surf.append(Slot(specie, min, max, pokemon.at(specie)));
-        }
-        encounters.append(EncounterArea3(location, delay, Encounter::Surfing, surf));
+            const char *data = table.constData() + offset;
+            u8 location = getValue(data, 0, 1);
+            u16 delay = getValue(data, 1, 2);
 
-        QVector<Slot> old;
-        for (int i = 0; i < 2; i++)
-        {
-            u8 min = getValue(data, 82 + i * 4, 1);
-            u8 max = getValue(data, 83 + i * 4, 1);
-            u16 specie = getValue(data, 84 + i * 4, 2);
-            old.append(Slot(specie, min, max, pokemon.at(specie)));
-        }
-        encounters.append(EncounterArea3(location, delay, Encounter::OldRod, old));
+            u16 grassType = getValue(data, 3, 1);
+            if (grassType == 1 || grassType == 2)
+            {
+                QVector<Slot> grass;
+                for (int i = 0; i < 12; i++)
+                {
+                    u8 level = getValue(data, 6 + i * 3, 1);
+                    u16 specie = getValue(data, 7 + i * 3, 2);
+                    grass.append(Slot(specie, level, pokemon.at(specie)));
+                }
 
-        QVector<Slot> good;
-        for (int i = 0; i < 3; i++)
-        {
-            u8 min = getValue(data, 90 + i * 4, 1);
-            u8 max = getValue(data, 91 + i * 4, 1);
-            u16 specie = getValue(data, 92 + i * 4, 2);
-            good.append(Slot(specie, min, max, pokemon.at(specie)));
+                Encounter type = grassType == 1 ? Encounter::Grass : Encounter::SafariZone;
+                encounters[type].append(EncounterArea3(location, delay, type, grass));
+            }
+            if (getValue(data, 4, 1) == 1)
+            {
+                encounters[Encounter::RockSmash].append(EncounterArea3(location, delay, Encounter::RockSmash, getSlots(data, 42, 5)));
+            }
+            if (getValue(data, 5, 1) == 1)
+            {
+                encounters[Encounter::Surfing].append(EncounterArea3(location, delay, Encounter::Surfing, getSlots(data, 62, 5)));
+                encounters[Encounter::OldRod].append(EncounterArea3(location, delay, Encounter::OldRod, getSlots(data, 82, 2)));
+                encounters[Encounter::GoodRod].append(EncounterArea3(location, delay, Encounter::GoodRod, getSlots(data, 90, 3)));
+                encounters[Encounter::SuperRod].append(EncounterArea3(location, delay, Encounter::SuperRod, getSlots(data, 102, 5)));
+            }
         }
-        encounters.append(EncounterArea3(location, delay, Encounter::GoodRod, good));
+        return encounters;
+    }
 
-        QVector<Slot> super;
-        for (int i = 0; i < 5; i++)
+    // Each table is only parsed the first time its game is requested
+    const QHash<int, QVector<EncounterArea3>> &getTable(Game version)
+    {
+        switch (version)
         {
-            u8 min = getValue(data, 102 + i * 4, 1);
-            u8 max = getValue(data, 103 + i * 4, 1);
-            u16 specie = getValue(data, 104 + i * 4, 2);
-            super.append(Slot(specie, min, max, pokemon.at(specie)));
+            case Game::Emerald:
+                {
+                    static const auto emerald = parseTable(":/encounters/emerald.bin");
+                    return emerald;
+                }
+            case Game::Ruby:
+                {
+                    static const auto ruby = parseTable(":/encounters/ruby.bin");
+                    return ruby;
+                }
+            case Game::Sapphire:
+                {
+                    static const auto sapphire = parseTable(":/encounters/sapphire.bin");
+                    return sapphire;
+                }
+            case Game::FireRed:
+                {
+                    static const auto fireRed = parseTable(":/encounters/firered.bin");
+                    return fireRed;
+                }
+            case Game::LeafGreen:
+            default:
+                {
+                    static const auto leafGreen = parseTable(":/encounters/leafgreen.bin");
+                    return leafGreen;
+                }
         }
-        encounters.append(EncounterArea3(location, delay, Encounter::SuperRod, super));
     }
-    return encounters;
 }
 
-u16 Encounters3::getValue(const QByteArray &data, int offset, int length) const
+Encounters3::Encounters3(Encounter type, const Profile3 &profile)
+{
+    this->type = type;
+    this->profile = profile;
+}
+
+QVector<EncounterArea3> Encounters3::getEncounters() const
 {
-    return data.mid(offset, length).toHex().toUShort(nullptr, 16);
+    return getTable(profile.getVersion()).value(type);
 }
@@ -31,14 +31,9 @@ public:
     QVector<EncounterArea3> getEncounters() const;
 
 private:
-    QVector<Pokemon> pokemon;
     Encounter type;
     Profile3 profile;
 
-    QByteArrayList getData() const;
-    QVector<EncounterArea3> getArea(const QByteArray &data) const;
-    u16 getValue(const QByteArray &data, int offset, int length) const;
-
 };
 
 #endif // ENCOUNTERS3_HPP
@@ -17,6 +17,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <QCoreApplication>
 #include "Frame3.hpp"
 
 Frame3::Frame3()
@@ -79,49 +80,44 @@ QString Frame3::getTimeEgg() const
 
 void Frame3::setInheritance(u16 iv1, u16 iv2, u16 par1, u16 par2, u16 par3, u16 inh1, u16 inh2, u16 inh3, const QVector<u8> &parent1, const QVector<u8> &parent2, bool broken)
 {
-    ivs[0] = iv1 & 0x1f;
-    ivs[1] = (iv1 >> 5) & 0x1f;
-    ivs[2] = (iv1 >> 10) & 0x1f;
-    ivs[3] = (iv2 >> 5) & 0x1f;
-    ivs[4] = (iv2 >> 10) & 0x1f;
-    ivs[5] = iv2 & 0x1f;
+    setIVs(iv1, iv2);
 
-    QVector<u8> available = { 0, 1, 2, 3, 4, 5 };
-    QVector<u16> val = { inh1, inh2, inh3, par1, par2, par3 };
+    u8 available[6] = { 0, 1, 2, 3, 4, 5 };
+    u16 val[6] = { inh1, inh2, inh3, par1, par2, par3 };
 
     for (u8 cnt = 0; cnt < 3; cnt++)
     {
         // Decide which parent (1 or 2) from which we'll pick an IV
-        u8 par = val.at(cnt + 3) & 1;
+        u8 par = val[cnt + 3] & 1;
 
         // Decide which stat to pick for IV inheritance
-        u8 ivslot = available.at(val.at(cnt) % (6 - cnt));
+        u8 ivslot = available[val[cnt] % (6 - cnt)];
 
         switch (ivslot)
         {
             case 0:
-                ivs[0] = par == 0 ? parent1.at(0) : parent2.at(0);
-                inheritance[0] = par == 0 ? 'A' : 'B';
+                setIV(0, par == 0 ? parent1.at(0) : parent2.at(0));
+                setInheritance(0, par == 0 ? 'A' : 'B');
                 break;
             case 1:
-                ivs[1] = par == 0 ? parent1.at(1) : parent2.at(1);
-                inheritance[1] = par == 0 ? 'A' : 'B';
+                setIV(1, par == 0 ? parent1.at(1) : parent2.at(1));
+                setInheritance(1, par == 0 ? 'A' : 'B');
                 break;
             case 2:
-                ivs[2] = par == 0 ? parent1.at(2) : parent2.at(2);
-                inheritance[2] = par == 0 ? 'A' : 'B';
+                setIV(2, par == 0 ? parent1.at(2) : parent2.at(2));
+                setInheritance(2, par == 0 ? 'A' : 'B');
                 break;
             case 3:
-                ivs[5] = par == 0 ? parent1.at(5) : parent2.at(5);
-                inheritance[5] = par == 0 ? 'A' : 'B';
+                setIV(5, par == 0 ? parent1.at(5) : parent2.at(5));
+                setInheritance(5, par == 0 ? 'A' : 'B');
                 break;
             case 4:
-                ivs[3] = par == 0 ? parent1.at(3) : parent2.at(3);
-                inheritance[3] = par == 0 ? 'A' : 'B';
+                setIV(3, par == 0 ? parent1.at(3) : parent2.at(3));
+                setInheritance(3, par == 0 ? 'A' : 'B');
                 break;
             case 5:
-                ivs[4] = par == 0 ? parent1.at(4) : parent2.at(4);
-                inheritance[4] = par == 0 ? 'A' : 'B';
+                setIV(4, par == 0 ? parent1.at(4) : parent2.at(4));
+                setInheritance(4, par == 0 ? 'A' : 'B');
                 break;
         }
 
@@ -129,7 +125,7 @@ void Frame3::setInheritance(u16 iv1, u16 iv2, u16 par1, u16 par2, u16 par3, u16
         // In Emerald this doesn't work properly
         for (u8 i = broken ? cnt : ivslot; i < 5 - cnt; i++)
         {
-            available[i] = available.at(i + 1);
+            available[i] = available[i + 1];
         }
     }
 
@@ -155,12 +151,37 @@ void Frame3::setPID(u16 high, u16 low, u16 genderRatio)
     shiny = ((pid >> 16) ^ (pid & 0xFFFF) ^ psv) < 8;
 }
 
-QString Frame3::getLockReason() const
+QString Frame3::getLockReasonString() const
+{
+    switch (lockReason)
+    {
+        case LockReason::PassNL:
+            return QObject::tr("Pass NL");
+        case LockReason::FirstShadowUnset:
+            return QObject::tr("First shadow unset");
+        case LockReason::FirstShadowSet:
+            return QObject::tr("First shadow set");
+        case LockReason::ShinySkip:
+            return QObject::tr("Shiny Skip");
+        // Spot types keep the translations of the PokeSpot window
+        case LockReason::Common:
+            return QCoreApplication::translate("PokeSpot", "Common");
+        case LockReason::Uncommon:
+            return QCoreApplication::translate("PokeSpot", "Uncommon");
+        case LockReason::Rare:
+            return QCoreApplication::translate("PokeSpot", "Rare");
+        case LockReason::None:
+        default:
+            return QString();
+    }
+}
+
+LockReason Frame3::getLockReason() const
 {
     return lockReason;
 }
 
-void Frame3::setLockReason(const QString &value)
+void Frame3::setLockReason(const LockReason &value)
 {
     lockReason = value;
 }
@@ -21,6 +21,7 @@
 #define FRAME3_HPP
 
 #include <Core/Parents/Frame.hpp>
+#include <Core/Util/LockReason.hpp>
 
 class Frame3: public Frame
 {
@@ -28,14 +29,16 @@ class Frame3: public Frame
 public:
     Frame3();
     Frame3(u16 tid, u16 sid, u16 psv);
+    using Frame::setInheritance;
     QString getTime() const;
     QString getTimeEgg() const;
     void setInheritance(u16 iv1, u16 iv2, u16 par1, u16 par2, u16 par3, u16 inh1, u16 inh2,
                         u16 inh3, const QVector<u8> &parent1, const QVector<u8> &parent2, bool broken = false);
     void setPID(u32 pid, u16 genderRatio);
     void setPID(u16 high, u16 low, u16 genderRatio);
-    QString getLockReason() const;
-    void setLockReason(const QString &value);
+    QString getLockReasonString() const;
+    LockReason getLockReason() const;
+    void setLockReason(const LockReason &value);
     u32 getEggFrame() const;
     void setEggFrame(const u32 &value);
     u32 getSeed() const;
@@ -43,10 +46,13 @@ public:
     void xorFrame(bool flag = false);
 
 private:
-    QString lockReason;
     u32 eggFrame{};
     u32 seed{};
+    LockReason lockReason = LockReason::None;
+    u8 padding[3]{}; // Raw records are written byte for byte, so the tail padding is spelled out and zeroed
 
 };
 
+Q_DECLARE_TYPEINFO(Frame3, Q_MOVABLE_TYPE);
+
 #endif // FRAME3_HPP
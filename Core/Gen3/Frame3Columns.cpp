@@ -0,0 +1,318 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Frame3Columns.hpp"
+
+Searcher3Columns::Searcher3Columns(Method method)
+{
+    this->method = method;
+}
+
+int Searcher3Columns::getColumnCount() const
+{
+    switch (method)
+    {
+        case Method::MethodH1:
+        case Method::MethodH2:
+        case Method::MethodH4:
+            return 17;
+        case Method::XD:
+        case Method::Colo:
+            return 15;
+        case Method::Method1:
+        case Method::Method1Reverse:
+        case Method::Method2:
+        case Method::Method4:
+        case Method::XDColo:
+        case Method::Channel:
+            return 14;
+        default:
+            return 0;
+    }
+}
+
+QStringList Searcher3Columns::getHeader() const
+{
+    switch (method)
+    {
+        case Method::MethodH1:
+        case Method::MethodH2:
+        case Method::MethodH4:
+            return
+            {
+                tr("Seed"), tr("Lead"), tr("Slot"), tr("Level"), tr("PID"), "!!!", tr("Nature"), tr("Ability"),
+                tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
+            };
+        case Method::Method1:
+        case Method::Method1Reverse:
+        case Method::Method2:
+        case Method::Method4:
+        case Method::XDColo:
+        case Method::Channel:
+            return
+            {
+                tr("Seed"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"), tr("Atk"),
+                tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
+            };
+        case Method::XD:
+        case Method::Colo:
+            return
+            {
+                tr("Seed"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"), tr("Atk"), tr("Def"),
+                tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender"), tr("Reason")
+            };
+        default:
+            return QStringList();
+    }
+}
+
+QVariant Searcher3Columns::getData(const Frame3 &frame, int column) const
+{
+    switch (method)
+    {
+        case Method::MethodH1:
+        case Method::MethodH2:
+        case Method::MethodH4:
+            switch (column)
+            {
+                case 0:
+                    return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
+                case 1:
+                    {
+                        Lead type = frame.getLeadType();
+                        return type == Lead::None ? tr("None") : type == Lead::Synchronize ? tr("Synch") : tr("Cute Charm");
+                    }
+                case 2:
+                    return frame.getEncounterSlot();
+                case 3:
+                    return frame.getLevel();
+                case 4:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 5:
+                    return frame.getShinyString();
+                case 6:
+                    return frame.getNatureString();
+                case 7:
+                    return frame.getAbility();
+                case 8:
+                    return frame.getIV(0);
+                case 9:
+                    return frame.getIV(1);
+                case 10:
+                    return frame.getIV(2);
+                case 11:
+                    return frame.getIV(3);
+                case 12:
+                    return frame.getIV(4);
+                case 13:
+                    return frame.getIV(5);
+                case 14:
+                    return frame.getPowerString();
+                case 15:
+                    return frame.getPower();
+                case 16:
+                    return frame.getGenderString();
+                default:
+                    return QVariant();
+            }
+        case Method::Method1:
+        case Method::Method1Reverse:
+        case Method::Method2:
+        case Method::Method4:
+        case Method::XDColo:
+        case Method::Channel:
+            switch (column)
+            {
+                case 0:
+                    return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
+                case 1:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 2:
+                    return frame.getShinyString();
+                case 3:
+                    return frame.getNatureString();
+                case 4:
+                    return frame.getAbility();
+                case 5:
+                    return frame.getIV(0);
+                case 6:
+                    return frame.getIV(1);
+                case 7:
+                    return frame.getIV(2);
+                case 8:
+                    return frame.getIV(3);
+                case 9:
+                    return frame.getIV(4);
+                case 10:
+                    return frame.getIV(5);
+                case 11:
+                    return frame.getPowerString();
+                case 12:
+                    return frame.getPower();
+                case 13:
+                    return frame.getGenderString();
+            }
+        case Method::XD:
+        case Method::Colo:
+            switch (column)
+            {
+                case 0:
+                    return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
+                case 1:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 2:
+                    return frame.getShinyString();
+                case 3:
+                    return frame.getNatureString();
+                case 4:
+                    return frame.getAbility();
+                case 5:
+                    return frame.getIV(0);
+                case 6:
+                    return frame.getIV(1);
+                case 7:
+                    return frame.getIV(2);
+                case 8:
+                    return frame.getIV(3);
+                case 9:
+                    return frame.getIV(4);
+                case 10:
+                    return frame.getIV(5);
+                case 11:
+                    return frame.getPowerString();
+                case 12:
+                    return frame.getPower();
+                case 13:
+                    return frame.getGenderString();
+                case 14:
+                    return frame.getLockReasonString();
+            }
+        default:
+            break;
+    }
+    return QVariant();
+}
+
+int Stationary3Columns::getColumnCount() const
+{
+    return 15;
+}
+
+QStringList Stationary3Columns::getHeader() const
+{
+    return
+    {
+        tr("Frame"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"), tr("Atk"), tr("Def"),
+        tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender"), tr("Time")
+    };
+}
+
+QVariant Stationary3Columns::getData(const Frame3 &frame, int column) const
+{
+    switch (column)
+    {
+        case 0:
+            return frame.getFrame();
+        case 1:
+            return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+        case 2:
+            return frame.getShinyString();
+        case 3:
+            return frame.getNatureString();
+        case 4:
+            return frame.getAbility();
+        case 5:
+            return frame.getIV(0);
+        case 6:
+            return frame.getIV(1);
+        case 7:
+            return frame.getIV(2);
+        case 8:
+            return frame.getIV(3);
+        case 9:
+            return frame.getIV(4);
+        case 10:
+            return frame.getIV(5);
+        case 11:
+            return frame.getPowerString();
+        case 12:
+            return frame.getPower();
+        case 13:
+            return frame.getGenderString();
+        case 14:
+            return frame.getTime();
+    }
+    return QVariant();
+}
+
+int Wild3Columns::getColumnCount() const
+{
+    return 17;
+}
+
+QStringList Wild3Columns::getHeader() const
+{
+    return
+    {
+        tr("Frame"), tr("Slot"), tr("Level"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"),
+        tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender"), tr("Time")
+    };
+}
+
+QVariant Wild3Columns::getData(const Frame3 &frame, int column) const
+{
+    switch (column)
+    {
+        case 0:
+            return frame.getFrame();
+        case 1:
+            return frame.getEncounterSlot();
+        case 2:
+            return frame.getLevel();
+        case 3:
+            return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+        case 4:
+            return frame.getShinyString();
+        case 5:
+            return frame.getNatureString();
+        case 6:
+            return frame.getAbility();
+        case 7:
+            return frame.getIV(0);
+        case 8:
+            return frame.getIV(1);
+        case 9:
+            return frame.getIV(2);
+        case 10:
+            return frame.getIV(3);
+        case 11:
+            return frame.getIV(4);
+        case 12:
+            return frame.getIV(5);
+        case 13:
+            return frame.getPowerString();
+        case 14:
+            return frame.getPower();
+        case 15:
+            return frame.getGenderString();
+        case 16:
+            return frame.getTime();
+    }
+    return QVariant();
+}
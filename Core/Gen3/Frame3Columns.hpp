@@ -0,0 +1,66 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef FRAME3COLUMNS_HPP
+#define FRAME3COLUMNS_HPP
+
+#include <QCoreApplication>
+#include <QVariant>
+#include <Core/Gen3/Frame3.hpp>
+
+// Display text of the Gen 3 result tables, shared by the models and the batch runner.
+// Translations keep the context of the model each table was first written in.
+class Searcher3Columns
+{
+    Q_DECLARE_TR_FUNCTIONS(Searcher3Model)
+
+public:
+    Searcher3Columns(Method method = Method::Method1);
+    int getColumnCount() const;
+    QStringList getHeader() const;
+    QVariant getData(const Frame3 &frame, int column) const;
+
+private:
+    Method method;
+
+};
+
+class Stationary3Columns
+{
+    Q_DECLARE_TR_FUNCTIONS(Stationary3Model)
+
+public:
+    int getColumnCount() const;
+    QStringList getHeader() const;
+    QVariant getData(const Frame3 &frame, int column) const;
+
+};
+
+class Wild3Columns
+{
+    Q_DECLARE_TR_FUNCTIONS(Wild3Model)
+
+public:
+    int getColumnCount() const;
+    QStringList getHeader() const;
+    QVariant getData(const Frame3 &frame, int column) const;
+
+};
+
+#endif // FRAME3COLUMNS_HPP
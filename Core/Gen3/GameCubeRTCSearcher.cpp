@@ -17,9 +17,13 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <QtConcurrent>
 #include "GameCubeRTCSearcher.hpp"
 #include <Core/RNG/LCRNG.hpp>
+#include <Core/Util/SearchScheduler.hpp>
+
+// The initial seed advances by 40500000 a second, so after 2^27 seconds every seed has been tried
+#define SECONDS 0x8000000
+#define CHUNKSIZE 64
 
 GameCubeRTCSearcher::GameCubeRTCSearcher(u32 initialSeed, u32 targetSeed, u32 minFrame, u32 maxFrame)
 {
@@ -27,8 +31,12 @@ GameCubeRTCSearcher::GameCubeRTCSearcher(u32 initialSeed, u32 targetSeed, u32 mi
     this->targetSeed = targetSeed;
     this->minFrame = minFrame;
     this->maxFrame = maxFrame;
+    foundSecond = 0;
+    foundFrame = 0;
     searching = false;
     cancel = false;
+    found = false;
+    job = -1;
 
     connect(this, &GameCubeRTCSearcher::finished, this, [ = ]
     {
@@ -43,54 +51,68 @@ void GameCubeRTCSearcher::startSearch()
     {
         searching = true;
         cancel = false;
+        found = false;
+
+        XDRNGR back(targetSeed, minFrame);
+        targetSeed = back.getSeed();
 
-        QtConcurrent::run([ = ] { search(); });
+        job = SearchScheduler::getInstance().submit(SECONDS / CHUNKSIZE, [ = ](int chunk) { search(chunk); }, [ = ](bool)
+        {
+            if (found)
+            {
+                emit result(getResult());
+            }
+            emit finished();
+        });
     }
 }
 
 void GameCubeRTCSearcher::cancelSearch()
 {
     cancel = true;
+    SearchScheduler::getInstance().cancel(job);
 }
 
-void GameCubeRTCSearcher::search()
+// Each chunk tries CHUNKSIZE seconds. Chunks are handed out in order, so once a match is found the
+// job is cancelled and only the chunks before it, which may hold an earlier match, keep running.
+void GameCubeRTCSearcher::search(int chunk)
 {
-    XDRNGR back(targetSeed, minFrame);
-    targetSeed = back.getSeed();
-
-    u32 seconds = 0;
-    u32 minutes = 0;
-    u8 secoundCount = 0;
-
-    while (!cancel)
+    u32 start = static_cast<u32>(chunk) * CHUNKSIZE;
+    for (u32 second = start; second < start + CHUNKSIZE; second++)
     {
-        XDRNG rng(initialSeed);
+        if (cancel)
+        {
+            return;
+        }
+
+        XDRNG rng(initialSeed + second * 40500000);
 
         for (u32 x = 0; x < maxFrame; x++)
         {
             if (rng.nextUInt() == targetSeed)
             {
-                QDateTime finalTime = date.addSecs(seconds);
-                QList<QStandardItem *> row;
-                QString time = finalTime.toString(Qt::SystemLocaleShortDate);
-                row << (time.contains("M") ? new QStandardItem(time.insert((time.indexOf('M') - 2), ":" + QString::number(finalTime.time().second()))) : new QStandardItem(time.append(":" + QString::number(finalTime.time().second()))))
-                    << new QStandardItem(QString::number(x + 2 + minFrame)) << new QStandardItem(QString::number(initialSeed, 16).toUpper());
+                QMutexLocker locker(&mutex);
+                if (!found || second < foundSecond)
+                {
+                    found = true;
+                    foundSecond = second;
+                    foundFrame = x;
+                }
+                locker.unlock();
 
-                emit result(row);
-                emit finished();
+                SearchScheduler::getInstance().cancelCurrent();
                 return;
             }
         }
-
-        initialSeed += 40500000;
-        seconds++;
-        secoundCount++;
-
-        if (secoundCount == 60)
-        {
-            minutes++;
-            secoundCount = 0;
-        }
     }
-    emit finished();
+}
+
+QList<QStandardItem *> GameCubeRTCSearcher::getResult() const
+{
+    QDateTime finalTime = date.addSecs(foundSecond);
+    QList<QStandardItem *> row;
+    QString time = finalTime.toString(Qt::SystemLocaleShortDate);
+    row << (time.contains("M") ? new QStandardItem(time.insert((time.indexOf('M') - 2), ":" + QString::number(finalTime.time().second()))) : new QStandardItem(time.append(":" + QString::number(finalTime.time().second()))))
+        << new QStandardItem(QString::number(foundFrame + 2 + minFrame)) << new QStandardItem(QString::number(initialSeed + foundSecond * 40500000, 16).toUpper());
+    return row;
 }
@@ -45,9 +45,13 @@ private:
     const QDateTime date = QDateTime(QDate(2000, 1, 1), QTime(0, 0));
     u32 initialSeed, targetSeed;
     u32 minFrame, maxFrame;
-    bool searching, cancel;
+    u32 foundSecond, foundFrame;
+    bool searching, cancel, found;
+    int job;
+    QMutex mutex;
 
-    void search();
+    void search(int chunk);
+    QList<QStandardItem *> getResult() const;
 };
 
 #endif // GAMECUBERTCSEARCHER_HPP
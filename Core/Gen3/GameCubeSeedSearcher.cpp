@@ -18,9 +18,12 @@
  */
 
 #include <QFile>
-#include <QtConcurrent>
+#include <QTimer>
 #include "GameCubeSeedSearcher.hpp"
 #include <Core/RNG/LCRNG.hpp>
+#include <Core/Util/SearchScheduler.hpp>
+
+#define CHUNKSIZE 0x400
 
 static const QVector<QVector<u16>> galesHPStat =
 {
@@ -70,11 +73,12 @@ GameCubeSeedSearcher::GameCubeSeedSearcher(Game version, const QVector<u32> &cri
     this->criteria = criteria;
     searching = false;
     cancel = false;
-    progress = 0;
+    job = -1;
 
     connect(this, &GameCubeSeedSearcher::finished, this, [ = ]
     {
         searching = false;
+        emit updateProgress(progress.sample());
         QTimer::singleShot(1000, this, &GameCubeSeedSearcher::deleteLater);
     });
 }
@@ -127,16 +131,29 @@ void GameCubeSeedSearcher::startSearch(const QVector<u32> &seeds)
     if (!searching)
     {
         this->seeds = seeds;
-        progress = 0;
+        newSeeds.clear();
+        progress.start(static_cast<u64>(seeds.size()));
         searching = true;
         cancel = false;
 
         auto *timer = new QTimer(this);
         connect(this, &GameCubeSeedSearcher::finished, timer, &QTimer::stop);
-        connect(timer, &QTimer::timeout, this, [ = ] {  emit updateProgress(progress); });
+        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(progress.sample()); });
         timer->start(1000);
 
-        QtConcurrent::run([ = ] { search(); });
+        int chunks = (seeds.size() + CHUNKSIZE - 1) / CHUNKSIZE;
+        job = SearchScheduler::getInstance().submit(chunks, [ = ](int chunk) { search(chunk); }, [ = ](bool cancelled)
+        {
+            if (!cancelled)
+            {
+                std::sort(newSeeds.begin(), newSeeds.end());
+                auto unique = std::unique(newSeeds.begin(), newSeeds.end());
+                newSeeds.erase(unique, newSeeds.end());
+
+                emit outputSeeds(newSeeds);
+            }
+            emit finished();
+        });
     }
 }
 
@@ -148,43 +165,57 @@ void GameCubeSeedSearcher::addHPCriteria(const QVector<u32> &criteria)
 void GameCubeSeedSearcher::cancelSearch()
 {
     cancel = true;
+    SearchScheduler::getInstance().cancel(job);
 }
 
-void GameCubeSeedSearcher::search()
+void GameCubeSeedSearcher::pauseSearch()
 {
-    QVector<u32> newSeeds;
-    for (u32 seed : seeds)
+    SearchScheduler::getInstance().pause(job);
+}
+
+void GameCubeSeedSearcher::resumeSearch()
+{
+    SearchScheduler::getInstance().resume(job);
+}
+
+void GameCubeSeedSearcher::setMaxThreads(int maxThreads)
+{
+    SearchScheduler::getInstance().setMaxThreads(job, maxThreads);
+}
+
+// Each chunk checks CHUNKSIZE seeds, the matches are sorted once every chunk is done
+void GameCubeSeedSearcher::search(int chunk)
+{
+    QVector<u32> matches;
+
+    int end = qMin(seeds.size(), (chunk + 1) * CHUNKSIZE);
+    for (int i = chunk * CHUNKSIZE; i < end; i++)
     {
         if (cancel)
         {
-            emit finished();
             return;
         }
 
+        u32 seed = seeds.at(i);
         if (version & Game::Gales)
         {
             if (generateTeamGales(seed))
             {
-                newSeeds.append(seed);
+                matches.append(seed);
             }
         }
         else
         {
             if (generateTeamColo(seed))
             {
-                newSeeds.append(seed);
+                matches.append(seed);
             }
         }
-        progress++;
+        progress.add();
     }
 
-    std::sort(newSeeds.begin(), newSeeds.end());
-    auto unique = std::unique(newSeeds.begin(), newSeeds.end());
-    newSeeds.erase(unique, newSeeds.end());
-
-    emit updateProgress(progress);
-    emit outputSeeds(newSeeds);
-    emit finished();
+    QMutexLocker locker(&mutex);
+    newSeeds.append(matches);
 }
 
 bool GameCubeSeedSearcher::generateTeamGales(u32 &seed)
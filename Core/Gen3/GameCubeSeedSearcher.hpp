@@ -20,10 +20,12 @@
 #ifndef GAMECUBESEEDSEARCHER_HPP
 #define GAMECUBESEEDSEARCHER_HPP
 
+#include <QMutex>
 #include <QObject>
 #include <QVector>
 #include <Core/Util/Game.hpp>
 #include <Core/Util/Global.hpp>
+#include <Core/Util/SearchProgress.hpp>
 
 class GameCubeSeedSearcher : public QObject
 {
@@ -32,7 +34,7 @@ class GameCubeSeedSearcher : public QObject
 signals:
     void finished();
     void outputSeeds(QVector<u32> seeds);
-    void updateProgress(int);
+    void updateProgress(const ProgressReport &);
 
 public:
     GameCubeSeedSearcher(Game version, const QVector<u32> &criteria);
@@ -42,15 +44,21 @@ public:
 
 public slots:
     void cancelSearch();
+    void pauseSearch();
+    void resumeSearch();
+    void setMaxThreads(int maxThreads);
 
 private:
     QVector<u32> seeds;
+    QVector<u32> newSeeds;
     QVector<u32> criteria;
     Game version;
     bool searching, cancel;
-    int progress;
+    int job;
+    SearchProgress progress;
+    QMutex mutex;
 
-    void search();
+    void search(int chunk);
     bool generateTeamGales(u32 &seed);
     bool generateTeamColo(u32 &seed);
     void generatePokemonGales(u32 &seed, u16 tsv);
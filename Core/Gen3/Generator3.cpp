@@ -18,6 +18,7 @@
  */
 
 #include "Generator3.hpp"
+#include <Core/RNG/RNGList.hpp>
 #include <Core/Util/EncounterSlot.hpp>
 
 Generator3::Generator3()
@@ -49,20 +50,20 @@ QVector<Frame3> Generator3::generate(const FrameCompare &compare) const
         case Method::Method1:
         case Method::Method2:
         case Method::Method4:
-            return generateMethod124(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateMethod124(compare));
         case Method::Method1Reverse:
-            return generateMethod1Reverse(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateMethod1Reverse(compare));
         case Method::MethodH1:
         case Method::MethodH2:
         case Method::MethodH4:
-            return generateMethodH124(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateMethodH124(compare));
         case Method::XDColo:
-            return generateMethodXDColo(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateMethodXDColo(compare));
         case Method::XD:
         case Method::Colo:
-            return generateMethodXDColoShadow(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateMethodXDColoShadow(compare));
         case Method::Channel:
-            return generateMethodChannel(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateMethodChannel(compare));
         default:
             return QVector<Frame3>();
     }
@@ -104,20 +105,15 @@ QVector<Frame3> Generator3::generateMethodChannel(const FrameCompare &compare) c
     QVector<Frame3> frames;
     Frame3 frame(tid, sid, psv);
 
-    XDRNG rng(initialSeed, initialFrame - 1 + offset);
-    QVector<u16> rngList(maxResults + 12);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<XDRNG, 16> rngList(XDRNG(initialSeed, initialFrame - 1 + offset));
 
     // Method Channel [SEED] [SID] [PID] [PID] [BERRY] [GAME ORIGIN] [OT GENDER] [IV] [IV] [IV] [IV] [IV] [IV]
 
-    for (u32 cnt = 0; cnt < maxResults; cnt++)
+    for (u32 cnt = 0; cnt < maxResults; cnt++, rngList.advanceFrame())
     {
-        u16 high = rngList.at(cnt + 1);
-        u16 low = rngList.at(cnt + 2);
-        u16 sid = rngList.at(cnt);
+        u16 high = rngList.at(1);
+        u16 low = rngList.at(2);
+        u16 sid = rngList.at(0);
 
         frame.setIDs(40122, sid, 40122 ^ sid);
 
@@ -130,8 +126,8 @@ QVector<Frame3> Generator3::generateMethodChannel(const FrameCompare &compare) c
             frame.setPID(high, low, genderRatio);
         }
 
-        frame.setIVs(rngList.at(cnt + 6) >> 11, rngList.at(cnt + 7) >> 11, rngList.at(cnt + 8) >> 11,
-                     rngList.at(cnt + 10) >> 11, rngList.at(cnt + 11) >> 11, rngList.at(cnt + 9) >> 11);
+        frame.setIVs(rngList.at(6) >> 11, rngList.at(7) >> 11, rngList.at(8) >> 11,
+                     rngList.at(10) >> 11, rngList.at(11) >> 11, rngList.at(9) >> 11);
 
         if (compare.compareFrame(frame))
         {
@@ -305,9 +301,14 @@ QVector<Frame3> Generator3::generateMethodH124(const FrameCompare &compare) cons
             go.nextUInt();
             iv2 = go.nextUShort();
         }
+        if (!compare.compareIVs(iv1, iv2))
+        {
+            continue;
+        }
+
         frame.setIVs(iv1, iv2);
 
-        if (compare.compareFrame(frame))
+        if (compare.comparePID(frame))
         {
             frame.setFrame(cnt);
             frames.append(frame);
@@ -322,26 +323,26 @@ QVector<Frame3> Generator3::generateMethodXDColo(const FrameCompare &compare) co
     QVector<Frame3> frames;
     Frame3 frame(tid, sid, psv);
 
-    XDRNG rng(initialSeed, initialFrame - 1 + offset);
-    QVector<u16> rngList(maxResults + 5);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<XDRNG, 8> rngList(XDRNG(initialSeed, initialFrame - 1 + offset));
 
     // Method XD/Colo [SEED] [IVS] [IVS] [BLANK] [PID] [PID]
 
-    for (u32 cnt = 0; cnt < maxResults; cnt++)
+    for (u32 cnt = 0; cnt < maxResults; cnt++, rngList.advanceFrame())
     {
-        u16 high = rngList.at(cnt + 3);
-        u16 low = rngList.at(cnt + 4);
-        u16 iv1 = rngList.at(cnt);
-        u16 iv2 = rngList.at(cnt + 1);
+        u16 high = rngList.at(3);
+        u16 low = rngList.at(4);
+        u16 iv1 = rngList.at(0);
+        u16 iv2 = rngList.at(1);
+
+        if (!compare.compareIVs(iv1, iv2))
+        {
+            continue;
+        }
 
         frame.setPID(high, low, genderRatio);
         frame.setIVs(iv1, iv2);
 
-        if (compare.compareFrame(frame))
+        if (compare.comparePID(frame))
         {
             frame.setFrame(cnt + initialFrame);
             frames.append(frame);
@@ -365,6 +366,12 @@ QVector<Frame3> Generator3::generateMethodXDColoShadow(const FrameCompare &compa
 
         u16 iv1 = go.nextUShort();
         u16 iv2 = go.nextUShort();
+
+        if (!compare.compareIVs(iv1, iv2))
+        {
+            continue;
+        }
+
         frame.setIVs(iv1, iv2);
 
         go.nextUInt();
@@ -373,7 +380,7 @@ QVector<Frame3> Generator3::generateMethodXDColoShadow(const FrameCompare &compa
         u16 low = go.nextUShort();
         frame.setPID(high, low, genderRatio);
 
-        if (compare.compareFrame(frame))
+        if (compare.comparePID(frame))
         {
             frame.setFrame(cnt + initialFrame);
             frames.append(frame);
@@ -388,28 +395,28 @@ QVector<Frame3> Generator3::generateMethod124(const FrameCompare &compare) const
     QVector<Frame3> frames;
     Frame3 frame(tid, sid, psv);
 
-    PokeRNG rng(initialSeed, initialFrame - 1 + offset);
-    QVector<u16> rngList(maxResults + 5);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<PokeRNG, 8> rngList(PokeRNG(initialSeed, initialFrame - 1 + offset));
 
     // Method 1 [SEED] [PID] [PID] [IVS] [IVS]
     // Method 2 [SEED] [PID] [PID] [BLANK] [IVS] [IVS]
     // Method 4 [SEED] [PID] [PID] [IVS] [BLANK] [IVS]
 
-    for (u32 cnt = 0; cnt < maxResults; cnt++)
+    for (u32 cnt = 0; cnt < maxResults; cnt++, rngList.advanceFrame())
     {
-        u16 high = rngList.at(cnt + 1);
-        u16 low = rngList.at(cnt);
-        u16 iv1 = rngList.at(cnt + ivFirst);
-        u16 iv2 = rngList.at(cnt + ivSecond);
+        u16 high = rngList.at(1);
+        u16 low = rngList.at(0);
+        u16 iv1 = rngList.at(ivFirst);
+        u16 iv2 = rngList.at(ivSecond);
+
+        if (!compare.compareIVs(iv1, iv2))
+        {
+            continue;
+        }
 
         frame.setPID(high, low, genderRatio);
         frame.setIVs(iv1, iv2);
 
-        if (compare.compareFrame(frame))
+        if (compare.comparePID(frame))
         {
             frame.setFrame(cnt + initialFrame);
             frames.append(frame);
@@ -424,26 +431,26 @@ QVector<Frame3> Generator3::generateMethod1Reverse(const FrameCompare &compare)
     QVector<Frame3> frames;
     Frame3 frame(tid, sid, psv);
 
-    PokeRNG rng(initialSeed, initialFrame - 1 + offset);
-    QVector<u16> rngList(maxResults + 4);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<PokeRNG, 4> rngList(PokeRNG(initialSeed, initialFrame - 1 + offset));
 
     // Method 1 Reverse [SEED] [PID] [PID] [IVS] [IVS]
 
-    for (u32 cnt = 0; cnt < maxResults; cnt++)
+    for (u32 cnt = 0; cnt < maxResults; cnt++, rngList.advanceFrame())
     {
-        u16 high = rngList.at(cnt);
-        u16 low = rngList.at(cnt + 1);
-        u16 iv1 = rngList.at(cnt + 2);
-        u16 iv2 = rngList.at(cnt + 3);
+        u16 high = rngList.at(0);
+        u16 low = rngList.at(1);
+        u16 iv1 = rngList.at(2);
+        u16 iv2 = rngList.at(3);
+
+        if (!compare.compareIVs(iv1, iv2))
+        {
+            continue;
+        }
 
         frame.setPID(high, low, genderRatio);
         frame.setIVs(iv1, iv2);
 
-        if (compare.compareFrame(frame))
+        if (compare.comparePID(frame))
         {
             frame.setFrame(cnt + initialFrame);
             frames.append(frame);
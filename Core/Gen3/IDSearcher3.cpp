@@ -0,0 +1,128 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QTimer>
+#include "IDSearcher3.hpp"
+#include <Core/RNG/LCRNG.hpp>
+#include <Core/Util/SearchScheduler.hpp>
+
+#define CHUNKSIZE 0x40000
+
+IDSearcher3::IDSearcher3(const IDFilter &filter, u32 seed, u32 minFrame, u32 maxResults, Game version) :
+    filter(filter)
+{
+    this->seed = seed;
+    this->minFrame = minFrame;
+    this->version = version;
+    searching = false;
+    cancel = false;
+    job = -1;
+
+    // Frames are searched from minFrame to minFrame + maxResults inclusive
+    u32 maxFrame = minFrame + maxResults;
+    total = maxFrame < minFrame ? 0 : static_cast<u64>(maxFrame) - minFrame + 1;
+
+    connect(this, &IDSearcher3::finished, this, [ = ]
+    {
+        searching = false;
+        emit updateProgress(results.takeAll(), progress.sample());
+        QTimer::singleShot(1000, this, &IDSearcher3::deleteLater);
+    });
+}
+
+void IDSearcher3::startSearch()
+{
+    if (!searching)
+    {
+        progress.start(total);
+        searching = true;
+        cancel = false;
+
+        auto *timer = new QTimer(this);
+        connect(this, &IDSearcher3::finished, timer, &QTimer::stop);
+        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(results.take(), progress.sample()); });
+        timer->start(1000);
+
+        int chunks = static_cast<int>((total + CHUNKSIZE - 1) / CHUNKSIZE);
+        job = SearchScheduler::getInstance().submit(chunks, [ = ](int chunk) { search(chunk); }, [ = ](bool) { emit finished(); });
+    }
+}
+
+void IDSearcher3::cancelSearch()
+{
+    cancel = true;
+    SearchScheduler::getInstance().cancel(job);
+}
+
+// Each chunk covers CHUNKSIZE frames from its own advanced RNG
+void IDSearcher3::search(int chunk)
+{
+    if (cancel)
+    {
+        return;
+    }
+
+    u64 offset = static_cast<u64>(chunk) * CHUNKSIZE;
+    u32 count = static_cast<u32>(qMin<u64>(CHUNKSIZE, total - offset));
+
+    results.add(chunk, searchFrames(minFrame + static_cast<u32>(offset), count));
+    progress.add(count);
+}
+
+QVector<IDFrame3> IDSearcher3::searchFrames(u32 frame, u32 count) const
+{
+    QVector<IDFrame3> frames;
+
+    LCRNG rng = version & Game::GC ? static_cast<LCRNG>(XDRNG(seed)) : static_cast<LCRNG>(PokeRNG(seed));
+
+    // FRLGE sets the SID from the call after the frame, RS consumes SID then TID and XD/Colo skips one more call then consumes TID then SID
+    rng.advanceFrames(version & Game::GC ? frame + 1 : frame);
+    u16 high = rng.nextUShort();
+
+    for (u32 i = 0; i < count; i++, frame++)
+    {
+        u16 low = rng.nextUShort();
+
+        u16 tid, sid;
+        if (version & Game::GC)
+        {
+            tid = high;
+            sid = low;
+        }
+        else if (version & Game::RS)
+        {
+            tid = low;
+            sid = high;
+        }
+        else
+        {
+            tid = seed & 0xFFFF;
+            sid = high;
+        }
+
+        if (filter.compare(tid, sid))
+        {
+            frames.append(IDFrame3(frame, tid, sid));
+        }
+
+        high = low;
+    }
+
+    return frames;
+}
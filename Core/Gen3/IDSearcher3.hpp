@@ -0,0 +1,61 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef IDSEARCHER3_HPP
+#define IDSEARCHER3_HPP
+
+#include <QObject>
+#include <Core/Gen3/IDFrame3.hpp>
+#include <Core/Parents/IDFilter.hpp>
+#include <Core/Util/ChunkResults.hpp>
+#include <Core/Util/Game.hpp>
+#include <Core/Util/SearchProgress.hpp>
+
+class IDSearcher3 : public QObject
+{
+    Q_OBJECT
+
+signals:
+    void finished();
+    void updateProgress(const QVector<IDFrame3> &, const ProgressReport &progress);
+
+public:
+    IDSearcher3(const IDFilter &filter, u32 seed, u32 minFrame, u32 maxResults, Game version);
+    void startSearch();
+
+public slots:
+    void cancelSearch();
+
+private:
+    IDFilter filter;
+    u32 seed;
+    u32 minFrame;
+    u64 total;
+    Game version;
+    ChunkResults<IDFrame3> results;
+    bool searching, cancel;
+    int job;
+    SearchProgress progress;
+
+    void search(int chunk);
+    QVector<IDFrame3> searchFrames(u32 frame, u32 count) const;
+
+};
+
+#endif // IDSEARCHER3_HPP
@@ -17,8 +17,9 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <QtConcurrent>
+#include <QTimer>
 #include "IVSearcher3.hpp"
+#include <Core/Util/SearchScheduler.hpp>
 
 IVSearcher3::IVSearcher3(const Searcher3 &searcher, const QVector<u8> &min, const QVector<u8> &max)
 {
@@ -27,13 +28,13 @@ IVSearcher3::IVSearcher3(const Searcher3 &searcher, const QVector<u8> &min, cons
     this->max = max;
     searching = false;
     cancel = false;
-    progress = 0;
+    job = -1;
 
     connect(this, &IVSearcher3::finished, this, &IVSearcher3::deleteLater);
     connect(this, &IVSearcher3::finished, this, [ = ]
     {
         searching = false;
-        emit updateProgress(getResults(), progress);
+        emit updateProgress(results.takeAll(), progress.sample());
         QTimer::singleShot(1000, this, &IVSearcher3::deleteLater);
     });
 }
@@ -42,62 +43,79 @@ void IVSearcher3::startSearch()
 {
     if (!searching)
     {
-        progress = 0;
+        u64 total = 1;
+        for (u8 i = 0; i < 6; i++)
+        {
+            total *= max.at(i) - min.at(i) + 1;
+        }
+        progress.start(total);
         searching = true;
         cancel = false;
 
         auto *timer = new QTimer(this);
         connect(this, &IVSearcher3::finished, timer, &QTimer::stop);
-        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(getResults(), progress); });
+        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(results.take(), progress.sample()); });
         timer->start(1000);
 
-        QtConcurrent::run([ = ] { search(); });
+        int chunks = (max.at(0) - min.at(0) + 1) * (max.at(1) - min.at(1) + 1);
+        job = SearchScheduler::getInstance().submit(chunks, [ = ](int chunk) { search(chunk); }, [ = ](bool) { emit finished(); });
     }
 }
 
+StageProfile IVSearcher3::getProfile() const
+{
+    QMutexLocker locker(&mutex);
+    return profile;
+}
+
 void IVSearcher3::cancelSearch()
 {
     cancel = true;
+    SearchScheduler::getInstance().cancel(job);
+}
+
+void IVSearcher3::pauseSearch()
+{
+    SearchScheduler::getInstance().pause(job);
+}
+
+void IVSearcher3::resumeSearch()
+{
+    SearchScheduler::getInstance().resume(job);
+}
+
+void IVSearcher3::setMaxThreads(int maxThreads)
+{
+    SearchScheduler::getInstance().setMaxThreads(job, maxThreads);
 }
 
-void IVSearcher3::search()
+// Each chunk covers one HP and Atk pair with its own copy of the searcher
+void IVSearcher3::search(int chunk)
 {
-    for (u8 a = min.at(0); a <= max.at(0); a++)
+    int range = max.at(1) - min.at(1) + 1;
+    u8 a = static_cast<u8>(min.at(0) + chunk / range);
+    u8 b = static_cast<u8>(min.at(1) + chunk % range);
+
+    Searcher3 chunkSearcher(searcher);
+    QVector<Frame3> frames;
+
+    for (u8 c = min.at(2); c <= max.at(2) && !cancel; c++)
     {
-        for (u8 b = min.at(1); b <= max.at(1); b++)
+        for (u8 d = min.at(3); d <= max.at(3) && !cancel; d++)
         {
-            for (u8 c = min.at(2); c <= max.at(2); c++)
+            for (u8 e = min.at(4); e <= max.at(4) && !cancel; e++)
             {
-                for (u8 d = min.at(3); d <= max.at(3); d++)
+                for (u8 f = min.at(5); f <= max.at(5) && !cancel; f++)
                 {
-                    for (u8 e = min.at(4); e <= max.at(4); e++)
-                    {
-                        for (u8 f = min.at(5); f <= max.at(5); f++)
-                        {
-                            if (cancel)
-                            {
-                                emit finished();
-                                return;
-                            }
-
-                            auto frames = searcher.search(a, b, c, d, e, f);
-
-                            QMutexLocker locker(&mutex);
-                            results.append(frames);
-                            progress++;
-                        }
-                    }
+                    frames.append(chunkSearcher.search(a, b, c, d, e, f));
+                    progress.add();
                 }
             }
         }
     }
-    emit finished();
-}
 
-QVector<Frame3> IVSearcher3::getResults()
-{
+    results.add(chunk, frames);
+
     QMutexLocker locker(&mutex);
-    auto data(results);
-    results.clear();
-    return data;
+    profile.merge(chunkSearcher.getProfile());
 }
@@ -23,6 +23,8 @@
 #include <QObject>
 #include <QMutex>
 #include <Core/Gen3/Searcher3.hpp>
+#include <Core/Util/ChunkResults.hpp>
+#include <Core/Util/SearchProgress.hpp>
 
 class IVSearcher3 : public QObject
 {
@@ -30,25 +32,30 @@ class IVSearcher3 : public QObject
 
 signals:
     void finished();
-    void updateProgress(const QVector<Frame3> &, int progress);
+    void updateProgress(const QVector<Frame3> &, const ProgressReport &progress);
 
 public:
     IVSearcher3(const Searcher3 &searcher, const QVector<u8> &min, const QVector<u8> &max);
     void startSearch();
+    StageProfile getProfile() const;
 
 public slots:
     void cancelSearch();
+    void pauseSearch();
+    void resumeSearch();
+    void setMaxThreads(int maxThreads);
 
 private:
     Searcher3 searcher;
     QVector<u8> min, max;
-    QVector<Frame3> results;
+    ChunkResults<Frame3> results;
+    StageProfile profile;
     bool searching, cancel;
-    int progress;
-    QMutex mutex;
+    int job;
+    SearchProgress progress;
+    mutable QMutex mutex;
 
-    void search();
-    QVector<Frame3> getResults();
+    void search(int chunk);
 
 };
 
@@ -17,11 +17,8 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <QApplication>
-#include <QJsonArray>
-#include <QJsonDocument>
-#include <QSettings>
 #include "Profile3.hpp"
+#include <Core/Util/ProfileStore.hpp>
 
 Profile3::Profile3()
 {
@@ -60,80 +57,22 @@ QJsonObject Profile3::getJson() const
 
 QVector<Profile3> Profile3::loadProfileList()
 {
-    QVector<Profile3> profileList;
-
-    QSettings setting;
-    QByteArray data = setting.value("profiles").toByteArray();
-
-    QJsonObject profiles(QJsonDocument::fromJson(data).object());
-    QJsonArray gen3 = profiles["gen3"].toArray();
-
-    for (const auto &&i : gen3)
-    {
-        profileList.append(Profile3(i.toObject()));
-    }
-
-    return profileList;
+    return ProfileStore::getInstance().getProfiles3();
 }
 
 void Profile3::saveProfile() const
 {
-    QSettings setting;
-    QByteArray data = setting.value("profiles").toByteArray();
-
-    QJsonObject profiles(QJsonDocument::fromJson(data).object());
-    QJsonArray gen3 = profiles["gen3"].toArray();
-
-    gen3.append(getJson());
-    profiles["gen3"] = gen3;
-
-    setting.setValue("profiles", QJsonDocument(profiles).toJson());
+    ProfileStore::getInstance().addProfile(*this);
 }
 
 void Profile3::deleteProfile() const
 {
-    QSettings setting;
-    QByteArray data = setting.value("profiles").toByteArray();
-
-    QJsonObject profiles(QJsonDocument::fromJson(data).object());
-    QJsonArray gen3 = profiles["gen3"].toArray();
-
-    for (int i = 0; i < gen3.size(); i++)
-    {
-        Profile3 profile(gen3[i].toObject());
-
-        if (profile == *this)
-        {
-            gen3.removeAt(i);
-            profiles["gen3"] = gen3;
-
-            setting.setValue("profiles", QJsonDocument(profiles).toJson());
-            break;
-        }
-    }
+    ProfileStore::getInstance().removeProfile(*this);
 }
 
 void Profile3::updateProfile(const Profile3 &original) const
 {
-    QSettings setting;
-    QByteArray data = setting.value("profiles").toByteArray();
-
-    QJsonObject profiles(QJsonDocument::fromJson(data).object());
-    QJsonArray gen3 = profiles["gen3"].toArray();
-
-    for (auto &&i : gen3)
-    {
-        Profile3 profile(i.toObject());
-
-        if (original == profile && original != *this)
-        {
-            i = getJson();
-            profiles["gen3"] = gen3;
-
-            setting.setValue("profiles", QJsonDocument(profiles).toJson());
-            break;
-        }
-    }
+    ProfileStore::getInstance().updateProfile(original, *this);
 }
 
 bool operator==(const Profile3 &left, const Profile3 &right)
@@ -17,7 +17,6 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <QTranslator>
 #include "Searcher3.hpp"
 #include <Core/Util/EncounterSlot.hpp>
 
@@ -41,6 +40,11 @@ Searcher3::Searcher3(u16 tid, u16 sid, u8 genderRatio, const FrameCompare &compa
 
 QVector<Frame3> Searcher3::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe)
 {
+    if (!compare.compareHiddenPower(hp, atk, def, spa, spd, spe))
+    {
+        return QVector<Frame3>();
+    }
+
     switch (frameType)
     {
         case Method::Method1:
@@ -102,7 +106,7 @@ void Searcher3::setupNatureLock(int num)
 {
     shadowLock = ShadowLock(num, frameType);
     type = shadowLock.getType();
-    frame.setLockReason(QObject::tr("Pass NL"));
+    frame.setLockReason(LockReason::PassNL);
 }
 
 void Searcher3::setEncounter(const EncounterArea3 &value)
@@ -115,12 +119,8 @@ QVector<Frame3> Searcher3::searchMethodChannel(u8 hp, u8 atk, u8 def, u8 spa, u8
     QVector<Frame3> frames;
 
     frame.setIVs(hp, atk, def, spa, spd, spe);
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
 
-    QVector<u32> seeds = euclidean.recoverLower27BitsChannel(hp, atk, def, spa, spd, spe);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, euclidean.recoverLower27BitsChannel(hp, atk, def, spa, spd, spe));
     for (const auto &seed : seeds)
     {
         XDRNGR rng(seed, 3);
@@ -139,7 +139,7 @@ QVector<Frame3> Searcher3::searchMethodChannel(u8 hp, u8 atk, u8 def, u8 spa, u8
         frame.setIDs(40122, sid, 40122 ^ sid);
         frame.setPID(high, low, genderRatio);
 
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
             frame.setSeed(rng.nextUInt());
             frames.append(frame);
@@ -153,15 +153,11 @@ QVector<Frame3> Searcher3::searchMethodColo(u8 hp, u8 atk, u8 def, u8 spa, u8 sp
     QVector<Frame3> frames;
 
     frame.setIVs(hp, atk, def, spa, spd, spe);
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
 
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<QPair<u32, u32>> seeds = euclidean.recoverLower16BitsIV(first, second);
+    QVector<QPair<u32, u32>> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, euclidean.recoverLower16BitsIV(first, second));
     for (const auto &pair : seeds)
     {
         // Setup normal frame
@@ -172,8 +168,9 @@ QVector<Frame3> Searcher3::searchMethodColo(u8 hp, u8 atk, u8 def, u8 spa, u8 sp
         u16 low = rng.nextUShort();
         frame.setPID(high, low, genderRatio);
         frame.setSeed(pair.first * 0xB9B33155 + 0xA170F641);
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
+            PROFILE_SCOPE(profile, Stage::NatureLock, frames);
             switch (type)
             {
                 case ShadowType::FirstShadow:
@@ -197,8 +194,9 @@ QVector<Frame3> Searcher3::searchMethodColo(u8 hp, u8 atk, u8 def, u8 spa, u8 sp
 
         // Setup XORed frame
         frame.xorFrame(true);
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
+            PROFILE_SCOPE(profile, Stage::NatureLock, frames);
             switch (type)
             {
                 case ShadowType::FirstShadow:
@@ -226,15 +224,11 @@ QVector<Frame3> Searcher3::searchMethodH124(u8 hp, u8 atk, u8 def, u8 spa, u8 sp
     QVector<Frame3> frames;
 
     frame.setIVs(hp, atk, def, spa, spd, spe);
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
 
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     for (const auto &val : seeds)
     {
         // Setup normal frame
@@ -254,11 +248,13 @@ QVector<Frame3> Searcher3::searchMethodH124(u8 hp, u8 atk, u8 def, u8 spa, u8 sp
                 seed ^= 0x80000000;
             }
 
-            if (!compare.comparePID(frame))
+            if (!PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
             {
                 continue;
             }
 
+            PROFILE_SCOPE(profile, Stage::ReverseWalk, frames);
+
             PokeRNGR testRNG(seed);
             u32 testPID, slot;
             u16 nextRNG = seed >> 16;
@@ -419,15 +415,11 @@ QVector<Frame3> Searcher3::searchMethodXD(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
     QVector<Frame3> frames;
 
     frame.setIVs(hp, atk, def, spa, spd, spe);
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
 
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<QPair<u32, u32>> seeds = euclidean.recoverLower16BitsIV(first, second);
+    QVector<QPair<u32, u32>> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, euclidean.recoverLower16BitsIV(first, second));
     for (const auto &pair : seeds)
     {
         // Setup normal frame
@@ -437,8 +429,9 @@ QVector<Frame3> Searcher3::searchMethodXD(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
         u16 low = rng.nextUShort();
         frame.setPID(high, low, genderRatio);
         frame.setSeed(pair.first * 0xB9B33155 + 0xA170F641);
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
+            PROFILE_SCOPE(profile, Stage::NatureLock, frames);
             switch (type)
             {
                 case ShadowType::SingleLock:
@@ -458,19 +451,19 @@ QVector<Frame3> Searcher3::searchMethodXD(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
                 case ShadowType::SecondShadow:
                     if (shadowLock.firstShadowUnset(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("First shadow unset")); // Also unlikely for the other methods of encounter to pass
+                        frame.setLockReason(LockReason::FirstShadowUnset); // Also unlikely for the other methods of encounter to pass
                         frames.append(frame); // If this seed passes it is impossible for the sister spread to generate
                         continue;
                     }
                     if (shadowLock.firstShadowSet(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("First shadow set")); // Also unlikely for the other methods of encounter to pass
+                        frame.setLockReason(LockReason::FirstShadowSet); // Also unlikely for the other methods of encounter to pass
                         frames.append(frame); // If this seed passes it is impossible for the sister spread to generate
                         continue;
                     }
                     if (shadowLock.firstShadowShinySkip(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("Shiny Skip")); // Also unlikely for the other methods of encounter to pass
+                        frame.setLockReason(LockReason::ShinySkip); // Also unlikely for the other methods of encounter to pass
                         frames.append(frame); // If this seed passes it is impossible for the sister spread to generate
                         continue;
                     }
@@ -478,19 +471,19 @@ QVector<Frame3> Searcher3::searchMethodXD(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
                 case ShadowType::Salamence:
                     if (shadowLock.salamenceUnset(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("First shadow unset")); // Also unlikely for the other methods of encounter to pass
+                        frame.setLockReason(LockReason::FirstShadowUnset); // Also unlikely for the other methods of encounter to pass
                         frames.append(frame); // If this seed passes it is impossible for the sister spread to generate
                         continue;
                     }
                     if (shadowLock.salamenceSet(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("First shadow set")); // Also unlikely for the other methods of encounter to pass
+                        frame.setLockReason(LockReason::FirstShadowSet); // Also unlikely for the other methods of encounter to pass
                         frames.append(frame); // If this seed passes it is impossible for the sister spread to generate
                         continue;
                     }
                     if (shadowLock.salamenceShinySkip(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("Shiny Skip")); // Also unlikely for the other methods of encounter to pass
+                        frame.setLockReason(LockReason::ShinySkip); // Also unlikely for the other methods of encounter to pass
                         frames.append(frame); // If this seed passes it is impossible for the sister spread to generate
                         continue;
                     }
@@ -502,8 +495,9 @@ QVector<Frame3> Searcher3::searchMethodXD(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
 
         // Setup XORed frame
         frame.xorFrame(true);
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
+            PROFILE_SCOPE(profile, Stage::NatureLock, frames);
             switch (type)
             {
                 case ShadowType::SingleLock:
@@ -521,34 +515,34 @@ QVector<Frame3> Searcher3::searchMethodXD(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
                 case ShadowType::SecondShadow:
                     if (shadowLock.firstShadowUnset(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("First shadow unset"));
+                        frame.setLockReason(LockReason::FirstShadowUnset);
                         frames.append(frame);
                     }
                     else if (shadowLock.firstShadowSet(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("First shadow set"));
+                        frame.setLockReason(LockReason::FirstShadowSet);
                         frames.append(frame);
                     }
                     else if (shadowLock.firstShadowShinySkip(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("Shiny Skip"));
+                        frame.setLockReason(LockReason::ShinySkip);
                         frames.append(frame);
                     }
                     break;
                 case ShadowType::Salamence:
                     if (shadowLock.salamenceUnset(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("First shadow unset"));
+                        frame.setLockReason(LockReason::FirstShadowUnset);
                         frames.append(frame);
                     }
                     else if (shadowLock.salamenceSet(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("First shadow set"));
+                        frame.setLockReason(LockReason::FirstShadowSet);
                         frames.append(frame);
                     }
                     else if (shadowLock.salamenceShinySkip(frame.getSeed()))
                     {
-                        frame.setLockReason(QObject::tr("Shiny Skip"));
+                        frame.setLockReason(LockReason::ShinySkip);
                         frames.append(frame);
                     }
                     break;
@@ -565,15 +559,11 @@ QVector<Frame3> Searcher3::searchMethodXDColo(u8 hp, u8 atk, u8 def, u8 spa, u8
     QVector<Frame3> frames;
 
     frame.setIVs(hp, atk, def, spa, spd, spe);
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
 
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<QPair<u32, u32>> seeds = euclidean.recoverLower16BitsIV(first, second);
+    QVector<QPair<u32, u32>> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, euclidean.recoverLower16BitsIV(first, second));
     for (const auto &pair : seeds)
     {
         // Setup normal frame
@@ -583,14 +573,14 @@ QVector<Frame3> Searcher3::searchMethodXDColo(u8 hp, u8 atk, u8 def, u8 spa, u8
         u16 low = rng.nextUShort();
         frame.setPID(high, low, genderRatio);
         frame.setSeed(pair.first * 0xB9B33155 + 0xA170F641);
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
             frames.append(frame);
         }
 
         // Setup XORed frame
         frame.xorFrame(true);
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
             frames.append(frame);
         }
@@ -603,15 +593,11 @@ QVector<Frame3> Searcher3::searchMethod124(u8 hp, u8 atk, u8 def, u8 spa, u8 spd
     QVector<Frame3> frames;
 
     frame.setIVs(hp, atk, def, spa, spd, spe);
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
 
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     for (const auto &seed : seeds)
     {
         // Setup normal frame
@@ -621,14 +607,14 @@ QVector<Frame3> Searcher3::searchMethod124(u8 hp, u8 atk, u8 def, u8 spa, u8 spd
         u16 low = rng.nextUShort();
         frame.setPID(high, low, genderRatio);
         frame.setSeed(rng.nextUInt());
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
             frames.append(frame);
         }
 
         // Setup XORed frame
         frame.xorFrame(true);
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
             frames.append(frame);
         }
@@ -642,15 +628,11 @@ QVector<Frame3> Searcher3::searchMethod1Reverse(u8 hp, u8 atk, u8 def, u8 spa, u
     QVector<Frame3> frames;
 
     frame.setIVs(hp, atk, def, spa, spd, spe);
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
 
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     for (const auto &seed : seeds)
     {
         // Setup normal frame
@@ -659,14 +641,14 @@ QVector<Frame3> Searcher3::searchMethod1Reverse(u8 hp, u8 atk, u8 def, u8 spa, u
         u16 high = rng.nextUShort();
         frame.setPID(high, low, genderRatio);
         frame.setSeed(rng.nextUInt());
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
             frames.append(frame);
         }
 
         // Setup XORed frame
         frame.xorFrame(true);
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
             frames.append(frame);
         }
@@ -0,0 +1,117 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SeedToTimeCalc3.hpp"
+#include <Core/RNG/LCRNG.hpp>
+
+namespace
+{
+    // Maps the clock value 960 * (h / 10) + 60 * (h % 10) + 16 * (m / 10) + m % 10 to every minute of the day producing it
+    QVector<QVector<u16>> computeClockTable()
+    {
+        QVector<QVector<u16>> table(2190);
+        for (u16 hour = 0; hour < 24; hour++)
+        {
+            for (u16 minute = 0; minute < 60; minute++)
+            {
+                u16 value = 960 * (hour / 10) + 60 * (hour % 10) + 16 * (minute / 10) + minute % 10;
+                table[value].append(hour * 60 + minute);
+            }
+        }
+        return table;
+    }
+
+    const QVector<QVector<u16>> clockTable = computeClockTable();
+}
+
+SeedToTimeCalc3::SeedToTimeCalc3(u32 seed)
+{
+    frame = 1;
+
+    PokeRNGR rng(seed);
+    while (rng.getSeed() > 0xFFFF)
+    {
+        rng.nextUInt();
+        frame++;
+    }
+
+    this->seed = rng.getSeed();
+}
+
+u16 SeedToTimeCalc3::getSeed() const
+{
+    return seed;
+}
+
+u32 SeedToTimeCalc3::getFrame() const
+{
+    return frame;
+}
+
+// The game counts a leap year worth of days from the start of the year
+// Disable overlap for all but the last year of a range so consecutive years are not reported twice
+QVector<DateTime3> SeedToTimeCalc3::generate(u32 year, bool overlap) const
+{
+    QVector<DateTime3> results;
+
+    // For whatever reason the start date is different if the year is greater then 2000
+    QDateTime start(QDate(year == 2000 ? 2000 : 2001, 1, 1), QTime(0, 0));
+    u32 minDay = static_cast<u32>(start.date().daysTo(QDate(static_cast<int>(year), 1, 1)));
+    u32 days = overlap ? 366 : static_cast<u32>(QDate(static_cast<int>(year), 1, 1).daysInYear());
+
+    for (const auto &time : solve(minDay, minDay + days))
+    {
+        QDateTime dateTime = start.addDays(time.first).addSecs(time.second * 60);
+        results.append(DateTime3(dateTime, seed, frame));
+    }
+
+    return results;
+}
+
+// The initial seed is v = 1440 * (day + 1) + clock folded to 16 bits with (v >> 16) ^ (v & 0xFFFF)
+// Each possible upper half of v fixes the lower half, and at most two days can produce a given v
+// Returns (day, minute of day) pairs sorted by time
+QVector<QPair<u32, u16>> SeedToTimeCalc3::solve(u32 minDay, u32 maxDay) const
+{
+    QVector<QPair<u32, u16>> times;
+
+    u32 minV = 1440 * (minDay + 1);
+    u32 maxV = 1440 * maxDay + 2189;
+
+    for (u32 high = minV >> 16; high <= (maxV >> 16); high++)
+    {
+        u32 v = (high << 16) | (seed ^ high);
+        u32 day = v / 1440;
+        u32 value = v % 1440;
+
+        for (int i = 0; i < 2 && day > minDay; i++, day--, value += 1440)
+        {
+            if (day - 1 < maxDay && value < 2190)
+            {
+                for (u16 minute : clockTable.at(static_cast<int>(value)))
+                {
+                    times.append(qMakePair(day - 1, minute));
+                }
+            }
+        }
+    }
+
+    std::sort(times.begin(), times.end());
+    return times;
+}
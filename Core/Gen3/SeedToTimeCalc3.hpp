@@ -0,0 +1,43 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEEDTOTIMECALC3_HPP
+#define SEEDTOTIMECALC3_HPP
+
+#include <QVector>
+#include <Core/Gen3/DateTime3.hpp>
+
+class SeedToTimeCalc3
+{
+
+public:
+    SeedToTimeCalc3(u32 seed);
+    u16 getSeed() const;
+    u32 getFrame() const;
+    QVector<DateTime3> generate(u32 year, bool overlap = true) const;
+
+private:
+    u16 seed;
+    u32 frame;
+
+    QVector<QPair<u32, u16>> solve(u32 minDay, u32 maxDay) const;
+
+};
+
+#endif // SEEDTOTIMECALC3_HPP
@@ -0,0 +1,78 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QTimer>
+#include "SeedToTimeSearcher3.hpp"
+#include <Core/Util/SearchScheduler.hpp>
+
+SeedToTimeSearcher3::SeedToTimeSearcher3(const QVector<u32> &seeds, u32 minYear, u32 maxYear)
+{
+    this->seeds = seeds;
+    this->minYear = minYear;
+    this->maxYear = maxYear;
+    searching = false;
+    cancel = false;
+    job = -1;
+
+    connect(this, &SeedToTimeSearcher3::finished, this, [ = ]
+    {
+        searching = false;
+        emit updateProgress(results.takeAll(), progress.sample());
+        QTimer::singleShot(1000, this, &SeedToTimeSearcher3::deleteLater);
+    });
+}
+
+void SeedToTimeSearcher3::startSearch()
+{
+    if (!searching)
+    {
+        progress.start(static_cast<u64>(seeds.size()) * (maxYear - minYear + 1));
+        searching = true;
+        cancel = false;
+
+        auto *timer = new QTimer(this);
+        connect(this, &SeedToTimeSearcher3::finished, timer, &QTimer::stop);
+        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(results.take(), progress.sample()); });
+        timer->start(1000);
+
+        job = SearchScheduler::getInstance().submit(seeds.size(), [ = ](int chunk) { search(chunk); }, [ = ](bool) { emit finished(); });
+    }
+}
+
+void SeedToTimeSearcher3::cancelSearch()
+{
+    cancel = true;
+    SearchScheduler::getInstance().cancel(job);
+}
+
+// Each chunk is one seed over the year range
+void SeedToTimeSearcher3::search(int chunk)
+{
+    SeedToTimeCalc3 calc(seeds.at(chunk));
+    QVector<DateTime3> dates;
+
+    // Years are checked one at a time so cancelling stays responsive over wide ranges
+    for (u32 year = minYear; year <= maxYear && !cancel; year++)
+    {
+        dates.append(calc.generate(year, year == maxYear));
+        progress.add();
+    }
+
+    results.add(chunk, dates);
+}
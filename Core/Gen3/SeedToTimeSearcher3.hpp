@@ -0,0 +1,55 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEEDTOTIMESEARCHER3_HPP
+#define SEEDTOTIMESEARCHER3_HPP
+
+#include <QObject>
+#include <Core/Gen3/SeedToTimeCalc3.hpp>
+#include <Core/Util/ChunkResults.hpp>
+#include <Core/Util/SearchProgress.hpp>
+
+class SeedToTimeSearcher3 : public QObject
+{
+    Q_OBJECT
+
+signals:
+    void finished();
+    void updateProgress(const QVector<DateTime3> &, const ProgressReport &progress);
+
+public:
+    SeedToTimeSearcher3(const QVector<u32> &seeds, u32 minYear, u32 maxYear);
+    void startSearch();
+
+public slots:
+    void cancelSearch();
+
+private:
+    QVector<u32> seeds;
+    u32 minYear, maxYear;
+    ChunkResults<DateTime3> results;
+    bool searching, cancel;
+    int job;
+    SearchProgress progress;
+
+    void search(int chunk);
+
+};
+
+#endif // SEEDTOTIMESEARCHER3_HPP
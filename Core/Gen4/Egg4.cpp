@@ -19,6 +19,7 @@
 
 #include "Egg4.hpp"
 #include <Core/RNG/LCRNG.hpp>
+#include <Core/RNG/RNGList.hpp>
 #include <Core/RNG/MTRNG.hpp>
 
 Egg4::Egg4()
@@ -54,13 +55,13 @@ QVector<Frame4> Egg4::generate(const FrameCompare &compare) const
     switch (frameType)
     {
         case Method::Gen4Normal:
-            return generatePID(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generatePID(compare));
         case Method::Gen4Masuada:
-            return generatePIDMasuada(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generatePIDMasuada(compare));
         case Method::DPPtIVs:
-            return generateIVsDPPt(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateIVsDPPt(compare));
         case Method::HGSSIVs:
-            return generateIVsHGSS(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateIVsHGSS(compare));
         default:
             return QVector<Frame4>();
     }
@@ -124,23 +125,18 @@ QVector<Frame4> Egg4::generateIVsDPPt(const FrameCompare &compare) const
 {
     QVector<Frame4> frames;
 
-    PokeRNG rng(seed, initialFrame - 1);
-    QVector<u16> rngList(maxResults + 8);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<PokeRNG, 8> rngList(PokeRNG(seed, initialFrame - 1));
 
-    for (u32 cnt = 0; cnt < maxResults; cnt++)
+    for (u32 cnt = 0; cnt < maxResults; cnt++, rngList.advanceFrame())
     {
         Frame4 frame(tid, sid, psv);
         frame.setInitialSeed(seed);
-        frame.setInheritance(rngList.at(cnt), rngList.at(cnt + 1), rngList.at(cnt + 5), rngList.at(cnt + 6), rngList.at(cnt + 7),
-                             rngList.at(cnt + 2), rngList.at(cnt + 3), rngList.at(cnt + 4), parent1, parent2, true);
+        frame.setInheritance(rngList.at(0), rngList.at(1), rngList.at(5), rngList.at(6), rngList.at(7),
+                             rngList.at(2), rngList.at(3), rngList.at(4), parent1, parent2, true);
 
         if (compare.compareIVs(frame))
         {
-            frame.setSeed(rngList.at(cnt));
+            frame.setSeed(rngList.at(0));
             frame.setFrame(cnt + initialFrame);
             frames.append(frame);
         }
@@ -153,23 +149,18 @@ QVector<Frame4> Egg4::generateIVsHGSS(const FrameCompare &compare) const
 {
     QVector<Frame4> frames;
 
-    PokeRNG rng(seed, initialFrame - 1);
-    QVector<u16> rngList(maxResults + 8);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<PokeRNG, 8> rngList(PokeRNG(seed, initialFrame - 1));
 
-    for (u32 cnt = 0; cnt < maxResults; cnt++)
+    for (u32 cnt = 0; cnt < maxResults; cnt++, rngList.advanceFrame())
     {
         Frame4 frame(tid, sid, psv);
         frame.setInitialSeed(seed);
-        frame.setInheritance(rngList.at(cnt), rngList.at(cnt + 1), rngList.at(cnt + 5), rngList.at(cnt + 6), rngList.at(cnt + 7),
-                             rngList.at(cnt + 2), rngList.at(cnt + 3), rngList.at(cnt + 4), parent1, parent2);
+        frame.setInheritance(rngList.at(0), rngList.at(1), rngList.at(5), rngList.at(6), rngList.at(7),
+                             rngList.at(2), rngList.at(3), rngList.at(4), parent1, parent2);
 
         if (compare.compareIVs(frame))
         {
-            frame.setSeed(rngList.at(cnt));
+            frame.setSeed(rngList.at(0));
             frame.setFrame(cnt + initialFrame);
             frames.append(frame);
         }
@@ -17,8 +17,9 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <QtConcurrent>
+#include <QTimer>
 #include "EggSearcher4.hpp"
+#include <Core/Util/SearchScheduler.hpp>
 
 EggSearcher4::EggSearcher4(const Egg4 &generatorIV, const Egg4 &generatorPID, const FrameCompare &compare, u32 minDelay, u32 maxDelay, int type)
 {
@@ -30,12 +31,12 @@ EggSearcher4::EggSearcher4(const Egg4 &generatorIV, const Egg4 &generatorPID, co
     this->type = type;
     searching = false;
     cancel = false;
-    progress = 0;
+    job = -1;
 
     connect(this, &EggSearcher4::finished, this, [ = ]
     {
         searching = false;
-        emit updateProgress(getResults(), progress);
+        emit updateProgress(results.takeAll(), progress.sample());
         QTimer::singleShot(1000, this, &EggSearcher4::deleteLater);
     });
 }
@@ -44,104 +45,110 @@ void EggSearcher4::startSearch()
 {
     if (!searching)
     {
-        progress = 0;
+        progress.start(256 * 24 * (static_cast<u64>(maxDelay) - minDelay + 1));
         searching = true;
         cancel = false;
+        total = 0;
 
         auto *timer = new QTimer(this);
         connect(this, &EggSearcher4::finished, timer, &QTimer::stop);
-        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(getResults(), progress); });
+        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(results.take(), progress.sample()); });
         timer->start(1000);
 
-        QtConcurrent::run([ = ] { search(); });
+        job = SearchScheduler::getInstance().submit(256 * 24, [ = ](int chunk) { search(chunk); }, [ = ](bool) { emit finished(); });
     }
 }
 
 void EggSearcher4::cancelSearch()
 {
     cancel = true;
+    SearchScheduler::getInstance().cancel(job);
 }
 
-void EggSearcher4::search()
+void EggSearcher4::pauseSearch()
 {
-    u16 total = 0;
+    SearchScheduler::getInstance().pause(job);
+}
+
+void EggSearcher4::resumeSearch()
+{
+    SearchScheduler::getInstance().resume(job);
+}
+
+void EggSearcher4::setMaxThreads(int maxThreads)
+{
+    SearchScheduler::getInstance().setMaxThreads(job, maxThreads);
+}
+
+// Each chunk covers one seed prefix over the delay range, with its own copies of the generators
+void EggSearcher4::search(int chunk)
+{
+    u32 ab = static_cast<u32>(chunk / 24);
+    u32 cd = static_cast<u32>(chunk % 24);
+
+    Egg4 chunkIV(generatorIV);
+    Egg4 chunkPID(generatorPID);
+    QVector<Frame4> chunkFrames;
 
-    for (u16 ab = 0; ab < 256; ab++)
+    for (u32 efgh = minDelay; efgh <= maxDelay; efgh++)
     {
-        for (u8 cd = 0; cd < 24; cd++)
+        if (cancel)
         {
-            for (u32 efgh = minDelay; efgh <= maxDelay; efgh++)
-            {
-                if (cancel)
-                {
-                    emit finished();
-                    return;
-                }
+            break;
+        }
 
-                if (total > 10000)
-                {
-                    progress = static_cast<int>(256 * 24 * (maxDelay - minDelay + 1));
-                    emit finished();
-                    return;
-                }
+        if (total > 10000)
+        {
+            progress.complete();
+            SearchScheduler::getInstance().cancelCurrent();
+            break;
+        }
 
-                QVector<Frame4> frames;
-                u32 seed = ((ab << 24) | (cd << 16)) + efgh;
+        QVector<Frame4> frames;
+        u32 seed = ((ab << 24) | (cd << 16)) + efgh;
 
-                if (type == 0)
-                {
-                    generatorIV.setSeed(seed);
-                    frames = generatorIV.generate(compare);
-                }
-                else if (type == 1)
-                {
-                    generatorPID.setSeed(seed);
-                    frames = generatorPID.generate(compare);
-                }
-                else
-                {
-                    generatorIV.setSeed(seed);
-                    generatorPID.setSeed(seed);
+        if (type == 0)
+        {
+            chunkIV.setSeed(seed);
+            frames = chunkIV.generate(compare);
+        }
+        else if (type == 1)
+        {
+            chunkPID.setSeed(seed);
+            frames = chunkPID.generate(compare);
+        }
+        else
+        {
+            chunkIV.setSeed(seed);
+            chunkPID.setSeed(seed);
 
-                    auto framesIV = generatorIV.generate(compare);
-                    auto framesPID = generatorPID.generate(compare);
+            auto framesIV = chunkIV.generate(compare);
+            auto framesPID = chunkPID.generate(compare);
 
-                    if (!framesIV.isEmpty() && !framesPID.isEmpty())
+            if (!framesIV.isEmpty() && !framesPID.isEmpty())
+            {
+                for (auto framePID : framesPID)
+                {
+                    for (const auto &frameIV : framesIV)
                     {
-                        for (auto framePID : framesPID)
+                        framePID.setIVs(frameIV.getIV(0), frameIV.getIV(1), frameIV.getIV(2),
+                                        frameIV.getIV(3), frameIV.getIV(4), frameIV.getIV(5));
+                        for (u8 i = 0; i < 6; i++)
                         {
-                            for (const auto &frameIV : framesIV)
-                            {
-                                framePID.setIVs(frameIV.getIV(0), frameIV.getIV(1), frameIV.getIV(2),
-                                                frameIV.getIV(3), frameIV.getIV(4), frameIV.getIV(5));
-                                for (u8 i = 0; i < 6; i++)
-                                {
-                                    framePID.setInheritance(i, frameIV.getInheritance(i));
-                                }
-                                framePID.setEggFrame(frameIV.getFrame());
-
-                                frames.append(framePID);
-                            }
+                            framePID.setInheritance(i, frameIV.getInheritance(i));
                         }
+                        framePID.setEggFrame(frameIV.getFrame());
+
+                        frames.append(framePID);
                     }
                 }
-
-                total += frames.size();
-
-                QMutexLocker locker(&mutex);
-                results.append(frames);
-                progress++;
             }
         }
+
+        total += frames.size();
+        chunkFrames.append(frames);
+        progress.add();
     }
-    searching = false;
-    emit finished();
-}
 
-QVector<Frame4> EggSearcher4::getResults()
-{
-    QMutexLocker lock(&mutex);
-    auto data(results);
-    results.clear();
-    return data;
+    results.add(chunk, chunkFrames);
 }
@@ -20,9 +20,11 @@
 #ifndef EGGSEARCHER4_HPP
 #define EGGSEARCHER4_HPP
 
-#include <QMutex>
 #include <QObject>
+#include <atomic>
 #include <Core/Gen4/Egg4.hpp>
+#include <Core/Util/ChunkResults.hpp>
+#include <Core/Util/SearchProgress.hpp>
 
 class EggSearcher4 : public QObject
 {
@@ -30,7 +32,7 @@ class EggSearcher4 : public QObject
 
 signals:
     void finished();
-    void updateProgress(const QVector<Frame4> &, int);
+    void updateProgress(const QVector<Frame4> &, const ProgressReport &);
 
 public:
     EggSearcher4(const Egg4 &generatorIV, const Egg4 &generatorPID, const FrameCompare &compare, u32 minDelay, u32 maxDelay, int type);
@@ -38,19 +40,23 @@ public:
 
 public slots:
     void cancelSearch();
+    void pauseSearch();
+    void resumeSearch();
+    void setMaxThreads(int maxThreads);
 
 private:
     Egg4 generatorIV;
     Egg4 generatorPID;
     FrameCompare compare;
     u32 minDelay, maxDelay;
-    QMutex mutex;
-    QVector<Frame4> results;
+    ChunkResults<Frame4> results;
+    std::atomic<int> total;
     bool searching, cancel;
-    int progress, type;
+    int job;
+    SearchProgress progress;
+    int type;
 
-    void search();
-    QVector<Frame4> getResults();
+    void search(int chunk);
 
 };
 
@@ -18,385 +18,346 @@
  */
 
 #include <QFile>
+#include <QHash>
 #include "Encounters4.hpp"
 
-Encounters4::Encounters4(Encounter type, int time, const Profile4 &profile)
+namespace
 {
-    this->type = type;
-    this->time = time;
-    this->profile = profile;
-    pokemon = Pokemon::loadPersonal(4);
-}
+    // Species a profile can swap into the base slots of a location
+    struct Modifiers4
+    {
+        u16 radio[2][2]; // HGSS Hoenn and Sinnoh sound
+        u16 swarm[4]; // HGSS grass, surfing, good rod and super rod, DPPt the two grass slots
+        u16 time[2][2]; // DPPt day and night
+        u16 radar[4]; // DPPt
+        u16 dual[5][2]; // DPPt Ruby, Sapphire, Emerald, FireRed and LeafGreen
+    };
+
+    // Every area of one game, parsed once and shared by all lookups
+    struct EncounterTable4
+    {
+        QHash<int, QVector<EncounterArea4>> areas; // By encounter type
+        QVector<EncounterArea4> grass[3]; // HGSS grass for morning, day and night
+        QHash<u8, Modifiers4> modifiers; // By location
+    };
 
-QVector<EncounterArea4> Encounters4::getEncounters()
-{
-    QVector<EncounterArea4> encounters;
-    for (const auto &data : getData())
+    u16 getValue(const char *data, int offset, int length)
+    {
+        auto *bytes = reinterpret_cast<const u8 *>(data + offset);
+        return length == 1 ? bytes[0] : static_cast<u16>((bytes[0] << 8) | bytes[1]);
+    }
+
+    QVector<Slot> getSlots(const char *data, int offset, int count)
+    {
+        const QVector<Pokemon> &pokemon = Pokemon::loadPersonal(4);
+
+        QVector<Slot> encounters;
+        for (int i = 0; i < count; i++)
+        {
+            u8 min = getValue(data, offset + i * 4, 1);
+            u8 max = getValue(data, offset + 1 + i * 4, 1);
+            u16 specie = getValue(data, offset + 2 + i * 4, 2);
+            encounters.append(Slot(specie, min, max, pokemon.at(specie)));
+        }
+        return encounters;
+    }
+
+    QByteArray readTable(const QString &path)
+    {
+        QByteArray data;
+        QFile file(path);
+        if (file.open(QIODevice::ReadOnly))
+        {
+            data = file.readAll();
+            file.close();
+        }
+        return data;
+    }
+
+    EncounterTable4 parseHGSS(const QString &path)
     {
-        if (profile.getVersion() & Game::HGSS)
+        const QVector<Pokemon> &pokemon = Pokemon::loadPersonal(4);
+        QByteArray table = readTable(path);
+
+        EncounterTable4 encounters;
+        for (int offset = 0; offset + 192 <= table.size(); offset += 192)
         {
-            for (const auto &encounter : getHGSS(data))
+            const char *data = table.constData() + offset;
+            u8 location = getValue(data, 0, 1);
+
+            Modifiers4 modifiers{};
+            for (int i = 0; i < 2; i++)
             {
-                if (encounter.getType() == type)
+                modifiers.radio[0][i] = getValue(data, 88 + i * 2, 2);
+                modifiers.radio[1][i] = getValue(data, 92 + i * 2, 2);
+            }
+            for (int i = 0; i < 4; i++)
+            {
+                modifiers.swarm[i] = getValue(data, 184 + i * 2, 2);
+            }
+            encounters.modifiers.insert(location, modifiers);
+
+            if (getValue(data, 1, 1) == 1)
+            {
+                for (int t = 0; t < 3; t++)
                 {
-                    encounters.append(encounter);
+                    QVector<Slot> grass;
+                    for (int i = 0; i < 12; i++)
+                    {
+                        u8 level = getValue(data, 4 + i * 7, 1);
+                        u16 specie = getValue(data, 5 + t * 2 + i * 7, 2);
+                        grass.append(Slot(specie, level, pokemon.at(specie)));
+                    }
+                    encounters.grass[t].append(EncounterArea4(location, Encounter::Grass, grass));
                 }
             }
+            if (getValue(data, 2, 1) == 1)
+            {
+                encounters.areas[Encounter::RockSmash].append(EncounterArea4(location, Encounter::RockSmash, getSlots(data, 96, 2)));
+            }
+            if (getValue(data, 3, 1) == 1)
+            {
+                encounters.areas[Encounter::Surfing].append(EncounterArea4(location, Encounter::Surfing, getSlots(data, 104, 5)));
+                encounters.areas[Encounter::OldRod].append(EncounterArea4(location, Encounter::OldRod, getSlots(data, 124, 5)));
+                encounters.areas[Encounter::GoodRod].append(EncounterArea4(location, Encounter::GoodRod, getSlots(data, 144, 5)));
+                encounters.areas[Encounter::SuperRod].append(EncounterArea4(location, Encounter::SuperRod, getSlots(data, 164, 5)));
+            }
         }
-        else
+        return encounters;
+    }
+
+    EncounterTable4 parseDPPt(const QString &path)
+    {
+        const QVector<Pokemon> &pokemon = Pokemon::loadPersonal(4);
+        QByteArray table = readTable(path);
+
+        EncounterTable4 encounters;
+        for (int offset = 0; offset + 159 <= table.size(); offset += 159)
         {
-            for (const auto &encounter : getDPPt(data))
+            const char *data = table.constData() + offset;
+            u8 location = getValue(data, 0, 1);
+
+            Modifiers4 modifiers{};
+            for (int i = 0; i < 2; i++)
             {
-                if (encounter.getType() == type)
+                modifiers.swarm[i] = getValue(data, 39 + i * 2, 2);
+                modifiers.time[0][i] = getValue(data, 43 + i * 2, 2);
+                modifiers.time[1][i] = getValue(data, 47 + i * 2, 2);
+                for (int game = 0; game < 5; game++)
                 {
-                    encounters.append(encounter);
+                    modifiers.dual[game][i] = getValue(data, 59 + game * 4 + i * 2, 2);
                 }
             }
-        }
-    }
-
-    return encounters;
-}
+            for (int i = 0; i < 4; i++)
+            {
+                modifiers.radar[i] = getValue(data, 51 + i * 2, 2);
+            }
+            encounters.modifiers.insert(location, modifiers);
 
-QByteArrayList Encounters4::getData() const
-{
-    QString path;
-    int size;
-    switch (profile.getVersion())
-    {
-        case Game::Diamond:
-            path = ":/encounters/diamond.bin";
-            size = 159;
-            break;
-        case Game::Pearl:
-            path = ":/encounters/pearl.bin";
-            size = 159;
-            break;
-        case Game::Platinum:
-            path = ":/encounters/platinum.bin";
-            size = 159;
-            break;
-        case Game::HeartGold:
-            path = ":/encounters/heartgold.bin";
-            size = 192;
-            break;
-        case Game::SoulSilver:
-        default:
-            path = ":/encounters/soulsilver.bin";
-            size = 192;
-            break;
+            if (getValue(data, 1, 1) == 1)
+            {
+                QVector<Slot> grass;
+                for (int i = 0; i < 12; i++)
+                {
+                    u8 level = getValue(data, 3 + i * 3, 1);
+                    u16 specie = getValue(data, 4 + i * 3, 2);
+                    grass.append(Slot(specie, level, pokemon.at(specie)));
+                }
+                encounters.areas[Encounter::Grass].append(EncounterArea4(location, Encounter::Grass, grass));
+            }
+            if (getValue(data, 2, 1) == 1)
+            {
+                encounters.areas[Encounter::Surfing].append(EncounterArea4(location, Encounter::Surfing, getSlots(data, 79, 5)));
+                encounters.areas[Encounter::OldRod].append(EncounterArea4(location, Encounter::OldRod, getSlots(data, 99, 5)));
+                encounters.areas[Encounter::GoodRod].append(EncounterArea4(location, Encounter::GoodRod, getSlots(data, 119, 5)));
+                encounters.areas[Encounter::SuperRod].append(EncounterArea4(location, Encounter::SuperRod, getSlots(data, 139, 5)));
+            }
+        }
+        return encounters;
     }
 
-    QByteArray data;
-    QFile file(path);
-    if (file.open(QIODevice::ReadOnly))
+    // Each table is only parsed the first time its game is requested
+    const EncounterTable4 &getTable(Game version)
     {
-        data = file.readAll();
-        file.close();
+        switch (version)
+        {
+            case Game::Diamond:
+                {
+                    static const EncounterTable4 diamond = parseDPPt(":/encounters/diamond.bin");
+                    return diamond;
+                }
+            case Game::Pearl:
+                {
+                    static const EncounterTable4 pearl = parseDPPt(":/encounters/pearl.bin");
+                    return pearl;
+                }
+            case Game::Platinum:
+                {
+                    static const EncounterTable4 platinum = parseDPPt(":/encounters/platinum.bin");
+                    return platinum;
+                }
+            case Game::HeartGold:
+                {
+                    static const EncounterTable4 heartGold = parseHGSS(":/encounters/heartgold.bin");
+                    return heartGold;
+                }
+            case Game::SoulSilver:
+            default:
+                {
+                    static const EncounterTable4 soulSilver = parseHGSS(":/encounters/soulsilver.bin");
+                    return soulSilver;
+                }
+        }
     }
 
-    QByteArrayList encounters;
-    for (int i = 0; i < data.size(); i += size)
+    void setSlot(EncounterArea4 &area, u8 index, u16 specie)
     {
-        encounters.append(data.mid(i, size));
+        area.setSlot(index, specie, Pokemon::loadPersonal(4).at(specie));
     }
 
-    return encounters;
-}
-
-QVector<EncounterArea4> Encounters4::getHGSS(const QByteArray &data) const
-{
-    QVector<EncounterArea4> encounters;
-    u8 location = getValue(data, 0, 1);
-
-    if (getValue(data, 1, 1) == 1)
+    void modifyRadio(EncounterArea4 &area, const Modifiers4 &modifiers, int radio)
     {
-        int t;
-        if (time == 0)
-            t = 1;
-        else if (time == 1)
-            t = 3;
-        else
-            t = 5;
-
-        QVector<Slot> grass;
-        for (int i = 0; i < 12; i++)
+        if (radio == 1 || radio == 2)
         {
-            u8 level = getValue(data, 4 + i * 7, 1);
-            u16 specie = getValue(data, 4 + t + i * 7, 2);
-            grass.append(Slot(specie, level, pokemon.at(specie)));
+            const u16 *species = modifiers.radio[radio - 1];
+            setSlot(area, 2, species[0]);
+            setSlot(area, 3, species[0]);
+            setSlot(area, 4, species[1]);
+            setSlot(area, 5, species[1]);
         }
-
-        modifyRadio(grass, data);
-        modifySwarmHGSS(grass, data);
-
-        encounters.append(EncounterArea4(location, Encounter::Grass, grass));
     }
-    if (getValue(data, 2, 1) == 1)
+
+    void modifySwarmHGSS(EncounterArea4 &area, const Modifiers4 &modifiers, Encounter type)
     {
-        QVector<Slot> rock;
-        for (int i = 0; i < 2; i++)
+        u16 specie;
+        if (type == Encounter::Grass)
         {
-            u8 min = getValue(data, 96 + i * 4, 1);
-            u8 max = getValue(data, 97 + i * 4, 1);
-            u16 specie = getValue(data, 98 + i * 4, 2);
-            rock.append(Slot(specie, min, max, pokemon.at(specie)));
+            specie = modifiers.swarm[0];
         }
-        encounters.append(EncounterArea4(location, Encounter::RockSmash, rock));
-    }
-    if (getValue(data, 3, 1) == 1)
-    {
-        QVector<Slot> surf;
-        for (int i = 0; i < 5; i++)
+        else if (type == Encounter::Surfing)
         {
-            u8 min = getValue(data, 104 + i * 4, 1);
-            u8 max = getValue(data, 105 + i * 4, 1);
-            u16 specie = getValue(data, 106 + i * 4, 2);
-            surf.append(Slot(specie, min, max, pokemon.at(specie)));
+            specie = modifiers.swarm[1];
         }
-        modifySwarmHGSS(surf, data);
-        encounters.append(EncounterArea4(location, Encounter::Surfing, surf));
-
-        QVector<Slot> old;
-        for (int i = 0; i < 5; i++)
+        else if (type == Encounter::GoodRod)
         {
-            u8 min = getValue(data, 124 + i * 4, 1);
-            u8 max = getValue(data, 125 + i * 4, 1);
-            u16 specie = getValue(data, 126 + i * 4, 2);
-            old.append(Slot(specie, min, max, pokemon.at(specie)));
+            specie = modifiers.swarm[2];
         }
-        encounters.append(EncounterArea4(location, Encounter::OldRod, old));
-
-        QVector<Slot> good;
-        for (int i = 0; i < 5; i++)
+        else if (type == Encounter::SuperRod)
         {
-            u8 min = getValue(data, 144 + i * 4, 1);
-            u8 max = getValue(data, 145 + i * 4, 1);
-            u16 specie = getValue(data, 146 + i * 4, 2);
-            good.append(Slot(specie, min, max, pokemon.at(specie)));
+            specie = modifiers.swarm[3];
         }
-        modifySwarmHGSS(good, data);
-        encounters.append(EncounterArea4(location, Encounter::GoodRod, good));
-
-        QVector<Slot> super;
-        for (int i = 0; i < 5; i++)
+        else
         {
-            u8 min = getValue(data, 164 + i * 4, 1);
-            u8 max = getValue(data, 165 + i * 4, 1);
-            u16 specie = getValue(data, 166 + i * 4, 2);
-            super.append(Slot(specie, min, max, pokemon.at(specie)));
+            return;
         }
-        modifySwarmHGSS(super, data);
-        encounters.append(EncounterArea4(location, Encounter::SuperRod, super));
-    }
-    return encounters;
-}
 
-QVector<EncounterArea4> Encounters4::getDPPt(const QByteArray &data) const
-{
-    QVector<EncounterArea4> encounters;
-    u8 location = getValue(data, 0, 1);
+        setSlot(area, 0, specie);
+        setSlot(area, 1, specie);
+    }
 
-    if (getValue(data, 1, 1) == 1)
+    void modifyTime(EncounterArea4 &area, const Modifiers4 &modifiers, int time)
     {
-        QVector<Slot> grass;
-        for (int i = 0; i < 12; i++)
+        if (time == 1 || time == 2)
         {
-            u8 level = getValue(data, 3 + i * 3, 1);
-            u16 specie = getValue(data, 4 + i * 3, 2);
-            grass.append(Slot(specie, level, pokemon.at(specie)));
+            setSlot(area, 2, modifiers.time[time - 1][0]);
+            setSlot(area, 3, modifiers.time[time - 1][1]);
         }
-
-        modifyTime(grass, data);
-        modifyDual(grass, data);
-        modifyRadar(grass, data);
-        modifySwarmDPPt(grass, data);
-
-        encounters.append(EncounterArea4(location, Encounter::Grass, grass));
     }
-    if (getValue(data, 2, 1) == 1)
-    {
-        QVector<Slot> surf;
-        for (int i = 0; i < 5; i++)
-        {
-            u8 min = getValue(data, 79 + i * 4, 1);
-            u8 max = getValue(data, 80 + i * 4, 1);
-            u16 specie = getValue(data, 81 + i * 4, 2);
-            surf.append(Slot(specie, min, max, pokemon.at(specie)));
-        }
-        encounters.append(EncounterArea4(location, Encounter::Surfing, surf));
-
-        QVector<Slot> old;
-        for (int i = 0; i < 5; i++)
-        {
-            u8 min = getValue(data, 99 + i * 4, 1);
-            u8 max = getValue(data, 100 + i * 4, 1);
-            u16 specie = getValue(data, 101 + i * 4, 2);
-            old.append(Slot(specie, min, max, pokemon.at(specie)));
-        }
-        encounters.append(EncounterArea4(location, Encounter::OldRod, old));
 
-        QVector<Slot> good;
-        for (int i = 0; i < 5; i++)
+    void modifyDual(EncounterArea4 &area, const Modifiers4 &modifiers, Game dual)
+    {
+        int game;
+        switch (dual)
         {
-            u8 min = getValue(data, 119 + i * 4, 1);
-            u8 max = getValue(data, 120 + i * 4, 1);
-            u16 specie = getValue(data, 121 + i * 4, 2);
-            good.append(Slot(specie, min, max, pokemon.at(specie)));
+            case Game::Ruby:
+                game = 0;
+                break;
+            case Game::Sapphire:
+                game = 1;
+                break;
+            case Game::Emerald:
+                game = 2;
+                break;
+            case Game::FireRed:
+                game = 3;
+                break;
+            case Game::LeafGreen:
+                game = 4;
+                break;
+            default:
+                return;
         }
-        encounters.append(EncounterArea4(location, Encounter::GoodRod, good));
 
-        QVector<Slot> super;
-        for (int i = 0; i < 5; i++)
-        {
-            u8 min = getValue(data, 139 + i * 4, 1);
-            u8 max = getValue(data, 140 + i * 4, 1);
-            u16 specie = getValue(data, 141 + i * 4, 2);
-            super.append(Slot(specie, min, max, pokemon.at(specie)));
-        }
-        encounters.append(EncounterArea4(location, Encounter::SuperRod, super));
+        setSlot(area, 8, modifiers.dual[game][0]);
+        setSlot(area, 9, modifiers.dual[game][1]);
     }
-    return encounters;
-}
 
-void Encounters4::modifyRadio(QVector<Slot> &mons, const QByteArray &data) const
-{
-    u16 specie1, specie2;
-    if (profile.getRadio() == 1)
-    {
-        specie1 = getValue(data, 88, 2);
-        specie2 = getValue(data, 90, 2);
-    }
-    else if (profile.getRadio() == 2)
+    void modifyRadar(EncounterArea4 &area, const Modifiers4 &modifiers)
     {
-        specie1 = getValue(data, 92, 2);
-        specie2 = getValue(data, 94, 2);
+        setSlot(area, 4, modifiers.radar[0]);
+        setSlot(area, 5, modifiers.radar[1]);
+        setSlot(area, 10, modifiers.radar[2]);
+        setSlot(area, 11, modifiers.radar[3]);
     }
-    else
+
+    void modifySwarmDPPt(EncounterArea4 &area, const Modifiers4 &modifiers)
     {
-        return;
+        setSlot(area, 0, modifiers.swarm[0]);
+        setSlot(area, 1, modifiers.swarm[1]);
     }
-
-    mons[2].setSpecie(specie1, pokemon.at(specie1));
-    mons[3].setSpecie(specie1, pokemon.at(specie1));
-    mons[4].setSpecie(specie2, pokemon.at(specie2));
-    mons[5].setSpecie(specie2, pokemon.at(specie2));
 }
 
-void Encounters4::modifyTime(QVector<Slot> &slot, const QByteArray &data) const
+Encounters4::Encounters4(Encounter type, int time, const Profile4 &profile)
 {
-    u16 specie1, specie2;
-    if (time == 1)
-    {
-        specie1 = getValue(data, 43, 2);
-        specie2 = getValue(data, 45, 2);
-    }
-    else if (time == 2)
-    {
-        specie1 = getValue(data, 47, 2);
-        specie2 = getValue(data, 49, 2);
-    }
-    else
-    {
-        return;
-    }
-
-    slot[2].setSpecie(specie1, pokemon.at(specie1));
-    slot[3].setSpecie(specie2, pokemon.at(specie2));
+    this->type = type;
+    this->time = time;
+    this->profile = profile;
 }
 
-void Encounters4::modifyDual(QVector<Slot> &mons, const QByteArray &data) const
+// The stored areas are shared, only the areas a profile modifies get copied
+QVector<EncounterArea4> Encounters4::getEncounters() const
 {
-    Game dual = profile.getDualSlot();
-    u16 specie1, specie2;
-    if (dual == Game::Ruby)
-    {
-        specie1 = getValue(data, 59, 2);
-        specie2 = getValue(data, 61, 2);
-    }
-    else if (dual == Game::Sapphire)
-    {
-        specie1 = getValue(data, 63, 2);
-        specie2 = getValue(data, 65, 2);
-    }
-    else if (dual == Game::Emerald)
-    {
-        specie1 = getValue(data, 67, 2);
-        specie2 = getValue(data, 69, 2);
-    }
-    else if (dual == Game::FireRed)
-    {
-        specie1 = getValue(data, 71, 2);
-        specie2 = getValue(data, 73, 2);
-    }
-    else if (dual == Game::LeafGreen)
+    const EncounterTable4 &table = getTable(profile.getVersion());
+    bool hgss = profile.getVersion() & Game::HGSS;
+
+    QVector<EncounterArea4> encounters;
+    if (hgss && type == Encounter::Grass)
     {
-        specie1 = getValue(data, 75, 2);
-        specie2 = getValue(data, 77, 2);
+        encounters = table.grass[time == 0 ? 0 : time == 1 ? 1 : 2];
     }
     else
     {
-        return;
-    }
-
-    mons[8].setSpecie(specie1, pokemon.at(specie1));
-    mons[9].setSpecie(specie2, pokemon.at(specie2));
-}
-
-void Encounters4::modifyRadar(QVector<Slot> &mons, const QByteArray &data) const
-{
-    if (profile.getRadar())
-    {
-        QVector<u16> species = { getValue(data, 51, 2), getValue(data, 53, 2), getValue(data, 55, 2), getValue(data, 57, 2) };
-        mons[4].setSpecie(species.at(0), pokemon.at(species.at(0)));
-        mons[5].setSpecie(species.at(1), pokemon.at(species.at(1)));
-        mons[10].setSpecie(species.at(2), pokemon.at(species.at(2)));
-        mons[11].setSpecie(species.at(3), pokemon.at(species.at(3)));
+        encounters = table.areas.value(type);
     }
-}
 
-void Encounters4::modifySwarmHGSS(QVector<Slot> &mons, const QByteArray &data) const
-{
-    if (profile.getSwarm())
+    for (auto &area : encounters)
     {
-        u16 specie;
-        if (type == Encounter::Grass)
-        {
-            specie = getValue(data, 184, 2);
-        }
-        else if (type == Encounter::Surfing)
-        {
-            specie = getValue(data, 186, 2);
-        }
-        else if (type == Encounter::GoodRod)
+        const Modifiers4 &modifiers = *table.modifiers.constFind(area.getLocation());
+        if (hgss)
         {
-            specie = getValue(data, 188, 2);
-        }
-        else if (type == Encounter::SuperRod)
-        {
-            specie = getValue(data, 190, 2);
+            if (type == Encounter::Grass)
+            {
+                modifyRadio(area, modifiers, profile.getRadio());
+            }
+            if (profile.getSwarm())
+            {
+                modifySwarmHGSS(area, modifiers, type);
+            }
         }
-        else
+        else if (type == Encounter::Grass)
         {
-            return;
+            modifyTime(area, modifiers, time);
+            modifyDual(area, modifiers, profile.getDualSlot());
+            if (profile.getRadar())
+            {
+                modifyRadar(area, modifiers);
+            }
+            if (profile.getSwarm())
+            {
+                modifySwarmDPPt(area, modifiers);
+            }
         }
-
-        mons[0].setSpecie(specie, pokemon.at(specie));
-        mons[1].setSpecie(specie, pokemon.at(specie));
     }
-}
 
-void Encounters4::modifySwarmDPPt(QVector<Slot> &mons, const QByteArray &data) const
-{
-    if (profile.getSwarm())
-    {
-        QVector<u16> species = { getValue(data, 39, 2), getValue(data, 41, 2) };
-        mons[0].setSpecie(species.at(0), pokemon.at(species.at(0)));
-        mons[1].setSpecie(species.at(1), pokemon.at(species.at(1)));
-    }
-}
-
-u16 Encounters4::getValue(const QByteArray &data, int offset, int length) const
-{
-    return data.mid(offset, length).toHex().toUShort(nullptr, 16);
+    return encounters;
 }
@@ -28,7 +28,7 @@ class Encounters4
 
 public:
     Encounters4(Encounter type, int time, const Profile4 &profile);
-    QVector<EncounterArea4> getEncounters();
+    QVector<EncounterArea4> getEncounters() const;
 
 private:
     Profile4 profile;
@@ -36,18 +36,6 @@ private:
     int time; // 0: Morning, 1: Day, 2: Night
     // Dual is used in DPPt
     // Radio 0: None, 1: Hoenn, 2: Sinnoh, For HGSS
-    QVector<Pokemon> pokemon;
-
-    QByteArrayList getData() const;
-    QVector<EncounterArea4> getHGSS(const QByteArray &data) const;
-    QVector<EncounterArea4> getDPPt(const QByteArray &data) const;
-    void modifyRadio(QVector<Slot> &mons, const QByteArray &data) const;
-    void modifyTime(QVector<Slot> &mons, const QByteArray &data) const;
-    void modifyDual(QVector<Slot> &mons, const QByteArray &data) const;
-    void modifyRadar(QVector<Slot> &mons, const QByteArray &data) const;
-    void modifySwarmHGSS(QVector<Slot> &mons, const QByteArray &data) const;
-    void modifySwarmDPPt(QVector<Slot> &mons, const QByteArray &data) const;
-    u16 getValue(const QByteArray &data, int offset, int length) const;
 
 };
 
@@ -17,9 +17,44 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <QMutex>
 #include <QTranslator>
 #include "Frame4.hpp"
 
+namespace
+{
+    QMutex mutex;
+    QStringList pitches; // All 100 pitches in the current language
+
+    QString formatPitch(u8 val)
+    {
+        QString pitch;
+
+        if (val < 20)
+        {
+            pitch = QObject::tr("Low");
+        }
+        else if (val < 40)
+        {
+            pitch = QObject::tr("Mid-Low");
+        }
+        else if (val < 60)
+        {
+            pitch = QObject::tr("Mid");
+        }
+        else if (val < 80)
+        {
+            pitch = QObject::tr("Mid-High");
+        }
+        else
+        {
+            pitch = QObject::tr("High");
+        }
+
+        return pitch + " (" + QString::number(val) + ")";
+    }
+}
+
 Frame4::Frame4()
 {
     tid = 12345;
@@ -36,49 +71,44 @@ Frame4::Frame4(u16 tid, u16 sid, u16 psv)
 
 void Frame4::setInheritance(u16 iv1, u16 iv2, u16 par1, u16 par2, u16 par3, u16 inh1, u16 inh2, u16 inh3, const QVector<u8> &parent1, const QVector<u8> &parent2, bool broken)
 {
-    ivs[0] = iv1 & 0x1f;
-    ivs[1] = (iv1 >> 5) & 0x1f;
-    ivs[2] = (iv1 >> 10) & 0x1f;
-    ivs[3] = (iv2 >> 5) & 0x1f;
-    ivs[4] = (iv2 >> 10) & 0x1f;
-    ivs[5] = iv2 & 0x1f;
+    setIVs(iv1, iv2);
 
-    QVector<u8> available =  { 0, 1, 2, 3, 4, 5 };
-    QVector<u16> val = { inh1, inh2, inh3, par1, par2, par3 };
+    u8 available[6] = { 0, 1, 2, 3, 4, 5 };
+    u16 val[6] = { inh1, inh2, inh3, par1, par2, par3 };
 
     for (u8 cnt = 0; cnt < 3; cnt++)
     {
         // Decide which parent (1 or 2) from which we'll pick an IV
-        u8 par = val.at(cnt + 3) & 1;
+        u8 par = val[cnt + 3] & 1;
 
         // Decide which stat to pick for IV inheritance
-        u8 ivslot = available.at(val.at(cnt) % (6 - cnt));
+        u8 ivslot = available[val[cnt] % (6 - cnt)];
 
         switch (ivslot)
         {
             case 0:
-                ivs[0] = par == 0 ? parent1.at(0) : parent2.at(0);
-                inheritance[0] = par == 0 ? 'A' : 'B';
+                setIV(0, par == 0 ? parent1.at(0) : parent2.at(0));
+                setInheritance(0, par == 0 ? 'A' : 'B');
                 break;
             case 1:
-                ivs[1] = par == 0 ? parent1.at(1) : parent2.at(1);
-                inheritance[1] = par == 0 ? 'A' : 'B';
+                setIV(1, par == 0 ? parent1.at(1) : parent2.at(1));
+                setInheritance(1, par == 0 ? 'A' : 'B');
                 break;
             case 2:
-                ivs[2] = par == 0 ? parent1.at(2) : parent2.at(2);
-                inheritance[2] = par == 0 ? 'A' : 'B';
+                setIV(2, par == 0 ? parent1.at(2) : parent2.at(2));
+                setInheritance(2, par == 0 ? 'A' : 'B');
                 break;
             case 3:
-                ivs[5] = par == 0 ? parent1.at(5) : parent2.at(5);
-                inheritance[5] = par == 0 ? 'A' : 'B';
+                setIV(5, par == 0 ? parent1.at(5) : parent2.at(5));
+                setInheritance(5, par == 0 ? 'A' : 'B');
                 break;
             case 4:
-                ivs[3] = par == 0 ? parent1.at(3) : parent2.at(3);
-                inheritance[3] = par == 0 ? 'A' : 'B';
+                setIV(3, par == 0 ? parent1.at(3) : parent2.at(3));
+                setInheritance(3, par == 0 ? 'A' : 'B');
                 break;
             case 5:
-                ivs[4] = par == 0 ? parent1.at(4) : parent2.at(4);
-                inheritance[4] = par == 0 ? 'A' : 'B';
+                setIV(4, par == 0 ? parent1.at(4) : parent2.at(4));
+                setInheritance(4, par == 0 ? 'A' : 'B');
                 break;
         }
 
@@ -86,7 +116,7 @@ void Frame4::setInheritance(u16 iv1, u16 iv2, u16 par1, u16 par2, u16 par3, u16
         // In DPPt this doesn't work properly
         for (u8 i = broken ? cnt : ivslot; i < 5 - cnt; i++)
         {
-            available[i] = available.at(i + 1);
+            available[i] = available[i + 1];
         }
     }
 
@@ -94,11 +124,6 @@ void Frame4::setInheritance(u16 iv1, u16 iv2, u16 par1, u16 par2, u16 par3, u16
     calculatePower();
 }
 
-void Frame4::setInheritance(int index, QChar value)
-{
-    inheritance[index] = value;
-}
-
 void Frame4::setPID(u32 pid, u16 genderRatio)
 {
     this->pid = pid;
@@ -120,37 +145,26 @@ void Frame4::setPID(u16 high, u16 low, u16 genderRatio)
 QString Frame4::getCall() const
 {
     u8 val = seed % 3;
-    return val == 0 ? "E" : val == 1 ? "K" : "P";
+    return val == 0 ? QStringLiteral("E") : val == 1 ? QStringLiteral("K") : QStringLiteral("P");
 }
 
 QString Frame4::chatotPitch() const
 {
-    u8 val = ((seed & 0x1FFF) * 100) >> 13;
-    QString pitch;
-
-    if (val < 20)
-    {
-        pitch = QObject::tr("Low");
-    }
-    else if (val < 40)
-    {
-        pitch = QObject::tr("Mid-Low");
-    }
-    else if (val < 60)
+    QMutexLocker locker(&mutex);
+    if (pitches.isEmpty())
     {
-        pitch = QObject::tr("Mid");
-    }
-    else if (val < 80)
-    {
-        pitch = QObject::tr("Mid-High");
-    }
-    else
-    {
-        pitch = QObject::tr("High");
+        for (u8 val = 0; val < 100; val++)
+        {
+            pitches.append(formatPitch(val));
+        }
     }
+    return pitches.at(((seed & 0x1FFF) * 100) >> 13);
+}
 
-    pitch = pitch + " (" + QString::number(val) + ")";
-    return pitch;
+void Frame4::clearPitches()
+{
+    QMutexLocker locker(&mutex);
+    pitches.clear();
 }
 
 u32 Frame4::getInitialSeed() const
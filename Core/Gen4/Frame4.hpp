@@ -28,13 +28,14 @@ class Frame4 : public Frame
 public:
     Frame4();
     Frame4(u16 tid, u16 sid, u16 psv);
+    using Frame::setInheritance;
     void setInheritance(u16 iv1, u16 iv2, u16 par1, u16 par2, u16 par3, u16 inh1, u16 inh2,
                         u16 inh3, const QVector<u8> &parent1, const QVector<u8> &parent2, bool broken = false);
-    void setInheritance(int index, QChar value);
     void setPID(u32 pid, u16 genderRatio);
     void setPID(u16 high, u16 low, u16 genderRatio);
     QString getCall() const;
     QString chatotPitch() const;
+    static void clearPitches();
     u32 getInitialSeed() const;
     void setInitialSeed(const u32 &value);
     u32 getSeed() const;
@@ -53,4 +54,6 @@ private:
 
 };
 
+Q_DECLARE_TYPEINFO(Frame4, Q_MOVABLE_TYPE);
+
 #endif // FRAME4_HPP
@@ -0,0 +1,592 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Frame4Columns.hpp"
+
+Searcher4Columns::Searcher4Columns(Method method, bool stationary)
+{
+    this->method = method;
+    this->stationary = stationary;
+}
+
+int Searcher4Columns::getColumnCount() const
+{
+    switch (method)
+    {
+        case Method::Method1:
+        case Method::ChainedShiny:
+            return 15;
+        case Method::WondercardIVs:
+            return 10;
+        case Method::MethodJ:
+        case Method::MethodK:
+            return stationary ? 16 : 18;
+        default:
+            return 0;
+    }
+}
+
+QStringList Searcher4Columns::getHeader() const
+{
+    switch (method)
+    {
+        case Method::Method1:
+        case Method::ChainedShiny:
+            return
+            {
+                tr("Seed"), tr("Frame"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"),
+                tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
+            };
+        case Method::WondercardIVs:
+            return
+            {
+                tr("Seed"), tr("Frame"), tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power")
+            };
+        case Method::MethodJ:
+        case Method::MethodK:
+            if (stationary)
+            {
+                return
+                {
+                    tr("Seed"), tr("Frame"), tr("Lead"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"),
+                    tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
+                };
+            }
+            return
+            {
+                tr("Seed"), tr("Frame"), tr("Lead"), tr("PID"), tr("Slot"), tr("Level"), "!!!", tr("Nature"), tr("Ability"),
+                tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
+            };
+        default:
+            return QStringList();
+    }
+}
+
+QVariant Searcher4Columns::getData(const Frame4 &frame, int column) const
+{
+    switch (method)
+    {
+        case Method::WondercardIVs:
+            switch (column)
+            {
+                case 0:
+                    return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
+                case 1:
+                    return frame.getFrame();
+                case 2:
+                    return frame.getIV(0);
+                case 3:
+                    return frame.getIV(1);
+                case 4:
+                    return frame.getIV(2);
+                case 5:
+                    return frame.getIV(3);
+                case 6:
+                    return frame.getIV(4);
+                case 7:
+                    return frame.getIV(5);
+                case 8:
+                    return frame.getPowerString();
+                case 9:
+                    return frame.getPower();
+            }
+            break;
+        case Method::Method1:
+        case Method::ChainedShiny:
+            switch (column)
+            {
+                case 0:
+                    return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
+                case 1:
+                    return frame.getFrame();
+                case 2:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 3:
+                    return frame.getShinyString();
+                case 4:
+                    return frame.getNatureString();
+                case 5:
+                    return frame.getAbility();
+                case 6:
+                    return frame.getIV(0);
+                case 7:
+                    return frame.getIV(1);
+                case 8:
+                    return frame.getIV(2);
+                case 9:
+                    return frame.getIV(3);
+                case 10:
+                    return frame.getIV(4);
+                case 11:
+                    return frame.getIV(5);
+                case 12:
+                    return frame.getPowerString();
+                case 13:
+                    return frame.getPower();
+                case 14:
+                    return frame.getGenderString();
+
+            }
+            break;
+        case Method::MethodJ:
+        case Method::MethodK:
+            switch (column)
+            {
+                case 0:
+                    return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
+                case 1:
+                    return frame.getFrame();
+                case 2:
+                    switch (frame.getLeadType())
+                    {
+                        case Lead::None:
+                            return tr("None");
+                        case Lead::Synchronize:
+                            return tr("Synchronize");
+                        case Lead::SuctionCups:
+                            return tr("Suction Cups");
+                        case Lead::CuteCharmFemale:
+                            return tr("Cute Charm (♀)");
+                        case Lead::CuteCharm25M:
+                            return tr("Cute Charm (25% ♂)");
+                        case Lead::CuteCharm50M:
+                            return tr("Cute Charm (50% ♂)");
+                        case Lead::CuteCharm75M:
+                            return tr("Cute Charm (75% ♂)");
+                        case Lead::CuteCharm875M:
+                        default:
+                            return tr("Cute Charm (87.5% ♂)");
+                    }
+                case 3:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 4:
+                    if (stationary) return frame.getShinyString();
+                    return frame.getEncounterSlot();
+                case 5:
+                    if (stationary) return frame.getNatureString();
+                    return frame.getLevel();
+                case 6:
+                    if (stationary) return frame.getAbility();
+                    return frame.getShinyString();
+                case 7:
+                    if (stationary) return frame.getIV(0);
+                    return frame.getNatureString();
+                case 8:
+                    if (stationary) return frame.getIV(1);
+                    return frame.getAbility();
+                case 9:
+                    if (stationary) return frame.getIV(2);
+                    return frame.getIV(0);
+                case 10:
+                    if (stationary) return frame.getIV(3);
+                    return frame.getIV(1);
+                case 11:
+                    if (stationary) return frame.getIV(4);
+                    return frame.getIV(2);
+                case 12:
+                    if (stationary) return frame.getIV(5);
+                    return frame.getIV(3);
+                case 13:
+                    if (stationary) return frame.getPowerString();
+                    return frame.getIV(4);
+                case 14:
+                    if (stationary) return frame.getPower();
+                    return frame.getIV(5);
+                case 15:
+                    if (stationary) return frame.getGenderString();
+                    return frame.getPowerString();
+                case 16:
+                    return frame.getPower();
+                case 17:
+                    return frame.getGenderString();
+            }
+            break;
+        default:
+            break;
+    }
+    return QVariant();
+}
+
+Stationary4Columns::Stationary4Columns(Method method)
+{
+    this->method = method;
+}
+
+int Stationary4Columns::getColumnCount() const
+{
+    switch (method)
+    {
+        case Method::Method1:
+        case Method::MethodK:
+            return 16;
+        case Method::MethodJ:
+            return 15;
+        case Method::WondercardIVs:
+            return 11;
+        default:
+            return 0;
+    }
+}
+
+QStringList Stationary4Columns::getHeader() const
+{
+    switch (method)
+    {
+        case Method::Method1:
+            return
+            {
+                tr("Frame"), tr("Call"), tr("Chatot"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"),
+                tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
+            };
+        case Method::MethodJ:
+            return
+            {
+                tr("Frame"), tr("Chatot"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"),
+                tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
+            };
+        case Method::MethodK:
+            return
+            {
+                tr("Frame"), tr("Call"), tr("Chatot"), tr("PID"), "!!!", tr("Nature"), tr("Ability"),
+                tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
+            };
+        case Method::WondercardIVs:
+            return
+            {
+                tr("Frame"), tr("Call"), tr("Chatot"), tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power")
+            };
+        default:
+            return QStringList();
+    }
+}
+
+QVariant Stationary4Columns::getData(const Frame4 &frame, int column) const
+{
+    switch (method)
+    {
+        case Method::Method1:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.getCall();
+                case 2:
+                    return frame.chatotPitch();
+                case 3:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 4:
+                    return frame.getShinyString();
+                case 5:
+                    return frame.getNatureString();
+                case 6:
+                    return frame.getAbility();
+                case 7:
+                    return frame.getIV(0);
+                case 8:
+                    return frame.getIV(1);
+                case 9:
+                    return frame.getIV(2);
+                case 10:
+                    return frame.getIV(3);
+                case 11:
+                    return frame.getIV(4);
+                case 12:
+                    return frame.getIV(5);
+                case 13:
+                    return frame.getPowerString();
+                case 14:
+                    return frame.getPower();
+                case 15:
+                    return frame.getGenderString();
+            }
+        case Method::MethodJ:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.chatotPitch();
+                case 2:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 3:
+                    return frame.getShinyString();
+                case 4:
+                    return frame.getNatureString();
+                case 5:
+                    return frame.getAbility();
+                case 6:
+                    return frame.getIV(0);
+                case 7:
+                    return frame.getIV(1);
+                case 8:
+                    return frame.getIV(2);
+                case 9:
+                    return frame.getIV(3);
+                case 10:
+                    return frame.getIV(4);
+                case 11:
+                    return frame.getIV(5);
+                case 12:
+                    return frame.getPowerString();
+                case 13:
+                    return frame.getPower();
+                case 14:
+                    return frame.getGenderString();
+            }
+        case Method::MethodK:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.getCall();
+                case 2:
+                    return frame.chatotPitch();
+                case 3:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 4:
+                    return frame.getShinyString();
+                case 5:
+                    return frame.getNatureString();
+                case 6:
+                    return frame.getAbility();
+                case 7:
+                    return frame.getIV(0);
+                case 8:
+                    return frame.getIV(1);
+                case 9:
+                    return frame.getIV(2);
+                case 10:
+                    return frame.getIV(3);
+                case 11:
+                    return frame.getIV(4);
+                case 12:
+                    return frame.getIV(5);
+                case 13:
+                    return frame.getPowerString();
+                case 14:
+                    return frame.getPower();
+                case 15:
+                    return frame.getGenderString();
+            }
+        case Method::WondercardIVs:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.getCall();
+                case 2:
+                    return frame.chatotPitch();
+                case 3:
+                    return frame.getIV(0);
+                case 4:
+                    return frame.getIV(1);
+                case 5:
+                    return frame.getIV(2);
+                case 6:
+                    return frame.getIV(3);
+                case 7:
+                    return frame.getIV(4);
+                case 8:
+                    return frame.getIV(5);
+                case 9:
+                    return frame.getPowerString();
+                case 10:
+                    return frame.getPower();
+            }
+        default:
+            break;
+    }
+    return QVariant();
+}
+
+Wild4Columns::Wild4Columns(Method method)
+{
+    this->method = method;
+}
+
+int Wild4Columns::getColumnCount() const
+{
+    switch (method)
+    {
+        case Method::MethodJ:
+            return 18;
+        case Method::MethodK:
+            return 19;
+        case Method::ChainedShiny:
+            return 15;
+        default:
+            return 0;
+    }
+}
+
+QStringList Wild4Columns::getHeader() const
+{
+    switch (method)
+    {
+        case Method::MethodJ:
+            return
+            {
+                tr("Frame"), tr("Occidentary"), tr("Chatot"), tr("Slot"), tr("Level"), tr("PID"), "!!!", tr("Nature"), tr("Ability"),
+                tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
+            };
+        case Method::MethodK:
+            return
+            {
+                tr("Frame"), tr("Occidentary"), tr("Call"), tr("Chatot"), tr("Slot"), tr("Level"), tr("PID"), "!!!", tr("Nature"),
+                tr("Ability"), tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
+            };
+        case Method::ChainedShiny:
+            return
+            {
+                tr("Frame"), tr("Chatot"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"), tr("Atk"),
+                tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
+            };
+        default:
+            return QStringList();
+    }
+}
+
+QVariant Wild4Columns::getData(const Frame4 &frame, int column) const
+{
+    switch (method)
+    {
+        case Method::MethodJ:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.getOccidentary();
+                case 2:
+                    return frame.chatotPitch();
+                case 3:
+                    return frame.getEncounterSlot();
+                case 4:
+                    return frame.getLevel();
+                case 5:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 6:
+                    return frame.getShinyString();
+                case 7:
+                    return frame.getNatureString();
+                case 8:
+                    return frame.getAbility();
+                case 9:
+                    return frame.getIV(0);
+                case 10:
+                    return frame.getIV(1);
+                case 11:
+                    return frame.getIV(2);
+                case 12:
+                    return frame.getIV(3);
+                case 13:
+                    return frame.getIV(4);
+                case 14:
+                    return frame.getIV(5);
+                case 15:
+                    return frame.getPowerString();
+                case 16:
+                    return frame.getPower();
+                case 17:
+                    return frame.getGenderString();
+            }
+        case Method::MethodK:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.getOccidentary();
+                case 2:
+                    return frame.getCall();
+                case 3:
+                    return frame.chatotPitch();
+                case 4:
+                    return frame.getEncounterSlot();
+                case 5:
+                    return frame.getLevel();
+                case 6:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 7:
+                    return frame.getShinyString();
+                case 8:
+                    return frame.getNatureString();
+                case 9:
+                    return frame.getAbility();
+                case 10:
+                    return frame.getIV(0);
+                case 11:
+                    return frame.getIV(1);
+                case 12:
+                    return frame.getIV(2);
+                case 13:
+                    return frame.getIV(3);
+                case 14:
+                    return frame.getIV(4);
+                case 15:
+                    return frame.getIV(5);
+                case 16:
+                    return frame.getPowerString();
+                case 17:
+                    return frame.getPower();
+                case 18:
+                    return frame.getGenderString();
+            }
+        case Method::ChainedShiny:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.chatotPitch();
+                case 2:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 3:
+                    return frame.getShinyString();
+                case 4:
+                    return frame.getNatureString();
+                case 5:
+                    return frame.getAbility();
+                case 6:
+                    return frame.getIV(0);
+                case 7:
+                    return frame.getIV(1);
+                case 8:
+                    return frame.getIV(2);
+                case 9:
+                    return frame.getIV(3);
+                case 10:
+                    return frame.getIV(4);
+                case 11:
+                    return frame.getIV(5);
+                case 12:
+                    return frame.getPowerString();
+                case 13:
+                    return frame.getPower();
+                case 14:
+                    return frame.getGenderString();
+            }
+        default:
+            break;
+    }
+    return QVariant();
+}
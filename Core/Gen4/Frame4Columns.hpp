@@ -0,0 +1,75 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef FRAME4COLUMNS_HPP
+#define FRAME4COLUMNS_HPP
+
+#include <QCoreApplication>
+#include <QVariant>
+#include <Core/Gen4/Frame4.hpp>
+
+// Display text of the Gen 4 result tables, shared by the models and the batch runner.
+// Translations keep the context of the model each table was first written in.
+class Searcher4Columns
+{
+    Q_DECLARE_TR_FUNCTIONS(Searcher4Model)
+
+public:
+    Searcher4Columns(Method method = Method::Method1, bool stationary = false);
+    int getColumnCount() const;
+    QStringList getHeader() const;
+    QVariant getData(const Frame4 &frame, int column) const;
+
+private:
+    Method method;
+    bool stationary;
+
+};
+
+class Stationary4Columns
+{
+    Q_DECLARE_TR_FUNCTIONS(Stationary4Model)
+
+public:
+    Stationary4Columns(Method method = Method::Method1);
+    int getColumnCount() const;
+    QStringList getHeader() const;
+    QVariant getData(const Frame4 &frame, int column) const;
+
+private:
+    Method method;
+
+};
+
+class Wild4Columns
+{
+    Q_DECLARE_TR_FUNCTIONS(Wild4Model)
+
+public:
+    Wild4Columns(Method method = Method::MethodJ);
+    int getColumnCount() const;
+    QStringList getHeader() const;
+    QVariant getData(const Frame4 &frame, int column) const;
+
+private:
+    Method method;
+
+};
+
+#endif // FRAME4COLUMNS_HPP
@@ -19,6 +19,8 @@
 
 #include "Generator4.hpp"
 #include <Core/RNG/LCRNG.hpp>
+#include <Core/RNG/RNGList.hpp>
+#include <Core/RNG/RNGWindow.hpp>
 #include <Core/Util/EncounterSlot.hpp>
 
 Generator4::Generator4()
@@ -54,27 +56,27 @@ QVector<Frame4> Generator4::generate(const FrameCompare &compare) const
     switch (frameType)
     {
         case Method::Method1:
-            return generateMethod1(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateMethod1(compare));
         case Method::MethodJ:
             switch (encounterType)
             {
                 case Encounter::Stationary:
-                    return generateMethodJStationary(compare);
+                    return PROFILE_CALL(profile, Stage::Generation, maxResults, generateMethodJStationary(compare));
                 default:
-                    return generateMethodJWild(compare);
+                    return PROFILE_CALL(profile, Stage::Generation, maxResults, generateMethodJWild(compare));
             }
         case Method::MethodK:
             switch (encounterType)
             {
                 case Encounter::Stationary:
-                    return generateMethodKStationary(compare);
+                    return PROFILE_CALL(profile, Stage::Generation, maxResults, generateMethodKStationary(compare));
                 default:
-                    return generateMethodKWild(compare);
+                    return PROFILE_CALL(profile, Stage::Generation, maxResults, generateMethodKWild(compare));
             }
         case Method::ChainedShiny:
-            return generateChainedShiny(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateChainedShiny(compare));
         case Method::WondercardIVs:
-            return generateWondercardIVs(compare);
+            return PROFILE_CALL(profile, Stage::Generation, maxResults, generateWondercardIVs(compare));
         default:
             return QVector<Frame4>();
     }
@@ -85,28 +87,28 @@ QVector<Frame4> Generator4::generateMethod1(const FrameCompare &compare) const
     QVector<Frame4> frames;
     Frame4 frame(tid, sid, psv);
 
-    PokeRNG rng(initialSeed, initialFrame - 1 + offset);
-    QVector<u16> rngList(maxResults + 4);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<PokeRNG, 4> rngList(PokeRNG(initialSeed, initialFrame - 1 + offset));
 
     // Method 1 [SEED] [PID] [PID] [IVS] [IVS]
 
-    for (u32 cnt = 0; cnt < maxResults; cnt++)
+    for (u32 cnt = 0; cnt < maxResults; cnt++, rngList.advanceFrame())
     {
-        u16 high = rngList.at(cnt + 1);
-        u16 low = rngList.at(cnt);
-        u16 iv1 = rngList.at(cnt + 2);
-        u16 iv2 = rngList.at(cnt + 3);
+        u16 high = rngList.at(1);
+        u16 low = rngList.at(0);
+        u16 iv1 = rngList.at(2);
+        u16 iv2 = rngList.at(3);
+
+        if (!compare.compareIVs(iv1, iv2))
+        {
+            continue;
+        }
 
         frame.setPID(high, low, genderRatio);
         frame.setIVs(iv1, iv2);
 
-        if (compare.compareFrame(frame))
+        if (compare.comparePID(frame))
         {
-            frame.setSeed(rngList.at(cnt));
+            frame.setSeed(rngList.at(0));
             frame.setFrame(cnt + initialFrame);
             frames.append(frame);
         }
@@ -120,10 +122,9 @@ QVector<Frame4> Generator4::generateMethodJStationary(const FrameCompare &compar
     QVector<Frame4> frames;
     Frame4 frame(tid, sid, psv);
 
-    PokeRNG rng(initialSeed, initialFrame - 1 + offset);
+    RNGWindow<PokeRNG, 1024> window(PokeRNG(initialSeed, initialFrame - 1 + offset));
     u32 max = initialFrame + maxResults;
     u32 pid;
-    u16 low, high;
 
     u8 buffer = 0;
 
@@ -148,9 +149,9 @@ QVector<Frame4> Generator4::generateMethodJStationary(const FrameCompare &compar
             break;
     }
 
-    for (u32 cnt = initialFrame; cnt < max; cnt++)
+    for (u32 cnt = initialFrame; cnt < max; cnt++, window.advanceFrame())
     {
-        PokeRNG go(rng.nextUInt());
+        auto go = window.getCursor();
         frame.setSeed(go.getSeed() >> 16);
 
         switch (leadType)
@@ -165,13 +166,7 @@ QVector<Frame4> Generator4::generateMethodJStationary(const FrameCompare &compar
                 }
 
                 // Begin search for valid pid
-                do
-                {
-                    low = go.nextUShort();
-                    high = go.nextUShort();
-                    pid = (high << 16) | low;
-                }
-                while (pid % 25 != frame.getNature());
+                pid = go.huntPID(frame.getNature());
                 frame.setPID(pid, genderRatio);
 
                 break;
@@ -191,13 +186,7 @@ QVector<Frame4> Generator4::generateMethodJStationary(const FrameCompare &compar
                 }
 
                 // Begin search for valid pid
-                do
-                {
-                    low = go.nextUShort();
-                    high = go.nextUShort();
-                    pid = (high << 16) | low;
-                }
-                while (pid % 25 != frame.getNature());
+                pid = go.huntPID(frame.getNature());
                 frame.setPID(pid, genderRatio);
 
                 break;
@@ -226,13 +215,7 @@ QVector<Frame4> Generator4::generateMethodJStationary(const FrameCompare &compar
                     }
 
                     // Begin search for valid pid
-                    do
-                    {
-                        low = go.nextUShort();
-                        high = go.nextUShort();
-                        pid = (high << 16) | low;
-                    }
-                    while (pid % 25 != frame.getNature());
+                    pid = go.huntPID(frame.getNature());
                     frame.setPID(pid, genderRatio);
                 }
 
@@ -242,9 +225,14 @@ QVector<Frame4> Generator4::generateMethodJStationary(const FrameCompare &compar
         u16 iv1 = go.nextUShort();
         u16 iv2 = go.nextUShort();
 
+        if (!compare.compareIVs(iv1, iv2))
+        {
+            continue;
+        }
+
         frame.setIVs(iv1, iv2);
 
-        if (compare.compareFrame(frame))
+        if (compare.comparePID(frame))
         {
             frame.setFrame(cnt);
             frames.append(frame);
@@ -259,10 +247,9 @@ QVector<Frame4> Generator4::generateMethodJWild(const FrameCompare &compare) con
     QVector<Frame4> frames;
     Frame4 frame(tid, sid, psv);
 
-    PokeRNG rng(initialSeed, initialFrame - 1 + offset);
+    RNGWindow<PokeRNG, 1024> window(PokeRNG(initialSeed, initialFrame - 1 + offset));
     u32 max = initialFrame + maxResults;
     u32 pid, hunt = 0;
-    u16 low, high;
 
     u8 buffer = 0;
     u8 thresh = encounterType == Encounter::OldRod ? 25 : encounterType == Encounter::GoodRod ? 50 : encounterType == Encounter::SuperRod ? 75 : 0;
@@ -288,9 +275,9 @@ QVector<Frame4> Generator4::generateMethodJWild(const FrameCompare &compare) con
             break;
     }
 
-    for (u32 cnt = initialFrame; cnt < max; cnt++)
+    for (u32 cnt = initialFrame; cnt < max; cnt++, window.advanceFrame())
     {
-        PokeRNG go(rng.nextUInt());
+        auto go = window.getCursor();
         frame.setSeed(go.getSeed() >> 16);
 
         switch (encounterType)
@@ -348,14 +335,7 @@ QVector<Frame4> Generator4::generateMethodJWild(const FrameCompare &compare) con
                 }
 
                 // Begin search for valid pid
-                do
-                {
-                    low = go.nextUShort();
-                    high = go.nextUShort();
-                    pid = (high << 16) | low;
-                    hunt += 2;
-                }
-                while (pid % 25 != frame.getNature());
+                pid = go.huntPID(frame.getNature(), hunt);
                 frame.setPID(pid, genderRatio);
 
                 break;
@@ -376,14 +356,7 @@ QVector<Frame4> Generator4::generateMethodJWild(const FrameCompare &compare) con
                 }
 
                 // Begin search for valid pid
-                do
-                {
-                    low = go.nextUShort();
-                    high = go.nextUShort();
-                    pid = (high << 16) | low;
-                    hunt += 2;
-                }
-                while (pid % 25 != frame.getNature());
+                pid = go.huntPID(frame.getNature(), hunt);
                 frame.setPID(pid, genderRatio);
 
                 break;
@@ -415,14 +388,7 @@ QVector<Frame4> Generator4::generateMethodJWild(const FrameCompare &compare) con
                     }
 
                     // Begin search for valid pid
-                    do
-                    {
-                        low = go.nextUShort();
-                        high = go.nextUShort();
-                        pid = (high << 16) | low;
-                        hunt += 2;
-                    }
-                    while (pid % 25 != frame.getNature());
+                    pid = go.huntPID(frame.getNature(), hunt);
                     frame.setPID(pid, genderRatio);
                 }
 
@@ -432,9 +398,14 @@ QVector<Frame4> Generator4::generateMethodJWild(const FrameCompare &compare) con
         u16 iv1 = go.nextUShort();
         u16 iv2 = go.nextUShort();
 
+        if (!compare.compareIVs(iv1, iv2))
+        {
+            continue;
+        }
+
         frame.setIVs(iv1, iv2);
 
-        if (compare.compareFrame(frame))
+        if (compare.comparePID(frame))
         {
             frame.setFrame(cnt);
             frame.setOccidentary(hunt + cnt);
@@ -450,10 +421,9 @@ QVector<Frame4> Generator4::generateMethodKStationary(const FrameCompare &compar
     QVector<Frame4> frames;
     Frame4 frame(tid, sid, psv);
 
-    PokeRNG rng(initialSeed, initialFrame - 1 + offset);
+    RNGWindow<PokeRNG, 1024> window(PokeRNG(initialSeed, initialFrame - 1 + offset));
     u32 max = initialFrame + maxResults;
     u32 pid;
-    u16 low, high;
 
     u8 buffer = 0;
 
@@ -478,9 +448,9 @@ QVector<Frame4> Generator4::generateMethodKStationary(const FrameCompare &compar
             break;
     }
 
-    for (u32 cnt = initialFrame; cnt < max; cnt++)
+    for (u32 cnt = initialFrame; cnt < max; cnt++, window.advanceFrame())
     {
-        PokeRNG go(rng.nextUInt());
+        auto go = window.getCursor();
         frame.setSeed(go.getSeed() >> 16);
 
         switch (leadType)
@@ -495,13 +465,7 @@ QVector<Frame4> Generator4::generateMethodKStationary(const FrameCompare &compar
                 }
 
                 // Begin search for valid pid
-                do
-                {
-                    low = go.nextUShort();
-                    high = go.nextUShort();
-                    pid = (high << 16) | low;
-                }
-                while (pid % 25 != frame.getNature());
+                pid = go.huntPID(frame.getNature());
                 frame.setPID(pid, genderRatio);
 
                 break;
@@ -521,13 +485,7 @@ QVector<Frame4> Generator4::generateMethodKStationary(const FrameCompare &compar
                 }
 
                 // Begin search for valid pid
-                do
-                {
-                    low = go.nextUShort();
-                    high = go.nextUShort();
-                    pid = (high << 16) | low;
-                }
-                while (pid % 25 != frame.getNature());
+                pid = go.huntPID(frame.getNature());
                 frame.setPID(pid, genderRatio);
 
                 break;
@@ -555,13 +513,7 @@ QVector<Frame4> Generator4::generateMethodKStationary(const FrameCompare &compar
                     }
 
                     // Begin search for valid pid
-                    do
-                    {
-                        low = go.nextUShort();
-                        high = go.nextUShort();
-                        pid = (high << 16) | low;
-                    }
-                    while (pid % 25 != frame.getNature());
+                    pid = go.huntPID(frame.getNature());
 
                     frame.setPID(pid, genderRatio);
                 }
@@ -572,9 +524,14 @@ QVector<Frame4> Generator4::generateMethodKStationary(const FrameCompare &compar
         u16 iv1 = go.nextUShort();
         u16 iv2 = go.nextUShort();
 
+        if (!compare.compareIVs(iv1, iv2))
+        {
+            continue;
+        }
+
         frame.setIVs(iv1, iv2);
 
-        if (compare.compareFrame(frame))
+        if (compare.comparePID(frame))
         {
             frame.setFrame(cnt);
             frames.append(frame);
@@ -589,10 +546,9 @@ QVector<Frame4> Generator4::generateMethodKWild(const FrameCompare &compare) con
     QVector<Frame4> frames;
     Frame4 frame(tid, sid, psv);
 
-    PokeRNG rng(initialSeed, initialFrame - 1 + offset);
+    RNGWindow<PokeRNG, 1024> window(PokeRNG(initialSeed, initialFrame - 1 + offset));
     u32 max = initialFrame + maxResults;
     u32 pid, hunt = 0;
-    u16 low, high;
 
     u8 buffer, thresh = 0, rate = encounter.getEncounterRate();
     if (encounterType == Encounter::OldRod)
@@ -629,9 +585,9 @@ QVector<Frame4> Generator4::generateMethodKWild(const FrameCompare &compare) con
             break;
     }
 
-    for (u32 cnt = initialFrame; cnt < max; cnt++)
+    for (u32 cnt = initialFrame; cnt < max; cnt++, window.advanceFrame())
     {
-        PokeRNG go(rng.nextUInt());
+        auto go = window.getCursor();
         frame.setSeed(go.getSeed() >> 16);
 
         switch (encounterType)
@@ -709,14 +665,7 @@ QVector<Frame4> Generator4::generateMethodKWild(const FrameCompare &compare) con
                 }
 
                 // Begin search for valid pid
-                do
-                {
-                    low = go.nextUShort();
-                    high = go.nextUShort();
-                    pid = (high << 16) | low;
-                    hunt += 2;
-                }
-                while (pid % 25 != frame.getNature());
+                pid = go.huntPID(frame.getNature(), hunt);
                 frame.setPID(pid, genderRatio);
 
                 break;
@@ -738,13 +687,7 @@ QVector<Frame4> Generator4::generateMethodKWild(const FrameCompare &compare) con
                 }
 
                 // Begin search for valid pid
-                do
-                {
-                    low = go.nextUShort();
-                    high = go.nextUShort();
-                    pid = (high << 16) | low;
-                }
-                while (pid % 25 != frame.getNature());
+                pid = go.huntPID(frame.getNature());
                 frame.setPID(pid, genderRatio);
 
                 break;
@@ -775,13 +718,7 @@ QVector<Frame4> Generator4::generateMethodKWild(const FrameCompare &compare) con
                     }
 
                     // Begin search for valid pid
-                    do
-                    {
-                        low = go.nextUShort();
-                        high = go.nextUShort();
-                        pid = (high << 16) | low;
-                    }
-                    while (pid % 25 != frame.getNature());
+                    pid = go.huntPID(frame.getNature());
 
                     frame.setPID(pid, genderRatio);
                 }
@@ -792,9 +729,14 @@ QVector<Frame4> Generator4::generateMethodKWild(const FrameCompare &compare) con
         u16 iv1 = go.nextUShort();
         u16 iv2 = go.nextUShort();
 
+        if (!compare.compareIVs(iv1, iv2))
+        {
+            continue;
+        }
+
         frame.setIVs(iv1, iv2);
 
-        if (compare.compareFrame(frame))
+        if (compare.comparePID(frame))
         {
             frame.setFrame(cnt);
             frames.append(frame);
@@ -809,26 +751,26 @@ QVector<Frame4> Generator4::generateChainedShiny(const FrameCompare &compare) co
     QVector<Frame4> frames;
     Frame4 frame(tid, sid, psv);
 
-    PokeRNG rng(initialSeed, initialFrame - 1 + offset);
-    QVector<u16> rngList(maxResults + 18);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<PokeRNG, 32> rngList(PokeRNG(initialSeed, initialFrame - 1 + offset));
 
     u16 low, high;
-    for (u32 cnt = initialFrame; cnt < maxResults; cnt++)
+    for (u32 cnt = 0; cnt < maxResults; cnt++, rngList.advanceFrame())
     {
-        low = chainedPIDLow(rngList.at(cnt + 1), rngList.at(cnt + 15), rngList.at(cnt + 14), rngList.at(cnt + 13), rngList.at(cnt + 12), rngList.at(cnt + 11), rngList.at(cnt + 10),
-                            rngList.at(cnt + 9), rngList.at(cnt + 8), rngList.at(cnt + 7), rngList.at(cnt + 6), rngList.at(cnt + 5), rngList.at(cnt + 4), rngList.at(cnt + 3));
-        high = chainedPIDHigh(rngList.at(2 + cnt), low, tid, sid);
+        low = chainedPIDLow(rngList.at(1), rngList.at(15), rngList.at(14), rngList.at(13), rngList.at(12), rngList.at(11), rngList.at(10),
+                            rngList.at(9), rngList.at(8), rngList.at(7), rngList.at(6), rngList.at(5), rngList.at(4), rngList.at(3));
+        high = chainedPIDHigh(rngList.at(2), low, tid, sid);
+
+        if (!compare.compareIVs(rngList.at(16), rngList.at(17)))
+        {
+            continue;
+        }
 
         frame.setPID(high, low, genderRatio);
-        frame.setIVs(rngList.at(cnt + 16), rngList.at(cnt + 17));
+        frame.setIVs(rngList.at(16), rngList.at(17));
 
-        if (compare.compareFrame(frame))
+        if (compare.comparePID(frame))
         {
-            frame.setSeed(rngList.at(cnt));
+            frame.setSeed(rngList.at(0));
             frame.setFrame(cnt + initialFrame);
             frames.append(frame);
         }
@@ -842,22 +784,16 @@ QVector<Frame4> Generator4::generateWondercardIVs(const FrameCompare &compare) c
     QVector<Frame4> frames;
     Frame4 frame(tid, sid, psv);
 
-    PokeRNG rng(initialSeed, initialFrame - 1 + offset);
-    QVector<u16> rngList(maxResults + 2);
-    for (u16 &x : rngList)
-    {
-        x = rng.nextUShort();
-    }
+    RNGList<PokeRNG, 2> rngList(PokeRNG(initialSeed, initialFrame - 1 + offset));
 
     // Wondercard IVs [SEED] [IVS] [IVS]
 
-    for (u32 cnt = 0; cnt < maxResults; cnt++)
+    for (u32 cnt = 0; cnt < maxResults; cnt++, rngList.advanceFrame())
     {
-        frame.setIVs(rngList.at(cnt), rngList.at(cnt + 1));
-
-        if (compare.compareIVs(frame))
+        if (compare.compareIVs(rngList.at(0), rngList.at(1)))
         {
-            frame.setSeed(rngList.at(cnt));
+            frame.setIVs(rngList.at(0), rngList.at(1));
+            frame.setSeed(rngList.at(0));
             frame.setFrame(cnt + initialFrame);
             frames.append(frame);
         }
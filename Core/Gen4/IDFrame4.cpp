@@ -0,0 +1,54 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IDFrame4.hpp"
+
+IDFrame4::IDFrame4(u32 seed, u16 tid, u16 sid, u32 delay, u8 seconds)
+{
+    this->seed = seed;
+    this->tid = tid;
+    this->sid = sid;
+    this->delay = delay;
+    this->seconds = seconds;
+}
+
+u32 IDFrame4::getSeed() const
+{
+    return seed;
+}
+
+u16 IDFrame4::getTID() const
+{
+    return tid;
+}
+
+u16 IDFrame4::getSID() const
+{
+    return sid;
+}
+
+u32 IDFrame4::getDelay() const
+{
+    return delay;
+}
+
+u8 IDFrame4::getSeconds() const
+{
+    return seconds;
+}
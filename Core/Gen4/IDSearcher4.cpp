@@ -17,187 +17,170 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <QtConcurrent>
+#include <QTimer>
 #include "IDSearcher4.hpp"
-#include <Core/RNG/MTRNG.hpp>
-#include <Core/Util/Utilities.hpp>
+#include <Core/Util/SearchScheduler.hpp>
 
-ShinyPIDSearcher::ShinyPIDSearcher(u32 pid, bool useTID, u16 tid, u32 year, u32 minDelay, u32 maxDelay, bool infinite)
+#define CHUNKSIZE 0x10000
+
+namespace
+{
+    // Tempered output of the second Mersenne Twister call for seed
+    // Only mt[1], mt[2] and mt[398] take part so the rest of the state is never built
+    u32 mtOutput(u32 seed)
+    {
+        u32 mt1 = 0x6C078965 * (seed ^ (seed >> 30)) + 1;
+        u32 mt2 = 0x6C078965 * (mt1 ^ (mt1 >> 30)) + 2;
+        u32 mt = mt2;
+        for (u32 i = 3; i <= 398; i++)
+        {
+            mt = 0x6C078965 * (mt ^ (mt >> 30)) + i;
+        }
+
+        u32 y = (mt1 & 0x80000000) | (mt2 & 0x7FFFFFFF);
+        y = mt ^ (y >> 1) ^ ((y & 1) ? 0x9908B0DF : 0);
+
+        y ^= (y >> 11);
+        y ^= (y << 7) & 0x9D2C5680;
+        y ^= (y << 15) & 0xEFC60000;
+        y ^= (y >> 18);
+
+        return y;
+    }
+}
+
+// Searches every seed of each delay
+IDSearcher4::IDSearcher4(const IDFilter &filter, u32 year, u32 minDelay, u32 maxDelay, bool infinite) :
+    filter(filter)
 {
-    this->pid = pid;
-    this->useTID = useTID;
-    this->tid = tid;
     this->year = year;
     this->minDelay = minDelay;
+    this->maxDelay = infinite ? 0xE8FFFF : maxDelay;
+
+    for (u16 ab = 0; ab < 256; ab++)
+    {
+        for (u8 cd = 0; cd < 24; cd++)
+        {
+            prefixes.append((ab << 24) | (cd << 16));
+        }
+    }
+
+    init();
+}
+
+// Searches each second of the minute for a known date and time
+IDSearcher4::IDSearcher4(const IDFilter &filter, const QDateTime &dateTime, u32 minDelay, u32 maxDelay) :
+    filter(filter)
+{
+    this->year = static_cast<u32>(dateTime.date().year());
+    this->minDelay = minDelay;
     this->maxDelay = maxDelay;
-    this->infinite = infinite;
+
+    u32 month = static_cast<u32>(dateTime.date().month());
+    u32 day = static_cast<u32>(dateTime.date().day());
+    u32 hour = static_cast<u32>(dateTime.time().hour());
+    u32 minute = static_cast<u32>(dateTime.time().minute());
+
+    for (u8 second = 0; second < 60; second++)
+    {
+        prefixes.append(((((month * day) + (minute + second)) & 0xFF) << 24) | (hour << 16));
+        seconds.append(second);
+    }
+
+    init();
+}
+
+void IDSearcher4::init()
+{
     searching = false;
     cancel = false;
-    progress = 0;
+    job = -1;
 
-    connect(this, &ShinyPIDSearcher::finished, this, [ = ]
+    connect(this, &IDSearcher4::finished, this, [ = ]
     {
         searching = false;
-        emit updateProgress(getResults(), progress);
-        QTimer::singleShot(1000, this, &ShinyPIDSearcher::deleteLater);
+        emit updateProgress(results.takeAll(), progress.sample());
+        QTimer::singleShot(1000, this, &IDSearcher4::deleteLater);
     });
 }
 
-void ShinyPIDSearcher::startSearch()
+void IDSearcher4::startSearch()
 {
     if (!searching)
     {
-        progress = 0;
+        progress.start(static_cast<u64>(prefixes.size()) * (static_cast<u64>(maxDelay) - minDelay + 1));
         searching = true;
         cancel = false;
 
         auto *timer = new QTimer(this);
-        connect(this, &ShinyPIDSearcher::finished, timer, &QTimer::stop);
-        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(getResults(), progress); });
+        connect(this, &IDSearcher4::finished, timer, &QTimer::stop);
+        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(results.take(), progress.sample()); });
         timer->start(1000);
 
-        QtConcurrent::run([ = ] { search(); });
+        u32 delays = qMax(1, CHUNKSIZE / prefixes.size());
+        int chunks = static_cast<int>((static_cast<u64>(maxDelay) - minDelay + delays) / delays);
+        job = SearchScheduler::getInstance().submit(chunks, [ = ](int chunk) { search(chunk); }, [ = ](bool) { emit finished(); });
     }
 }
 
-void ShinyPIDSearcher::cancelSearch()
+void IDSearcher4::cancelSearch()
 {
     cancel = true;
+    SearchScheduler::getInstance().cancel(job);
 }
 
-void ShinyPIDSearcher::search()
+void IDSearcher4::pauseSearch()
 {
-    maxDelay = infinite ? 0xE8FFFF : maxDelay;
-    for (u32 efgh = minDelay; efgh <= maxDelay; efgh++)
-    {
-        for (u16 ab = 0; ab < 256; ab++)
-        {
-            for (u8 cd = 0; cd < 24; cd++)
-            {
-                if (cancel)
-                {
-                    emit finished();
-                    return;
-                }
-
-                u32 seed = ((ab << 24) | (cd << 16)) + efgh;
-                MersenneTwister mt(seed, 1);
-
-                u32 y = mt.nextUInt();
-
-                u16 id = y & 0xFFFF;
-                u16 sid = y >> 16;
-
-                if (Utilities::shiny(pid, id, sid) && (!useTID || id == tid))
-                {
-                    u32 delay = efgh + 2000 - year;
-                    auto frame = QList<QStandardItem *>() << new QStandardItem(QString::number(seed, 16).toUpper().rightJustified(8, '0')) << new QStandardItem(QString::number(id))
-                                 << new QStandardItem(QString::number(sid)) << new QStandardItem(QString::number(delay));
-                    QMutexLocker locker(&mutex);
-                    results.append(frame);
-                }
-
-                progress++;
-            }
-        }
-    }
-    emit finished();
+    SearchScheduler::getInstance().pause(job);
 }
 
-QVector<QList<QStandardItem *>> ShinyPIDSearcher::getResults()
+void IDSearcher4::resumeSearch()
 {
-    QMutexLocker locker(&mutex);
-    auto data(results);
-    results.clear();
-    return data;
+    SearchScheduler::getInstance().resume(job);
 }
 
-
-TIDSIDSearcher::TIDSIDSearcher(u16 tid, bool useSID, u16 searchSID, u32 year, u32 minDelay, u32 maxDelay, bool infinite)
+void IDSearcher4::setMaxThreads(int maxThreads)
 {
-    this->tid = tid;
-    this->useSID = useSID;
-    this->searchSID = searchSID;
-    this->year = year;
-    this->minDelay = minDelay;
-    this->maxDelay = maxDelay;
-    this->infinite = infinite;
-    searching = false;
-    cancel = false;
-    progress = 0;
-
-    connect(this, &TIDSIDSearcher::finished, this, [ = ]
-    {
-        searching = false;
-        emit updateProgress(getResults(), progress);
-        QTimer::singleShot(1000, this, &TIDSIDSearcher::deleteLater);
-    });
+    SearchScheduler::getInstance().setMaxThreads(job, maxThreads);
 }
 
-void TIDSIDSearcher::startSearch()
+// Each chunk covers a block of delays with every prefix, about CHUNKSIZE seeds
+void IDSearcher4::search(int chunk)
 {
-    if (!searching)
+    if (cancel)
     {
-        progress = 0;
-        searching = true;
-        cancel = false;
+        return;
+    }
 
-        auto *timer = new QTimer(this);
-        connect(this, &TIDSIDSearcher::finished, timer, &QTimer::stop);
-        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(getResults(), progress); });
+    u32 delays = qMax(1, CHUNKSIZE / prefixes.size());
+    u32 start = minDelay + static_cast<u32>(chunk) * delays;
+    u32 end = static_cast<u32>(qMin<u64>(static_cast<u64>(start) + delays - 1, maxDelay));
 
-        QtConcurrent::run([ = ] { search(); });
-    }
+    results.add(chunk, searchDelays(start, end));
+    progress.add(static_cast<u64>(end - start + 1) * prefixes.size());
 }
 
-void TIDSIDSearcher::cancelSearch()
+QVector<IDFrame4> IDSearcher4::searchDelays(u32 minEFGH, u32 maxEFGH) const
 {
-    cancel = true;
-}
+    QVector<IDFrame4> frames;
 
-void TIDSIDSearcher::search()
-{
-    maxDelay = infinite ? 0xE8FFFF : maxDelay;
-    for (u32 efgh = minDelay; efgh <= maxDelay; efgh++)
+    for (u32 efgh = minEFGH; efgh <= maxEFGH; efgh++)
     {
-        for (u16 ab = 0; ab < 256; ab++)
+        for (int i = 0; i < prefixes.size(); i++)
         {
-            for (u8 cd = 0; cd < 24; cd++)
+            u32 seed = prefixes.at(i) + efgh;
+            u32 y = mtOutput(seed);
+
+            u16 tid = y & 0xFFFF;
+            u16 sid = y >> 16;
+
+            if (filter.compare(tid, sid))
             {
-                if (cancel)
-                {
-                    emit finished();
-                    return;
-                }
-
-                u32 seed = ((ab << 24) | (cd << 16)) + efgh;
-                MersenneTwister mt(seed, 1);
-
-                u32 y = mt.nextUInt();
-
-                u16 id = y & 0xFFFF;
-                u16 sid = y >> 16;
-
-                if (id == tid && (!useSID || sid == searchSID))
-                {
-                    u32 delay = efgh + 2000 - year;
-                    auto frame = QList<QStandardItem *>() << new QStandardItem(QString::number(seed, 16).toUpper().rightJustified(8, '0')) << new QStandardItem(QString::number(id))
-                                 << new QStandardItem(QString::number(sid)) << new QStandardItem(QString::number(delay));
-                    QMutexLocker locker(&mutex);
-                    results.append(frame);
-                }
-
-                progress++;
+                u32 delay = efgh + 2000 - year;
+                frames.append(IDFrame4(seed, tid, sid, delay, seconds.isEmpty() ? 0 : seconds.at(i)));
             }
         }
     }
-    emit finished();
-}
 
-QVector<QList<QStandardItem *>> TIDSIDSearcher::getResults()
-{
-    QMutexLocker locker(&mutex);
-    auto data(results);
-    results.clear();
-    return data;
+    return frames;
 }
@@ -20,68 +20,46 @@
 #ifndef IDSEARCHER4_HPP
 #define IDSEARCHER4_HPP
 
-#include <QMutex>
+#include <QDateTime>
 #include <QObject>
-#include <QStandardItem>
-#include <Core/Util/Global.hpp>
+#include <Core/Gen4/IDFrame4.hpp>
+#include <Core/Parents/IDFilter.hpp>
+#include <Core/Util/ChunkResults.hpp>
+#include <Core/Util/SearchProgress.hpp>
 
-class ShinyPIDSearcher : public QObject
+class IDSearcher4 : public QObject
 {
     Q_OBJECT
 
 signals:
     void finished();
-    void updateProgress(const QVector<QList<QStandardItem *>> &, int);
+    void updateProgress(const QVector<IDFrame4> &, const ProgressReport &);
 
 public:
-    ShinyPIDSearcher(u32 pid, bool useTID, u16 tid, u32 year, u32 minDelay, u32 maxDelay, bool infinite);
+    IDSearcher4(const IDFilter &filter, u32 year, u32 minDelay, u32 maxDelay, bool infinite);
+    IDSearcher4(const IDFilter &filter, const QDateTime &dateTime, u32 minDelay, u32 maxDelay);
     void startSearch();
 
 public slots:
     void cancelSearch();
+    void pauseSearch();
+    void resumeSearch();
+    void setMaxThreads(int maxThreads);
 
 private:
-    u32 pid;
-    bool useTID, infinite;
-    u16 tid;
+    IDFilter filter;
     u32 year, minDelay, maxDelay;
-    QMutex mutex;
-    QVector<QList<QStandardItem *>> results;
+    QVector<u32> prefixes;
+    QVector<u8> seconds;
+    ChunkResults<IDFrame4> results;
     bool searching, cancel;
-    int progress;
+    int job;
+    SearchProgress progress;
 
-    void search();
-    QVector<QList<QStandardItem *>> getResults();
+    void init();
+    void search(int chunk);
+    QVector<IDFrame4> searchDelays(u32 minEFGH, u32 maxEFGH) const;
 
 };
 
-class TIDSIDSearcher : public QObject
-{
-    Q_OBJECT
-
-signals:
-    void finished();
-    void updateProgress(const QVector<QList<QStandardItem *>> &, int);
-
-public:
-    TIDSIDSearcher(u16 tid, bool useSID, u16 searchSID, u32 year, u32 minDelay, u32 maxDelay, bool infinite);
-    void startSearch();
-
-public slots:
-    void cancelSearch();
-
-private:
-    u16 tid;
-    bool useSID, infinite;
-    u16 searchSID;
-    u32 year, minDelay, maxDelay;
-    QMutex mutex;
-    QVector<QList<QStandardItem *>> results;
-    bool searching, cancel;
-    int progress;
-
-    void search();
-    QVector<QList<QStandardItem *>> getResults();
-
-};
 #endif // IDSEARCHER4_HPP
@@ -23,6 +23,8 @@
 #include <QMutex>
 #include <QObject>
 #include <Core/Gen4/Searcher4.hpp>
+#include <Core/Util/ChunkResults.hpp>
+#include <Core/Util/SearchProgress.hpp>
 
 class IVSearcher4 : public QObject
 {
@@ -30,25 +32,30 @@ class IVSearcher4 : public QObject
 
 signals:
     void finished();
-    void updateProgress(const QVector<Frame4> &, int);
+    void updateProgress(const QVector<Frame4> &, const ProgressReport &);
 
 public:
     IVSearcher4(const Searcher4 &searcher, const QVector<u8> &min, const QVector<u8> &max);
     void startSearch();
+    StageProfile getProfile() const;
 
 public slots:
     void cancelSearch();
+    void pauseSearch();
+    void resumeSearch();
+    void setMaxThreads(int maxThreads);
 
 private:
     Searcher4 searcher;
     QVector<u8> min, max;
-    QMutex mutex;
-    QVector<Frame4> results;
+    mutable QMutex mutex;
+    ChunkResults<Frame4> results;
+    StageProfile profile;
     bool searching, cancel;
-    int progress;
+    int job;
+    SearchProgress progress;
 
-    void search();
-    QVector<Frame4> getResults();
+    void search(int chunk);
 
 };
 
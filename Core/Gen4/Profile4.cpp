@@ -17,11 +17,9 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <QApplication>
-#include <QJsonArray>
-#include <QJsonDocument>
-#include <QSettings>
+#include <QObject>
 #include "Profile4.hpp"
+#include <Core/Util/ProfileStore.hpp>
 
 Profile4::Profile4()
 {
@@ -119,80 +117,22 @@ QJsonObject Profile4::getJson() const
 
 QVector<Profile4> Profile4::loadProfileList()
 {
-    QVector<Profile4> profileList;
-
-    QSettings setting;
-    QByteArray data = setting.value("profiles").toByteArray();
-
-    QJsonObject profiles(QJsonDocument::fromJson(data).object());
-    QJsonArray gen4 = profiles[QString("gen4")].toArray();
-
-    for (const auto &&i : gen4)
-    {
-        profileList.append(Profile4(i.toObject()));
-    }
-
-    return profileList;
+    return ProfileStore::getInstance().getProfiles4();
 }
 
 void Profile4::saveProfile() const
 {
-    QSettings setting;
-    QByteArray data = setting.value("profiles").toByteArray();
-
-    QJsonObject profiles(QJsonDocument::fromJson(data).object());
-    QJsonArray gen4 = profiles["gen4"].toArray();
-
-    gen4.append(getJson());
-    profiles["gen4"] = gen4;
-
-    setting.setValue("profiles", QJsonDocument(profiles).toJson());
+    ProfileStore::getInstance().addProfile(*this);
 }
 
 void Profile4::deleteProfile() const
 {
-    QSettings setting;
-    QByteArray data = setting.value("profiles").toByteArray();
-
-    QJsonObject profiles(QJsonDocument::fromJson(data).object());
-    QJsonArray gen4 = profiles["gen4"].toArray();
-
-    for (int i = 0; i < gen4.size(); i++)
-    {
-        Profile4 profile(gen4[i].toObject());
-
-        if (profile == *this)
-        {
-            gen4.removeAt(i);
-            profiles["gen4"] = gen4;
-
-            setting.setValue("profiles", QJsonDocument(profiles).toJson());
-            break;
-        }
-    }
+    ProfileStore::getInstance().removeProfile(*this);
 }
 
 void Profile4::updateProfile(const Profile4 &original) const
 {
-    QSettings setting;
-    QByteArray data = setting.value("profiles").toByteArray();
-
-    QJsonObject profiles(QJsonDocument::fromJson(data).object());
-    QJsonArray gen4 = profiles["gen4"].toArray();
-
-    for (auto &&i : gen4)
-    {
-        Profile4 profile(i.toObject());
-
-        if (original == profile && original != *this)
-        {
-            i = getJson();
-            profiles["gen4"] = gen4;
-
-            setting.setValue("profiles", QJsonDocument(profiles).toJson());
-            break;
-        }
-    }
+    ProfileStore::getInstance().updateProfile(original, *this);
 }
 
 bool operator==(const Profile4 &left, const Profile4 &right)
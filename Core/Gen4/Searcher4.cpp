@@ -53,6 +53,12 @@ void Searcher4::setEncounter(const EncounterArea4 &value)
 QVector<Frame4> Searcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
 {
     QVector<Frame4> frames;
+
+    if (!compare.compareHiddenPower(hp, atk, def, spa, spd, spe))
+    {
+        return frames;
+    }
+
     switch (frameType)
     {
         case Method::Method1:
@@ -108,7 +114,7 @@ QVector<Frame4> Searcher4::search(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe)
         default:
             break;
     }
-    return searchInitialSeeds(frames);
+    return PROFILE_CALL(profile, Stage::InitialSeeds, static_cast<u64>(frames.size()), searchInitialSeeds(frames));
 }
 
 QVector<Frame4> Searcher4::searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
@@ -118,15 +124,10 @@ QVector<Frame4> Searcher4::searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
     Frame4 frame(tid, sid, psv);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     for (const auto &seed : seeds)
     {
         // Setup normal frame
@@ -136,14 +137,14 @@ QVector<Frame4> Searcher4::searchMethod1(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
 
         frame.setPID(high, low, genderRatio);
         frame.setSeed(rng.nextUInt());
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
             frames.append(frame);
         }
 
         // Setup XORed frame
         frame.xorFrame();
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
             frame.setSeed(frame.getSeed() ^ 0x80000000);
             frames.append(frame);
@@ -160,15 +161,10 @@ QVector<Frame4> Searcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
     Frame4 frame(tid, sid, psv);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     u8 thresh = encounterType == Encounter::OldRod ? 25 : encounterType == Encounter::GoodRod ? 50 : encounterType == Encounter::SuperRod ? 75 : 0;
 
     for (const auto &val : seeds)
@@ -189,11 +185,13 @@ QVector<Frame4> Searcher4::searchMethodJ(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
                 seed ^= 0x80000000;
             }
 
-            if (!compare.comparePID(frame))
+            if (!PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
             {
                 continue;
             }
 
+            PROFILE_SCOPE(profile, Stage::ReverseWalk, frames);
+
             PokeRNGR testRNG(seed);
             u32 testPID, slot, nibble;
             u16 nextRNG = seed >> 16;
@@ -266,15 +264,10 @@ QVector<Frame4> Searcher4::searchMethodJSynch(u8 hp, u8 atk, u8 def, u8 spa, u8
     frame.setLeadType(Lead::Synchronize);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     u8 thresh = encounterType == Encounter::OldRod ? 25 : encounterType == Encounter::GoodRod ? 50 : encounterType == Encounter::SuperRod ? 75 : 0;
 
     for (const auto &val : seeds)
@@ -295,11 +288,13 @@ QVector<Frame4> Searcher4::searchMethodJSynch(u8 hp, u8 atk, u8 def, u8 spa, u8
                 seed ^= 0x80000000;
             }
 
-            if (!compare.comparePID(frame))
+            if (!PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
             {
                 continue;
             }
 
+            PROFILE_SCOPE(profile, Stage::ReverseWalk, frames);
+
             PokeRNGR testRNG(seed);
             u32 testPID, slot, nibble;
             u16 nextRNG = seed >> 16;
@@ -411,15 +406,10 @@ QVector<Frame4> Searcher4::searchMethodJCuteCharm(u8 hp, u8 atk, u8 def, u8 spa,
     Frame4 frame(tid, sid, psv);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     u8 thresh = encounterType == Encounter::OldRod ? 25 : encounterType == Encounter::GoodRod ? 50 : encounterType == Encounter::SuperRod ? 75 : 0;
 
     for (const auto &val : seeds)
@@ -504,7 +494,7 @@ QVector<Frame4> Searcher4::searchMethodJCuteCharm(u8 hp, u8 atk, u8 def, u8 spa,
                     }
 
                     frame.setPID(choppedPID + buffer, genderRatio);
-                    if (!compare.comparePID(frame))
+                    if (!PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
                     {
                         continue;
                     }
@@ -528,15 +518,10 @@ QVector<Frame4> Searcher4::searchMethodJSearch(u8 hp, u8 atk, u8 def, u8 spa, u8
     Frame4 frame(tid, sid, psv);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     u8 thresh = encounterType == Encounter::OldRod ? 25 : encounterType == Encounter::GoodRod ? 50 : encounterType == Encounter::SuperRod ? 75 : 0;
     u8 adjustedThresh = encounterType == Encounter::OldRod ? 90 : encounterType == Encounter::GoodRod ? 100 : encounterType == Encounter::SuperRod ? 100 : 0;
 
@@ -560,8 +545,9 @@ QVector<Frame4> Searcher4::searchMethodJSearch(u8 hp, u8 atk, u8 def, u8 spa, u8
             u32 slot = 0, nibble = 0;
 
             frame.setPID(high, low, genderRatio);
-            if (compare.comparePID(frame))
+            if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
             {
+                PROFILE_SCOPE(profile, Stage::ReverseWalk, frames);
                 PokeRNGR testRNG(seed);
                 u16 nextRNG = seed >> 16;
                 u16 nextRNG2 = testRNG.nextUShort();
@@ -783,7 +769,7 @@ QVector<Frame4> Searcher4::searchMethodJSearch(u8 hp, u8 atk, u8 def, u8 spa, u8
                     }
 
                     frame.setPID(buffer + choppedPID, genderRatio);
-                    if (!compare.comparePID(frame))
+                    if (!PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
                     {
                         continue;
                     }
@@ -807,15 +793,10 @@ QVector<Frame4> Searcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
     Frame4 frame(tid, sid, psv);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     u8 thresh = encounterType == Encounter::OldRod ? 25 : encounterType == Encounter::GoodRod ? 50 : encounterType == Encounter::SuperRod ? 75 : 0;
     u8 rock = encounter.getEncounterRate();
 
@@ -837,11 +818,13 @@ QVector<Frame4> Searcher4::searchMethodK(u8 hp, u8 atk, u8 def, u8 spa, u8 spd,
                 seed ^= 0x80000000;
             }
 
-            if (!compare.comparePID(frame))
+            if (!PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
             {
                 continue;
             }
 
+            PROFILE_SCOPE(profile, Stage::ReverseWalk, frames);
+
             PokeRNGR testRNG(seed);
             u32 testPID, slot, nibble;
             u16 nextRNG = seed >> 16;
@@ -929,15 +912,10 @@ QVector<Frame4> Searcher4::searchMethodKSynch(u8 hp, u8 atk, u8 def, u8 spa, u8
     frame.setLeadType(Lead::Synchronize);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     u8 thresh = encounterType == Encounter::OldRod ? 25 : encounterType == Encounter::GoodRod ? 50 : encounterType == Encounter::SuperRod ? 75 : 0;
     u8 rock = encounter.getEncounterRate();
 
@@ -959,11 +937,13 @@ QVector<Frame4> Searcher4::searchMethodKSynch(u8 hp, u8 atk, u8 def, u8 spa, u8
                 seed ^= 0x80000000;
             }
 
-            if (!compare.comparePID(frame))
+            if (!PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
             {
                 continue;
             }
 
+            PROFILE_SCOPE(profile, Stage::ReverseWalk, frames);
+
             PokeRNGR testRNG(seed);
             u32 testPID, slot, nibble;
             u16 nextRNG = seed >> 16;
@@ -1110,15 +1090,10 @@ QVector<Frame4> Searcher4::searchMethodKCuteCharm(u8 hp, u8 atk, u8 def, u8 spa,
     Frame4 frame(tid, sid, psv);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     u8 thresh = encounterType == Encounter::OldRod ? 25 : encounterType == Encounter::GoodRod ? 50 : encounterType == Encounter::SuperRod ? 75 : 0;
     u8 rock = encounter.getEncounterRate();
 
@@ -1219,7 +1194,7 @@ QVector<Frame4> Searcher4::searchMethodKCuteCharm(u8 hp, u8 atk, u8 def, u8 spa,
                     }
 
                     frame.setPID(choppedPID + buffer, genderRatio);
-                    if (!compare.comparePID(frame))
+                    if (!PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
                     {
                         continue;
                     }
@@ -1243,15 +1218,10 @@ QVector<Frame4> Searcher4::searchMethodKSuctionCups(u8 hp, u8 atk, u8 def, u8 sp
     Frame4 frame(tid, sid, psv);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     u8 thresh = encounterType == Encounter::OldRod ? 25 : encounterType == Encounter::GoodRod ? 50 : encounterType == Encounter::SuperRod ? 75 : 0;
     u8 adjustedThresh = encounterType == Encounter::OldRod ? 90 : encounterType == Encounter::GoodRod ? 100 : encounterType == Encounter::SuperRod ? 100 : 0;
     u8 rock = encounter.getEncounterRate();
@@ -1274,11 +1244,13 @@ QVector<Frame4> Searcher4::searchMethodKSuctionCups(u8 hp, u8 atk, u8 def, u8 sp
                 seed ^= 0x80000000;
             }
 
-            if (!compare.comparePID(frame))
+            if (!PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
             {
                 continue;
             }
 
+            PROFILE_SCOPE(profile, Stage::ReverseWalk, frames);
+
             PokeRNGR testRNG(seed);
             u32 testPID, slot, nibble;
             u16 nextRNG = seed >> 16;
@@ -1370,15 +1342,10 @@ QVector<Frame4> Searcher4::searchMethodKSearch(u8 hp, u8 atk, u8 def, u8 spa, u8
     Frame4 frame(tid, sid, psv);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     u8 thresh = encounterType == Encounter::OldRod ? 25 : encounterType == Encounter::GoodRod ? 50 : encounterType == Encounter::SuperRod ? 75 : 0;
     u8 adjustedThresh = encounterType == Encounter::OldRod ? 90 : encounterType == Encounter::GoodRod ? 100 : encounterType == Encounter::SuperRod ? 100 : 0;
     u8 rock = encounter.getEncounterRate();
@@ -1403,8 +1370,9 @@ QVector<Frame4> Searcher4::searchMethodKSearch(u8 hp, u8 atk, u8 def, u8 spa, u8
             u32 slot = 0, nibble = 0;
 
             frame.setPID(high, low, genderRatio);
-            if (compare.comparePID(frame))
+            if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
             {
+                PROFILE_SCOPE(profile, Stage::ReverseWalk, frames);
                 PokeRNGR testRNG(seed);
                 u16 nextRNG = seed >> 16;
                 u16 nextRNG2 = testRNG.nextUShort();
@@ -1688,7 +1656,7 @@ QVector<Frame4> Searcher4::searchMethodKSearch(u8 hp, u8 atk, u8 def, u8 spa, u8
                     }
 
                     frame.setPID(buffer + choppedPID, genderRatio);
-                    if (!compare.comparePID(frame))
+                    if (!PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
                     {
                         continue;
                     }
@@ -1712,15 +1680,10 @@ QVector<Frame4> Searcher4::searchChainedShiny(u8 hp, u8 atk, u8 def, u8 spa, u8
     Frame4 frame(tid, sid, psv);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
 
     QVector<u16> calls(15);
     u16 low, high;
@@ -1738,7 +1701,7 @@ QVector<Frame4> Searcher4::searchChainedShiny(u8 hp, u8 atk, u8 def, u8 spa, u8
         high = chainedPIDHigh(calls[13], low, tid, sid);
         frame.setPID(high, low, genderRatio);
 
-        if (compare.comparePID(frame))
+        if (PROFILE_FILTER(profile, Stage::PIDFilter, compare.comparePID(frame)))
         {
             rng.nextUInt();
             frame.setSeed(rng.nextUInt());
@@ -1760,15 +1723,10 @@ QVector<Frame4> Searcher4::searchWondercardIVs(u8 hp, u8 atk, u8 def, u8 spa, u8
     Frame4 frame(tid, sid, psv);
     frame.setIVs(hp, atk, def, spa, spd, spe);
 
-    if (!compare.compareHiddenPower(frame))
-    {
-        return frames;
-    }
-
     u32 first = (hp | (atk << 5) | (def << 10)) << 16;
     u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
 
-    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    QVector<u32> seeds = PROFILE_CALL(profile, Stage::SeedRecovery, 1, cache.recoverLower16BitsIV(first, second));
     for (const auto &seed : seeds)
     {
         // Setup normal frame
@@ -0,0 +1,92 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SeedtoTimeCalc4.hpp"
+
+SeedtoTimeCalc4::SeedtoTimeCalc4(u32 seed, Game version, const QVector<bool> &roamers, const QVector<u8> &routes)
+{
+    ab = seed >> 24;
+    cd = (seed >> 16) & 0xFF;
+    efgh = seed & 0xFFFF;
+    this->version = version;
+    this->roamers = roamers;
+    this->routes = routes;
+}
+
+bool SeedtoTimeCalc4::isValid() const
+{
+    return cd < 24;
+}
+
+// ab is (month * day + minute + second) & 0xFF
+// Since minute + second can be at most 118 each valid date fixes the sum of the minute and second directly
+QVector<DateTime> SeedtoTimeCalc4::generate(u32 year, bool forceSecond, int forcedSecond) const
+{
+    QVector<DateTime> results;
+
+    // The delay shrinks by one for every year past 2000, years that would make it negative have no results
+    int delay = static_cast<int>(efgh) - static_cast<int>(year - 2000);
+    if (!isValid() || delay < 0)
+    {
+        return results;
+    }
+
+    for (int month = 1; month < 13; month++)
+    {
+        int maxDays = QDate(static_cast<int>(year), month, 1).daysInMonth();
+        for (int day = 1; day <= maxDays; day++)
+        {
+            int sum = (ab - month * day) & 0xFF;
+            if (sum > 118)
+            {
+                continue;
+            }
+
+            int minMinute = forceSecond ? sum - forcedSecond : qMax(0, sum - 59);
+            int maxMinute = forceSecond ? sum - forcedSecond : qMin(59, sum);
+
+            for (int minute = qMax(0, minMinute); minute <= qMin(59, maxMinute); minute++)
+            {
+                QDateTime dateTime(QDate(static_cast<int>(year), month, day), QTime(cd, minute, sum - minute));
+                results.append(DateTime(dateTime, static_cast<u32>(delay), version, roamers, routes));
+            }
+        }
+    }
+
+    return results;
+}
+
+QVector<DateTime> SeedtoTimeCalc4::calibrate(int minusDelay, int plusDelay, int minusSecond, int plusSecond, const DateTime &target)
+{
+    QDateTime time = target.getDateTime();
+    u32 delay = target.getDelay();
+
+    QVector<DateTime> results;
+    for (int i = -minusSecond; i <= plusSecond; i++)
+    {
+        QDateTime offset = time.addSecs(i);
+        // Skip offsets that would wrap the delay below zero
+        for (int j = qMax(-minusDelay, -static_cast<int>(delay)); j <= plusDelay; j++)
+        {
+            results.append(DateTime(offset, delay + j, target.getVersion(), target.getInfo()));
+        }
+    }
+
+    return results;
+}
@@ -0,0 +1,44 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEEDTOTIMECALC4_HPP
+#define SEEDTOTIMECALC4_HPP
+
+#include <Core/Gen4/DateTime.hpp>
+
+class SeedtoTimeCalc4
+{
+
+public:
+    SeedtoTimeCalc4(u32 seed, Game version, const QVector<bool> &roamers = QVector<bool>(3), const QVector<u8> &routes = QVector<u8>(3));
+    bool isValid() const;
+    QVector<DateTime> generate(u32 year, bool forceSecond = false, int forcedSecond = 0) const;
+    static QVector<DateTime> calibrate(int minusDelay, int plusDelay, int minusSecond, int plusSecond, const DateTime &target);
+
+private:
+    u8 ab;
+    u8 cd;
+    u32 efgh;
+    Game version;
+    QVector<bool> roamers;
+    QVector<u8> routes;
+
+};
+
+#endif // SEEDTOTIMECALC4_HPP
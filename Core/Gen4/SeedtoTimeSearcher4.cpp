@@ -0,0 +1,76 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QTimer>
+#include "SeedtoTimeSearcher4.hpp"
+#include <Core/Util/SearchScheduler.hpp>
+
+SeedtoTimeSearcher4::SeedtoTimeSearcher4(const SeedtoTimeCalc4 &calc, u32 minYear, u32 maxYear, bool forceSecond, int forcedSecond) :
+    calc(calc)
+{
+    this->minYear = minYear;
+    this->maxYear = maxYear;
+    this->forceSecond = forceSecond;
+    this->forcedSecond = forcedSecond;
+    searching = false;
+    cancel = false;
+    job = -1;
+
+    connect(this, &SeedtoTimeSearcher4::finished, this, [ = ]
+    {
+        searching = false;
+        emit updateProgress(results.takeAll(), progress.sample());
+        QTimer::singleShot(1000, this, &SeedtoTimeSearcher4::deleteLater);
+    });
+}
+
+void SeedtoTimeSearcher4::startSearch()
+{
+    if (!searching)
+    {
+        progress.start(maxYear - minYear + 1);
+        searching = true;
+        cancel = false;
+
+        auto *timer = new QTimer(this);
+        connect(this, &SeedtoTimeSearcher4::finished, timer, &QTimer::stop);
+        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(results.take(), progress.sample()); });
+        timer->start(1000);
+
+        job = SearchScheduler::getInstance().submit(static_cast<int>(maxYear - minYear + 1), [ = ](int chunk) { search(chunk); }, [ = ](bool) { emit finished(); });
+    }
+}
+
+void SeedtoTimeSearcher4::cancelSearch()
+{
+    cancel = true;
+    SearchScheduler::getInstance().cancel(job);
+}
+
+// Each chunk is one year
+void SeedtoTimeSearcher4::search(int chunk)
+{
+    if (cancel)
+    {
+        return;
+    }
+
+    results.add(chunk, calc.generate(minYear + static_cast<u32>(chunk), forceSecond, forcedSecond));
+    progress.add();
+}
@@ -0,0 +1,57 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEEDTOTIMESEARCHER4_HPP
+#define SEEDTOTIMESEARCHER4_HPP
+
+#include <QObject>
+#include <Core/Gen4/SeedtoTimeCalc4.hpp>
+#include <Core/Util/ChunkResults.hpp>
+#include <Core/Util/SearchProgress.hpp>
+
+class SeedtoTimeSearcher4 : public QObject
+{
+    Q_OBJECT
+
+signals:
+    void finished();
+    void updateProgress(const QVector<DateTime> &, const ProgressReport &progress);
+
+public:
+    SeedtoTimeSearcher4(const SeedtoTimeCalc4 &calc, u32 minYear, u32 maxYear, bool forceSecond, int forcedSecond);
+    void startSearch();
+
+public slots:
+    void cancelSearch();
+
+private:
+    SeedtoTimeCalc4 calc;
+    u32 minYear, maxYear;
+    bool forceSecond;
+    int forcedSecond;
+    ChunkResults<DateTime> results;
+    bool searching, cancel;
+    int job;
+    SearchProgress progress;
+
+    void search(int chunk);
+
+};
+
+#endif // SEEDTOTIMESEARCHER4_HPP
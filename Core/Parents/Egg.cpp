@@ -33,3 +33,8 @@ void Egg::setSeed(const u32 &value)
 {
     seed = value;
 }
+
+StageProfile Egg::getProfile() const
+{
+    return profile;
+}
@@ -23,6 +23,7 @@
 #include <QVector>
 #include <Core/Parents/FrameCompare.hpp>
 #include <Core/Util/Method.hpp>
+#include <Core/Util/StageProfile.hpp>
 
 class Egg
 {
@@ -31,6 +32,7 @@ public:
     void setEverstoneNature(const u32 &value);
     u32 getSeed() const;
     void setSeed(const u32 &value);
+    StageProfile getProfile() const;
 
 protected:
     u16 psv{};
@@ -42,6 +44,7 @@ protected:
     u32 initialFrame{};
     u32 maxResults{};
     u32 everstoneNature{};
+    mutable StageProfile profile;
 
 };
 
@@ -21,43 +21,38 @@
 #include <Core/Util/Nature.hpp>
 #include <Core/Util/Power.hpp>
 
-QString Frame::getGenderString()
+QString Frame::getGenderString() const
 {
     switch (gender)
     {
         case 1:
-            return "♂";
+            return QStringLiteral("♂");
         case 2:
-            return "♀";
+            return QStringLiteral("♀");
         case 0:
         default:
-            return "-";
+            return QStringLiteral("-");
     }
 }
 
-QString Frame::getNatureString()
+QString Frame::getNatureString() const
 {
     return Nature::getNature(nature);
 }
 
-QString Frame::getPowerString()
+QString Frame::getPowerString() const
 {
     return Power::getPower(hidden);
 }
 
-QString Frame::getShinyString()
+QString Frame::getShinyString() const
 {
-    return shiny ? "!!!" : "";
+    return shiny ? QStringLiteral("!!!") : QString();
 }
 
 void Frame::setIVs(u8 iv1, u8 iv2, u8 iv3, u8 iv4, u8 iv5, u8 iv6)
 {
-    ivs[0] = iv1;
-    ivs[1] = iv2;
-    ivs[2] = iv3;
-    ivs[3] = iv4;
-    ivs[4] = iv5;
-    ivs[5] = iv6;
+    ivs = iv1 | (iv2 << 5) | (iv3 << 10) | (iv4 << 15) | (iv5 << 20) | (iv6 << 25);
     calculateHidden();
     calculatePower();
 }
@@ -71,12 +66,7 @@ void Frame::setIDs(u16 tid, u16 sid, u16 psv)
 
 void Frame::setIVs(u16 iv1, u16 iv2)
 {
-    ivs[0] = iv1 & 0x1f;
-    ivs[1] = (iv1 >> 5) & 0x1f;
-    ivs[2] = (iv1 >> 10) & 0x1f;
-    ivs[3] = (iv2 >> 5) & 0x1f;
-    ivs[4] = (iv2 >> 10) & 0x1f;
-    ivs[5] = iv2 & 0x1f;
+    ivs = (iv1 & 0x7fff) | (((iv2 >> 5) & 0x3ff) << 15) | ((iv2 & 0x1f) << 25);
     calculateHidden();
     calculatePower();
 }
@@ -88,7 +78,7 @@ u32 Frame::getFrame() const
 
 u8 Frame::getIV(int index) const
 {
-    return ivs.at(index);
+    return (ivs >> (5 * index)) & 0x1f;
 }
 
 u16 Frame::getTID() const
@@ -103,7 +93,21 @@ u16 Frame::getSID() const
 
 QChar Frame::getInheritance(int index) const
 {
-    return inheritance.at(index);
+    switch ((inheritance >> (2 * index)) & 3)
+    {
+        case 1:
+            return 'A';
+        case 2:
+            return 'B';
+        default:
+            return QChar();
+    }
+}
+
+void Frame::setInheritance(int index, QChar value)
+{
+    u8 parent = value == 'A' ? 1 : value == 'B' ? 2 : 0;
+    inheritance = (inheritance & ~(3 << (2 * index))) | (parent << (2 * index));
 }
 
 u8 Frame::getPower() const
@@ -188,10 +192,15 @@ void Frame::setLeadType(const Lead &value)
 
 void Frame::calculateHidden()
 {
-    hidden = ((((ivs.at(0) & 1) + 2 * (ivs.at(1) & 1) + 4 * (ivs.at(2) & 1) + 8 * (ivs.at(5) & 1) + 16 * (ivs.at(3) & 1) + 32 * (ivs.at(4) & 1)) * 15) / 63);
+    hidden = ((((getIV(0) & 1) + 2 * (getIV(1) & 1) + 4 * (getIV(2) & 1) + 8 * (getIV(5) & 1) + 16 * (getIV(3) & 1) + 32 * (getIV(4) & 1)) * 15) / 63);
 }
 
 void Frame::calculatePower()
 {
-    power = 30 + ((((ivs.at(0) >> 1) & 1) + 2 * ((ivs.at(1) >> 1) & 1) + 4 * ((ivs.at(2) >> 1) & 1) + 8 * ((ivs.at(5) >> 1) & 1) + 16 * ((ivs.at(3) >> 1) & 1) + 32 * ((ivs.at(4) >> 1) & 1)) * 40 / 63);
+    power = 30 + ((((getIV(0) >> 1) & 1) + 2 * ((getIV(1) >> 1) & 1) + 4 * ((getIV(2) >> 1) & 1) + 8 * ((getIV(5) >> 1) & 1) + 16 * ((getIV(3) >> 1) & 1) + 32 * ((getIV(4) >> 1) & 1)) * 40 / 63);
+}
+
+void Frame::setIV(int index, u8 value)
+{
+    ivs = (ivs & ~(0x1f << (5 * index))) | (value << (5 * index));
 }
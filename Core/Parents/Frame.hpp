@@ -30,10 +30,10 @@ class Frame
 {
 
 public:
-    QString getGenderString();
-    QString getNatureString();
-    QString getPowerString();
-    QString getShinyString();
+    QString getGenderString() const;
+    QString getNatureString() const;
+    QString getPowerString() const;
+    QString getShinyString() const;
     void setIVs(u8 iv1, u8 iv2, u8 iv3, u8 iv4, u8 iv5, u8 iv6);
     void setIDs(u16 tid, u16 sid, u16 psv);
     void setIVs(u16 iv1, u16 iv2);
@@ -42,6 +42,7 @@ public:
     u16 getTID() const;
     u16 getSID() const;
     QChar getInheritance(int index) const;
+    void setInheritance(int index, QChar value);
     u8 getPower() const;
     u32 getPID() const;
     u8 getAbility() const;
@@ -60,24 +61,25 @@ public:
     void setLeadType(const Lead &value);
 
 protected:
-    QVector<u8> ivs = QVector<u8>(6);
-    QVector<QChar> inheritance = QVector<QChar>(6);
+    u32 frame{};
+    u32 pid{};
+    u32 ivs{}; // 5 bits per IV in HP, Atk, Def, SpA, SpD, Spe order
+    Encounter encounterType{};
+    Lead leadType = Lead::None;
+    u16 inheritance{}; // 2 bits per IV, 0 is not inherited, 1 is parent A, 2 is parent B
+    u16 psv{};
+    u16 sid{};
+    u16 tid{};
     u8 ability{};
     u8 encounterSlot{};
-    Encounter encounterType;
-    u32 frame{};
     u8 gender{};
     u8 hidden{};
-    Lead leadType = Lead::None;
+    u8 level{};
     u8 nature{};
-    u32 pid{};
     u8 power{};
-    u16 psv{};
     bool shiny{};
-    u16 sid{};
-    u16 tid{};
-    u8 level{};
 
+    void setIV(int index, u8 value);
     void calculateHidden();
     void calculatePower();
 
@@ -17,8 +17,15 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <QJsonArray>
+#include <QPair>
+#include <QtAlgorithms>
 #include "FrameCompare.hpp"
 #include <Core/Util/Nature.hpp>
+#include <algorithm>
+
+// High bit of each of the six IV bytes, used to compare every IV at once
+#define LANES 0x808080808080
 
 FrameCompare::FrameCompare(int gender, int ability, bool shiny, bool skip, const QVector<u8> &min, const QVector<u8> &max, const QVector<bool> &natures, const QVector<bool> &powers, const QVector<bool> &encounters)
 {
@@ -27,90 +34,158 @@ FrameCompare::FrameCompare(int gender, int ability, bool shiny, bool skip, const
     this->shiny = shiny;
     this->skip = skip;
 
-    this->min = min;
-    this->max = max;
+    if (!min.isEmpty() && !max.isEmpty())
+    {
+        this->min = 0;
+        this->max = 0;
+        for (u8 i = 0; i < 6; i++)
+        {
+            this->min |= static_cast<u64>(min.at(i)) << (8 * i);
+            this->max |= static_cast<u64>(max.at(i)) << (8 * i);
+        }
+    }
 
     if (!natures.isEmpty())
     {
-        this->natures.resize(25);
+        this->natures = 0;
         for (u8 i = 0; i < 25; i++)
         {
-            this->natures[Nature::getAdjustedNature(i)] = natures.at(i);
+            if (natures.at(i))
+            {
+                this->natures |= 1 << Nature::getAdjustedNature(i);
+            }
         }
     }
 
-    this->powers = powers;
-    this->encounters = encounters;
-}
-
-bool FrameCompare::comparePID(const Frame &frame) const
-{
-    if (skip)
+    if (!powers.isEmpty())
     {
-        return true;
+        this->powers = 0;
+        for (u8 i = 0; i < powers.size(); i++)
+        {
+            if (powers.at(i))
+            {
+                this->powers |= 1 << i;
+            }
+        }
     }
 
-    if (shiny && !frame.getShiny())
+    if (!encounters.isEmpty())
     {
-        return false;
+        this->encounters = 0;
+        for (u8 i = 0; i < encounters.size(); i++)
+        {
+            if (encounters.at(i))
+            {
+                this->encounters |= 1 << i;
+            }
+        }
     }
 
-    if (!natures.at(frame.getNature()))
+    plan();
+}
+
+FrameCompare::FrameCompare(const QJsonObject &data)
+{
+    gender = data["gender"].toInt();
+    ability = data["ability"].toInt();
+    shiny = data["shiny"].toBool();
+    skip = data["skip"].toBool();
+
+    QJsonArray minIVs = data["min"].toArray();
+    QJsonArray maxIVs = data["max"].toArray();
+    if (minIVs.size() == 6 && maxIVs.size() == 6)
     {
-        return false;
+        min = 0;
+        max = 0;
+        for (u8 i = 0; i < 6; i++)
+        {
+            min |= static_cast<u64>(minIVs.at(i).toInt()) << (8 * i);
+            max |= static_cast<u64>(maxIVs.at(i).toInt()) << (8 * i);
+        }
     }
 
-    if (ability != 0 && ability - 1 != frame.getAbility())
+    natures = static_cast<u32>(data["natures"].toInt(0x1FFFFFF));
+    powers = static_cast<u16>(data["powers"].toInt(0xFFFF));
+    encounters = static_cast<u16>(data["encounters"].toInt(0xFFFF));
+
+    plan();
+}
+
+QVector<u8> FrameCompare::getMin() const
+{
+    QVector<u8> ivs;
+    for (u8 i = 0; i < 6; i++)
     {
-        return false;
+        ivs.append((min >> (8 * i)) & 0xff);
     }
+    return ivs;
+}
 
-    if (!compareGender(frame))
+QVector<u8> FrameCompare::getMax() const
+{
+    QVector<u8> ivs;
+    for (u8 i = 0; i < 6; i++)
     {
-        return false;
+        ivs.append((max >> (8 * i)) & 0xff);
     }
+    return ivs;
+}
 
-    return true;
+bool FrameCompare::comparePID(const Frame &frame) const
+{
+    return runChecks(pidChecks, frame);
 }
 
 bool FrameCompare::compareIVs(const Frame &frame) const
+{
+    return runChecks(ivChecks, frame);
+}
+
+// Early out on the two raw IV calls before they are unpacked into a frame
+bool FrameCompare::compareIVs(u16 iv1, u16 iv2) const
 {
     if (skip)
     {
         return true;
     }
 
-    if (!powers.at(frame.getHidden()))
-    {
-        return false;
-    }
-
-    for (int i = 0; i < 6; i++)
-    {
-        u8 iv = frame.getIV(i);
+    u8 hp = iv1 & 0x1f;
+    u8 atk = (iv1 >> 5) & 0x1f;
+    u8 def = (iv1 >> 10) & 0x1f;
+    u8 spa = (iv2 >> 5) & 0x1f;
+    u8 spd = (iv2 >> 10) & 0x1f;
+    u8 spe = iv2 & 0x1f;
 
-        if (iv < min[i] || iv > max[i])
-        {
-            return false;
-        }
-    }
+    u64 ivs = static_cast<u64>(hp) | static_cast<u64>(atk) << 8 | static_cast<u64>(def) << 16 | static_cast<u64>(spa) << 24 |
+              static_cast<u64>(spd) << 32 | static_cast<u64>(spe) << 40;
 
-    return true;
+    return compareIVs(ivs) && compareHiddenPower(hp, atk, def, spa, spd, spe);
 }
 
 bool FrameCompare::compareNature(const Frame &frame) const
 {
-    return natures.at(frame.getNature());
+    return natures & (1 << frame.getNature());
 }
 
 bool FrameCompare::compareHiddenPower(const Frame &frame) const
 {
-    return powers.at(frame.getHidden());
+    return powers & (1 << frame.getHidden());
+}
+
+bool FrameCompare::compareHiddenPower(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const
+{
+    if (powers == 0xFFFF)
+    {
+        return true;
+    }
+
+    u8 hidden = ((((hp & 1) + 2 * (atk & 1) + 4 * (def & 1) + 8 * (spe & 1) + 16 * (spa & 1) + 32 * (spd & 1)) * 15) / 63);
+    return powers & (1 << hidden);
 }
 
 bool FrameCompare::compareSlot(const Frame &frame) const
 {
-    return encounters.at(frame.getEncounterSlot());
+    return encounters & (1 << frame.getEncounterSlot());
 }
 
 bool FrameCompare::compareGender(const Frame &frame) const
@@ -120,20 +195,163 @@ bool FrameCompare::compareGender(const Frame &frame) const
 
 bool FrameCompare::compareFrame(const Frame &frame) const
 {
+    return runChecks(frameChecks, frame);
+}
+
+QJsonObject FrameCompare::getJson() const
+{
+    QJsonArray minIVs;
+    QJsonArray maxIVs;
+    for (u8 i = 0; i < 6; i++)
+    {
+        minIVs.append(static_cast<int>((min >> (8 * i)) & 0xff));
+        maxIVs.append(static_cast<int>((max >> (8 * i)) & 0xff));
+    }
+
+    QJsonObject data;
+    data["gender"] = gender;
+    data["ability"] = ability;
+    data["shiny"] = shiny;
+    data["skip"] = skip;
+    data["min"] = minIVs;
+    data["max"] = maxIVs;
+    data["natures"] = static_cast<int>(natures);
+    data["powers"] = powers;
+    data["encounters"] = encounters;
+    return data;
+}
+
+// Orders the active checks so the ones least likely to pass run first
+void FrameCompare::plan()
+{
+    pidChecks.clear();
+    ivChecks.clear();
+    frameChecks.clear();
+
     if (skip)
     {
-        return true;
+        return;
     }
 
-    if (!comparePID(frame))
+    QVector<QPair<double, Check>> checks;
+
+    if (shiny)
+    {
+        checks.append(qMakePair(8.0 / 65536, Check::Shiny));
+    }
+
+    if (natures != 0x1FFFFFF)
+    {
+        checks.append(qMakePair(qPopulationCount(natures) / 25.0, Check::Nature));
+    }
+
+    if (ability != 0)
+    {
+        checks.append(qMakePair(0.5, Check::Ability));
+    }
+
+    if (gender != 0)
     {
-        return false;
+        checks.append(qMakePair(0.5, Check::Gender));
     }
 
-    if (!compareIVs(frame))
+    if (powers != 0xFFFF)
     {
-        return false;
+        checks.append(qMakePair(qPopulationCount(powers) / 16.0, Check::HiddenPower));
+    }
+
+    if (min != 0 || max != 0x1F1F1F1F1F1F)
+    {
+        double chance = 1;
+        for (u8 i = 0; i < 6; i++)
+        {
+            int low = (min >> (8 * i)) & 0xff;
+            int high = (max >> (8 * i)) & 0xff;
+            chance *= high < low ? 0 : (high - low + 1) / 32.0;
+        }
+        checks.append(qMakePair(chance, Check::IVs));
+    }
+
+    std::stable_sort(checks.begin(), checks.end(), [](const QPair<double, Check> &check1, const QPair<double, Check> &check2)
+    {
+        return check1.first < check2.first;
+    });
+
+    for (const auto &check : checks)
+    {
+        if (check.second == Check::HiddenPower || check.second == Check::IVs)
+        {
+            ivChecks.append(check.second);
+        }
+        else
+        {
+            pidChecks.append(check.second);
+        }
+        frameChecks.append(check.second);
+    }
+}
+
+bool FrameCompare::runChecks(const QVector<Check> &checks, const Frame &frame) const
+{
+    for (const auto &check : checks)
+    {
+        switch (check)
+        {
+            case Check::Shiny:
+                if (!frame.getShiny())
+                {
+                    return false;
+                }
+                break;
+            case Check::Nature:
+                if (!compareNature(frame))
+                {
+                    return false;
+                }
+                break;
+            case Check::Ability:
+                if (ability - 1 != frame.getAbility())
+                {
+                    return false;
+                }
+                break;
+            case Check::Gender:
+                if (gender != frame.getGender())
+                {
+                    return false;
+                }
+                break;
+            case Check::HiddenPower:
+                if (!compareHiddenPower(frame))
+                {
+                    return false;
+                }
+                break;
+            case Check::IVs:
+            {
+                u64 ivs = 0;
+                for (u8 i = 0; i < 6; i++)
+                {
+                    ivs |= static_cast<u64>(frame.getIV(i)) << (8 * i);
+                }
+
+                if (!compareIVs(ivs))
+                {
+                    return false;
+                }
+                break;
+            }
+        }
     }
 
     return true;
 }
+
+// Each byte holds one IV, setting the high bit before subtracting keeps a lane from borrowing out of its neighbour
+// A lane passes when its high bit survives both subtractions
+bool FrameCompare::compareIVs(u64 ivs) const
+{
+    u64 lower = ((ivs | LANES) - min) & LANES;
+    u64 upper = ((max | LANES) - ivs) & LANES;
+    return (lower & upper) == LANES;
+}
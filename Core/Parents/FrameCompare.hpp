@@ -20,6 +20,7 @@
 #ifndef FRAMECOMPARE_HPP
 #define FRAMECOMPARE_HPP
 
+#include <QJsonObject>
 #include <QVector>
 #include <Core/Parents/Frame.hpp>
 
@@ -30,24 +31,47 @@ public:
     FrameCompare() = default;
     FrameCompare(int gender, int ability, bool shiny, bool skip, const QVector<u8> &min, const QVector<u8> &max,
                  const QVector<bool> &natures, const QVector<bool> &powers, const QVector<bool> &encounters);
+    explicit FrameCompare(const QJsonObject &data);
+    QVector<u8> getMin() const;
+    QVector<u8> getMax() const;
     bool comparePID(const Frame &frame) const;
     bool compareIVs(const Frame &frame) const;
+    bool compareIVs(u16 iv1, u16 iv2) const;
     bool compareNature(const Frame &frame) const;
     bool compareHiddenPower(const Frame &frame) const;
+    bool compareHiddenPower(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe) const;
     bool compareSlot(const Frame &frame) const;
     bool compareGender(const Frame &frame) const;
     bool compareFrame(const Frame &frame) const;
+    QJsonObject getJson() const;
 
 private:
-    QVector<u8> min;
-    QVector<u8> max;
+    enum Check : u8
+    {
+        Shiny,
+        Nature,
+        Ability,
+        Gender,
+        HiddenPower,
+        IVs
+    };
+
+    u64 min{};
+    u64 max = 0x1F1F1F1F1F1F;
     u8 gender{};
     u8 ability{};
-    QVector<bool> natures;
-    QVector<bool> powers;
-    QVector<bool> encounters;
+    u32 natures = 0x1FFFFFF;
+    u16 powers = 0xFFFF;
+    u16 encounters = 0xFFFF;
     bool shiny{};
     bool skip{};
+    QVector<Check> pidChecks;
+    QVector<Check> ivChecks;
+    QVector<Check> frameChecks;
+
+    void plan();
+    bool runChecks(const QVector<Check> &checks, const Frame &frame) const;
+    bool compareIVs(u64 ivs) const;
 
 };
 
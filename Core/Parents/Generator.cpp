@@ -48,3 +48,8 @@ void Generator::setSynchNature(const u8 &value)
 {
     synchNature = value;
 }
+
+StageProfile Generator::getProfile() const
+{
+    return profile;
+}
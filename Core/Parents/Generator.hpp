@@ -25,6 +25,7 @@
 #include <Core/Util/Encounter.hpp>
 #include <Core/Util/Lead.hpp>
 #include <Core/Util/Method.hpp>
+#include <Core/Util/StageProfile.hpp>
 
 class Generator
 {
@@ -36,6 +37,7 @@ public:
     void setLeadType(const Lead &value);
     u8 getSynchNature() const;
     void setSynchNature(const u8 &value);
+    StageProfile getProfile() const;
 
 protected:
     u16 psv{};
@@ -51,6 +53,7 @@ protected:
     u32 maxResults{};
     u8 synchNature{};
     u8 cuteCharm{};
+    mutable StageProfile profile;
 
 };
 
@@ -0,0 +1,46 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IDFilter.hpp"
+#include <Core/Util/Utilities.hpp>
+
+IDFilter::IDFilter(bool usePID, u32 pid, bool useTID, u16 tid, bool useSID, u16 sid)
+{
+    this->usePID = usePID;
+    this->pid = pid;
+    this->useTID = useTID;
+    this->tid = tid;
+    this->useSID = useSID;
+    this->sid = sid;
+}
+
+bool IDFilter::compare(u16 tid, u16 sid) const
+{
+    if (useTID && this->tid != tid)
+    {
+        return false;
+    }
+
+    if (useSID && this->sid != sid)
+    {
+        return false;
+    }
+
+    return !usePID || Utilities::shiny(pid, tid, sid);
+}
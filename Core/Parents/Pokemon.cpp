@@ -20,6 +20,46 @@
 #include <QFile>
 #include "Pokemon.hpp"
 
+namespace
+{
+    QVector<Pokemon> readPersonal(const QString &path, int size, u8 gen)
+    {
+        QVector<Pokemon> pokemon;
+        QFile file(path);
+        if (file.open(QIODevice::ReadOnly))
+        {
+            QByteArray data = file.readAll();
+            file.close();
+
+            const auto *bytes = reinterpret_cast<const u8 *>(data.constData());
+            int count = data.size() / size;
+            pokemon.reserve(count);
+
+            for (int i = 0; i < count; i++, bytes += size)
+            {
+                u16 abilityH = 0, formCount = 0, formStatIndex = 0;
+                if (gen == 4)
+                {
+                    formCount = bytes[9];
+                    formStatIndex = static_cast<u16>((bytes[10] << 8) | bytes[11]);
+                }
+                else if (gen == 5)
+                {
+                    abilityH = bytes[9];
+                    formCount = bytes[10];
+                    formStatIndex = static_cast<u16>((bytes[11] << 8) | bytes[12]);
+                }
+
+                // Stored as HP, Atk, Def, Spe, SpA, SpD
+                pokemon.append(Pokemon(bytes[0], bytes[1], bytes[2], bytes[4], bytes[5], bytes[3], bytes[6], bytes[7], bytes[8], abilityH, formCount,
+                                       formStatIndex));
+            }
+        }
+
+        return pokemon;
+    }
+}
+
 Pokemon::Pokemon(u16 hp, u16 atk, u16 def, u16 spa, u16 spd, u16 spe, u16 gender, u16 ability1, u16 ability2, u16 abilityH, u16 formCount, u16 formStatIndex)
 {
     baseHP = hp;
@@ -36,64 +76,22 @@ Pokemon::Pokemon(u16 hp, u16 atk, u16 def, u16 spa, u16 spd, u16 spe, u16 gender
     this->formStatIndex = formStatIndex;
 }
 
-QVector<Pokemon> Pokemon::loadPersonal(u8 gen)
+const QVector<Pokemon> &Pokemon::loadPersonal(u8 gen)
 {
-    QString path;
-    int size = 0;
+    // Decoded on first use and shared by every caller afterwards
     if (gen == 3)
     {
-        path = ":/personal/personal3.bin";
-        size = 9;
+        static const QVector<Pokemon> personal3 = readPersonal(":/personal/personal3.bin", 9, 3);
+        return personal3;
     }
-    else if (gen == 4)
+    if (gen == 4)
     {
-        path = ":/personal/personal4.bin";
-        size = 12;
-    }
-    else if (gen == 5)
-    {
-        path = ":/personal/personal5.bin";
-        size = 13;
-    }
-
-    QVector<Pokemon> pokemon;
-    QFile file(path);
-    if (file.open(QIODevice::ReadOnly))
-    {
-        QByteArray data = file.readAll();
-        file.close();
-
-        while (data.size() > 0)
-        {
-            u16 hp = data.mid(0, 1).toHex().toUShort(nullptr, 16);
-            u16 atk = data.mid(1, 1).toHex().toUShort(nullptr, 16);
-            u16 def = data.mid(2, 1).toHex().toUShort(nullptr, 16);
-            u16 spe = data.mid(3, 1).toHex().toUShort(nullptr, 16);
-            u16 spa = data.mid(4, 1).toHex().toUShort(nullptr, 16);
-            u16 spd = data.mid(5, 1).toHex().toUShort(nullptr, 16);
-            u16 gender = data.mid(6, 1).toHex().toUShort(nullptr, 16);
-            u16 ability1 = data.mid(7, 1).toHex().toUShort(nullptr, 16);
-            u16 ability2 = data.mid(8, 1).toHex().toUShort(nullptr, 16);
-            u16 abilityH = 0, formCount = 0, formStatIndex = 0;
-
-            if (gen == 4)
-            {
-                formCount = data.mid(9, 1).toHex().toUShort(nullptr, 16);
-                formStatIndex = data.mid(10, 2).toHex().toUShort(nullptr, 16);
-            }
-            else if (gen == 5)
-            {
-                abilityH = data.mid(9, 1).toHex().toUShort(nullptr, 16);
-                formCount = data.mid(10, 1).toHex().toUShort(nullptr, 16);
-                formStatIndex = data.mid(11, 2).toHex().toUShort(nullptr, 16);
-            }
-
-            pokemon.append(Pokemon(hp, atk, def, spa, spd, spe, gender, ability1, ability2, abilityH, formCount, formStatIndex));
-            data = data.mid(size);
-        }
+        static const QVector<Pokemon> personal4 = readPersonal(":/personal/personal4.bin", 12, 4);
+        return personal4;
     }
 
-    return pokemon;
+    static const QVector<Pokemon> personal5 = readPersonal(":/personal/personal5.bin", 13, 5);
+    return personal5;
 }
 
 u16 Pokemon::getBaseHP() const
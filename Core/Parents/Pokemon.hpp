@@ -29,7 +29,7 @@ class Pokemon
 public:
     Pokemon() = default;
     Pokemon(u16 hp, u16 atk, u16 def, u16 spa, u16 spd, u16 spe, u16 gender, u16 ability1, u16 ability2, u16 abilityH = 0, u16 formCount = 0, u16 formStatIndex = 0);
-    static QVector<Pokemon> loadPersonal(u8 gen);
+    static const QVector<Pokemon> &loadPersonal(u8 gen);
     u16 getBaseHP() const;
     u16 getBaseAtk() const;
     u16 getBaseDef() const;
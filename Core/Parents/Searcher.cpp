@@ -48,3 +48,8 @@ void Searcher::setLeadType(const Lead &value)
 {
     leadType = value;
 }
+
+StageProfile Searcher::getProfile() const
+{
+    return profile;
+}
@@ -25,6 +25,7 @@
 #include <Core/Util/Encounter.hpp>
 #include <Core/Util/Lead.hpp>
 #include <Core/Util/Method.hpp>
+#include <Core/Util/StageProfile.hpp>
 
 class Searcher
 {
@@ -36,6 +37,7 @@ public:
     void setFrameType(const Method &value);
     Lead getLeadType() const;
     void setLeadType(const Lead &value);
+    StageProfile getProfile() const;
 
 protected:
     u16 psv{};
@@ -47,6 +49,7 @@ protected:
     Lead leadType = Lead::None;
     u8 synchNature{};
     u8 cuteCharm{};
+    mutable StageProfile profile;
 
 };
 
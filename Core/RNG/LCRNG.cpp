@@ -29,9 +29,17 @@ LCRNG::LCRNG(u32 add, u32 mult, u32 seed, u32 frames)
 
 void LCRNG::advanceFrames(u32 frames)
 {
-    for (u32 i = 0; i < frames; i++)
+    // Square the step each bit so large jumps only take log2(frames) steps
+    u32 jumpMult = mult;
+    u32 jumpAdd = add;
+    for (; frames != 0; frames >>= 1)
     {
-        seed = seed * mult + add;
+        if (frames & 1)
+        {
+            seed = seed * jumpMult + jumpAdd;
+        }
+        jumpAdd *= jumpMult + 1;
+        jumpMult *= jumpMult;
     }
 }
 
@@ -0,0 +1,118 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QVector>
+#include "MTKernel.hpp"
+
+#define LOWERMASK   0x7FFFFFFF
+#define MATRIX      0x9908B0DF
+#define UPPERMASK   0x80000000
+
+namespace
+{
+    using Kernel = void (*)(u32 *);
+
+    struct Dispatch
+    {
+        Kernel kernel;
+        const char *name;
+    };
+
+    void shuffleScalar(u32 *mt)
+    {
+        u32 y;
+        u16 i = 0;
+
+        for (; i < 227; i++)
+        {
+            y = (mt[i] & UPPERMASK) | (mt[i + 1] & LOWERMASK);
+            mt[i] = mt[i + 397] ^ (y >> 1) ^ (-(y & 1) & MATRIX);
+        }
+
+        for (; i < 623; i++)
+        {
+            y = (mt[i] & UPPERMASK) | (mt[i + 1] & LOWERMASK);
+            mt[i] = mt[i - 227] ^ (y >> 1) ^ (-(y & 1) & MATRIX);
+        }
+
+        y = (mt[623] & UPPERMASK) | (mt[0] & LOWERMASK);
+        mt[623] = mt[396] ^ (y >> 1) ^ (-(y & 1) & MATRIX);
+    }
+
+    QVector<Dispatch> getAvailable()
+    {
+        QVector<Dispatch> kernels = { { shuffleScalar, "scalar" } };
+#ifdef SIMD_KERNELS
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sse2"))
+        {
+            kernels.append({ MTKernel::shuffleSSE2, "sse2" });
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            kernels.append({ MTKernel::shuffleAVX2, "avx2" });
+        }
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            kernels.append({ MTKernel::shuffleAVX512, "avx512" });
+        }
+#endif
+        return kernels;
+    }
+
+    // The widest kernel the CPU supports is picked on first use
+    Dispatch &getDispatch()
+    {
+        static Dispatch dispatch = getAvailable().last();
+        return dispatch;
+    }
+}
+
+void MTKernel::shuffle(u32 *mt)
+{
+    getDispatch().kernel(mt);
+}
+
+const char *MTKernel::getName()
+{
+    return getDispatch().name;
+}
+
+QStringList MTKernel::getKernels()
+{
+    QStringList names;
+    for (const auto &kernel : getAvailable())
+    {
+        names.append(kernel.name);
+    }
+    return names;
+}
+
+bool MTKernel::setKernel(const QString &name)
+{
+    for (const auto &kernel : getAvailable())
+    {
+        if (name == kernel.name)
+        {
+            getDispatch() = kernel;
+            return true;
+        }
+    }
+    return false;
+}
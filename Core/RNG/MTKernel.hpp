@@ -0,0 +1,49 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef MTKERNEL_HPP
+#define MTKERNEL_HPP
+
+#include <QStringList>
+#include <Core/Util/Global.hpp>
+
+// Regeneration of the 624 word Mersenne Twister state. The SIMD variants are only
+// built when Core is configured with its per-ISA kernels and are picked at runtime.
+namespace MTKernel
+{
+    void shuffle(u32 *mt);
+    const char *getName();
+    QStringList getKernels();
+
+    // Overrides the runtime choice, only meant for benchmarks and verification while nothing else runs
+    bool setKernel(const QString &name);
+
+    void shuffleSSE2(u32 *mt);
+    void shuffleAVX2(u32 *mt);
+    void shuffleAVX512(u32 *mt);
+
+    // Updates a single word, used for the steps that do not fill a whole vector
+    inline void twist(u32 *mt, u16 i)
+    {
+        u32 y = (mt[i] & 0x80000000) | (mt[i == 623 ? 0 : i + 1] & 0x7FFFFFFF);
+        mt[i] = mt[i < 227 ? i + 397 : i - 227] ^ (y >> 1) ^ (-(y & 1) & 0x9908B0DF);
+    }
+}
+
+#endif // MTKERNEL_HPP
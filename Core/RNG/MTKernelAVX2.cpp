@@ -0,0 +1,66 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "MTKernel.hpp"
+#include <immintrin.h>
+
+namespace
+{
+    inline __m256i twistLanes(__m256i current, __m256i next, __m256i far)
+    {
+        const __m256i upper = _mm256_set1_epi32(static_cast<int>(0x80000000));
+        const __m256i lower = _mm256_set1_epi32(0x7FFFFFFF);
+        const __m256i matrix = _mm256_set1_epi32(static_cast<int>(0x9908B0DF));
+        const __m256i one = _mm256_set1_epi32(1);
+
+        __m256i y = _mm256_or_si256(_mm256_and_si256(current, upper), _mm256_and_si256(next, lower));
+        __m256i mag = _mm256_and_si256(_mm256_sub_epi32(_mm256_setzero_si256(), _mm256_and_si256(y, one)), matrix);
+        return _mm256_xor_si256(_mm256_xor_si256(far, _mm256_srli_epi32(y, 1)), mag);
+    }
+
+    inline __m256i load(const u32 *mt)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mt));
+    }
+}
+
+void MTKernel::shuffleAVX2(u32 *mt)
+{
+    u16 i = 0;
+
+    // The first 227 words read ahead into words that have not been updated yet
+    for (; i + 8 <= 227; i += 8)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(mt + i), twistLanes(load(mt + i), load(mt + i + 1), load(mt + i + 397)));
+    }
+    for (; i < 227; i++)
+    {
+        twist(mt, i);
+    }
+
+    // The rest read back 227 words, which is further than a vector so no lane depends on another
+    for (; i + 8 <= 623; i += 8)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(mt + i), twistLanes(load(mt + i), load(mt + i + 1), load(mt + i - 227)));
+    }
+    for (; i < 624; i++)
+    {
+        twist(mt, i);
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "MTKernel.hpp"
+#include <immintrin.h>
+
+namespace
+{
+    inline __m512i twistLanes(__m512i current, __m512i next, __m512i far)
+    {
+        const __m512i upper = _mm512_set1_epi32(static_cast<int>(0x80000000));
+        const __m512i lower = _mm512_set1_epi32(0x7FFFFFFF);
+        const __m512i matrix = _mm512_set1_epi32(static_cast<int>(0x9908B0DF));
+        const __m512i one = _mm512_set1_epi32(1);
+
+        __m512i y = _mm512_or_si512(_mm512_and_si512(current, upper), _mm512_and_si512(next, lower));
+        __m512i mag = _mm512_and_si512(_mm512_sub_epi32(_mm512_setzero_si512(), _mm512_and_si512(y, one)), matrix);
+        return _mm512_xor_si512(_mm512_xor_si512(far, _mm512_srli_epi32(y, 1)), mag);
+    }
+
+    inline __m512i load(const u32 *mt)
+    {
+        return _mm512_loadu_si512(reinterpret_cast<const __m512i *>(mt));
+    }
+}
+
+void MTKernel::shuffleAVX512(u32 *mt)
+{
+    u16 i = 0;
+
+    // The first 227 words read ahead into words that have not been updated yet
+    for (; i + 16 <= 227; i += 16)
+    {
+        _mm512_storeu_si512(reinterpret_cast<__m512i *>(mt + i), twistLanes(load(mt + i), load(mt + i + 1), load(mt + i + 397)));
+    }
+    for (; i < 227; i++)
+    {
+        twist(mt, i);
+    }
+
+    // The rest read back 227 words, which is further than a vector so no lane depends on another
+    for (; i + 16 <= 623; i += 16)
+    {
+        _mm512_storeu_si512(reinterpret_cast<__m512i *>(mt + i), twistLanes(load(mt + i), load(mt + i + 1), load(mt + i - 227)));
+    }
+    for (; i < 624; i++)
+    {
+        twist(mt, i);
+    }
+}
@@ -18,6 +18,7 @@
  */
 
 #include "MTRNG.hpp"
+#include <Core/RNG/MTKernel.hpp>
 
 #define LOWERMASK           0x7FFFFFFF
 #define M                   397
@@ -39,23 +40,7 @@ void MT::advanceFrames(u32 frames)
 
 void MT::shuffle()
 {
-    u32 y;
-    u16 i = 0;
-
-    for (; i < 227; i++)
-    {
-        y = (mt.at(i) & UPPERMASK) | (mt.at(i + 1) & LOWERMASK);
-        mt[i] = mt.at(i + M) ^ (y >> 1) ^ mag01.at(y & 0x1);
-    }
-
-    for (; i < 623; ++i)
-    {
-        y = (mt.at(i) & UPPERMASK) | (mt.at(i + 1) & LOWERMASK);
-        mt[i] = mt.at(i - 227) ^ (y >> 1) ^ mag01.at(y & 0x1);
-    }
-
-    y = (mt.at(623) & UPPERMASK) | (mt.at(0) & LOWERMASK);
-    mt[623] = mt.at(396) ^ (y >> 1) ^ mag01.at(y & 0x1);
+    MTKernel::shuffle(mt.data());
 }
 
 void MT::initialize(u32 seed)
@@ -0,0 +1,63 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RNGLIST_HPP
+#define RNGLIST_HPP
+
+#include <Core/Util/Global.hpp>
+
+// Rolling window of the next size 16 bit RNG calls
+// Memory stays fixed regardless of how many frames are generated
+// size must be a power of two and larger than the farthest call a frame looks at
+template <class RNGType, u16 size>
+class RNGList
+{
+    static_assert(size != 0 && (size & (size - 1)) == 0, "RNGList size must be a power of two");
+
+public:
+    RNGList(const RNGType &rng) :
+        rng(rng)
+    {
+        for (u16 &x : list)
+        {
+            x = this->rng.nextUShort();
+        }
+    }
+
+    // Drops the oldest call and pulls the next one from the RNG
+    void advanceFrame()
+    {
+        list[head] = rng.nextUShort();
+        head = (head + 1) & (size - 1);
+    }
+
+    // Call index steps ahead of the current frame
+    u16 at(u16 index) const
+    {
+        return list[(head + index) & (size - 1)];
+    }
+
+private:
+    RNGType rng;
+    u16 list[size];
+    u16 head{};
+
+};
+
+#endif // RNGLIST_HPP
@@ -0,0 +1,167 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RNGWINDOW_HPP
+#define RNGWINDOW_HPP
+
+#include <Core/Util/Global.hpp>
+
+// Rolling window of RNG states shared by consecutive frames
+// Frame n starts its calls one state after frame n - 1, so every frame in the window reads the same states
+// The nature of the PID built from each pair of calls is computed once and reused by every frame that hunts over it
+// size must be a power of two, calls past the window fall back to the RNG
+template <class RNGType, u16 size>
+class RNGWindow
+{
+    static_assert(size > 1 && (size & (size - 1)) == 0, "RNGWindow size must be a power of two");
+
+public:
+    class Cursor
+    {
+
+    public:
+        Cursor(const RNGWindow *window) :
+            window(window)
+        {
+            seed = window->at(0);
+        }
+
+        u32 nextUInt()
+        {
+            if (index < size)
+            {
+                seed = window->at(index);
+            }
+            else
+            {
+                RNGType rng(seed);
+                seed = rng.nextUInt();
+            }
+            index++;
+            return seed;
+        }
+
+        u16 nextUShort()
+        {
+            return nextUInt() >> 16;
+        }
+
+        void advanceFrames(u32 frames)
+        {
+            for (u32 i = 0; i < frames; i++)
+            {
+                nextUInt();
+            }
+        }
+
+        u32 getSeed() const
+        {
+            return seed;
+        }
+
+        // Calls [PID] [PID] until the PID has the given nature
+        u32 huntPID(u8 nature)
+        {
+            u32 calls = 0;
+            return huntPID(nature, calls);
+        }
+
+        u32 huntPID(u8 nature, u32 &calls)
+        {
+            // Skip pairs inside the window by their cached nature
+            while (index + 1 < size && window->pidNature(index) != nature)
+            {
+                index += 2;
+                calls += 2;
+            }
+            if (index <= size)
+            {
+                seed = window->at(index - 1);
+            }
+
+            u32 pid;
+            do
+            {
+                u16 low = nextUShort();
+                u16 high = nextUShort();
+                pid = (high << 16) | low;
+                calls += 2;
+            }
+            while (pid % 25 != nature);
+
+            return pid;
+        }
+
+    private:
+        const RNGWindow *window;
+        u32 seed;
+        u32 index = 1;
+
+    };
+
+    RNGWindow(const RNGType &rng) :
+        rng(rng)
+    {
+        for (u16 i = 0; i < size; i++)
+        {
+            states[i] = this->rng.nextUInt();
+            natures[i] = 0xFF;
+        }
+    }
+
+    // Moves the window to the next frame
+    void advanceFrame()
+    {
+        states[head] = rng.nextUInt();
+        natures[head] = 0xFF;
+        head = (head + 1) & (size - 1);
+    }
+
+    // Calls for the current frame, the first call returns the state one after the frame seed
+    Cursor getCursor() const
+    {
+        return Cursor(this);
+    }
+
+private:
+    RNGType rng;
+    u32 states[size];
+    mutable u8 natures[size];
+    u16 head{};
+
+    u32 at(u32 index) const
+    {
+        return states[(head + index) & (size - 1)];
+    }
+
+    // Nature of the PID made from the calls at index and index + 1
+    u8 pidNature(u32 index) const
+    {
+        u8 &nature = natures[(head + index) & (size - 1)];
+        if (nature == 0xFF)
+        {
+            u32 pid = (at(index + 1) & 0xFFFF0000) | (at(index) >> 16);
+            nature = pid % 25;
+        }
+        return nature;
+    }
+
+};
+
+#endif // RNGWINDOW_HPP
@@ -0,0 +1,75 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef CHUNKRESULTS_HPP
+#define CHUNKRESULTS_HPP
+
+#include <QMap>
+#include <QMutex>
+#include <QVector>
+
+// Collects the results of a scheduled job's chunks, which finish in any order, and hands them out in
+// chunk order so a search lists its results the same way a single thread would have found them
+template <typename T>
+class ChunkResults
+{
+
+public:
+    // Every chunk adds once, even with no results, so the chunks after it can be released
+    void add(int chunk, const QVector<T> &results)
+    {
+        QMutexLocker locker(&mutex);
+        pending.insert(chunk, results);
+        while (!pending.isEmpty() && pending.firstKey() == next)
+        {
+            ready.append(pending.take(next++));
+        }
+    }
+
+    QVector<T> take()
+    {
+        QMutexLocker locker(&mutex);
+        auto data(ready);
+        ready.clear();
+        return data;
+    }
+
+    // Also releases chunks still waiting on an earlier one, for when the job has stopped
+    QVector<T> takeAll()
+    {
+        QMutexLocker locker(&mutex);
+        for (const auto &results : pending)
+        {
+            ready.append(results);
+        }
+        pending.clear();
+
+        auto data(ready);
+        ready.clear();
+        return data;
+    }
+
+private:
+    QMutex mutex;
+    QMap<int, QVector<T>> pending;
+    QVector<T> ready;
+    int next = 0;
+
+};
+
+#endif // CHUNKRESULTS_HPP
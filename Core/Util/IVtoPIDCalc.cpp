@@ -0,0 +1,180 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVtoPIDCalc.hpp"
+#include <Core/RNG/LCRNG.hpp>
+
+IVtoPIDCalc::IVtoPIDCalc(u16 tid) :
+    cache(Method::Method1), cache4(Method::Method4), euclidean(Method::XDColo), euclideanChannel(Method::Channel)
+{
+    this->tid = tid;
+}
+
+QVector<IVtoPIDFrame> IVtoPIDCalc::getSeeds(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 nature) const
+{
+    QVector<IVtoPIDFrame> frames;
+
+    u32 first = (hp | (atk << 5) | (def << 10)) << 16;
+    u32 second = (spe | (spa << 5) | (spd << 10)) << 16;
+
+    searchMethod124(frames, first, second, nature);
+    searchMethod4(frames, first, second, nature);
+    searchMethodXDColo(frames, first, second, nature);
+    searchMethodChannel(frames, hp, atk, def, spa, spd, spe, nature);
+
+    return frames;
+}
+
+// Handles Method 1, Reverse Method 1, Method 2 and the DPPt/HGSS Cute Charm PIDs
+// The recovered seeds only have the top bit of the first IV call cleared
+// so the sister seed with the top bit set is also checked
+void IVtoPIDCalc::searchMethod124(QVector<IVtoPIDFrame> &frames, u32 first, u32 second, u8 nature) const
+{
+    QVector<u32> seeds = cache.recoverLower16BitsIV(first, second);
+    for (const auto &val : seeds)
+    {
+        for (const u32 &flip : { 0u, 0x80000000u })
+        {
+            PokeRNGR rng(val ^ flip);
+
+            u16 rng2 = rng.nextUShort();
+            u16 rng3 = rng.nextUShort();
+            u16 rng4 = rng.nextUShort();
+
+            u32 method1Seed = rng.getSeed();
+            u32 method2Seed = rng.nextUInt();
+
+            // Method 1
+            u32 pid = (rng2 << 16) | rng3;
+            if (pid % 25 == nature)
+            {
+                frames.append(IVtoPIDFrame(method1Seed, pid, (rng2 ^ rng3 ^ tid) & 0xFFF8, Method::Method1));
+            }
+
+            // Reverse Method 1
+            pid = (rng3 << 16) | rng2;
+            if (pid % 25 == nature)
+            {
+                frames.append(IVtoPIDFrame(method1Seed, pid, (rng2 ^ rng3 ^ tid) & 0xFFF8, Method::Method1Reverse));
+            }
+
+            // Method 2
+            pid = (rng3 << 16) | rng4;
+            if (pid % 25 == nature)
+            {
+                frames.append(IVtoPIDFrame(method2Seed, pid, (rng3 ^ rng4 ^ tid) & 0xFFF8, Method::Method2));
+            }
+
+            // Cute Charm DPPt
+            if (rng3 / 0x5556 != 0)
+            {
+                searchCuteCharm(frames, method1Seed, rng2 / 0xA3E, nature, Method::CuteCharmDPPt);
+            }
+
+            // Cute Charm HGSS
+            if (rng3 % 3 != 0)
+            {
+                searchCuteCharm(frames, method1Seed, rng2 % 25, nature, Method::CuteCharmHGSS);
+            }
+        }
+    }
+}
+
+void IVtoPIDCalc::searchMethod4(QVector<IVtoPIDFrame> &frames, u32 first, u32 second, u8 nature) const
+{
+    QVector<u32> seeds = cache4.recoverLower16BitsIV(first, second);
+    for (const auto &val : seeds)
+    {
+        for (const u32 &flip : { 0u, 0x80000000u })
+        {
+            PokeRNGR rng(val ^ flip);
+
+            u16 high = rng.nextUShort();
+            u16 low = rng.nextUShort();
+
+            u32 pid = (high << 16) | low;
+            if (pid % 25 == nature)
+            {
+                frames.append(IVtoPIDFrame(rng.nextUInt(), pid, (high ^ low ^ tid) & 0xFFF8, Method::Method4));
+            }
+        }
+    }
+}
+
+void IVtoPIDCalc::searchMethodXDColo(QVector<IVtoPIDFrame> &frames, u32 first, u32 second, u8 nature) const
+{
+    QVector<QPair<u32, u32>> seeds = euclidean.recoverLower16BitsIV(first, second);
+    for (const auto &pair : seeds)
+    {
+        for (const u32 &flip : { 0u, 0x80000000u })
+        {
+            XDRNG rng(pair.second ^ flip, 1);
+
+            u16 high = rng.nextUShort();
+            u16 low = rng.nextUShort();
+
+            u32 pid = (high << 16) | low;
+            if (pid % 25 == nature)
+            {
+                u32 seed = (pair.first ^ flip) * 0xB9B33155 + 0xA170F641;
+                frames.append(IVtoPIDFrame(seed, pid, (high ^ low ^ tid) & 0xFFF8, Method::XDColo));
+            }
+        }
+    }
+}
+
+void IVtoPIDCalc::searchMethodChannel(QVector<IVtoPIDFrame> &frames, u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 nature) const
+{
+    QVector<u32> seeds = euclideanChannel.recoverLower27BitsChannel(hp, atk, def, spa, spd, spe);
+    for (const auto &seed : seeds)
+    {
+        XDRNGR rng(seed, 3);
+
+        u16 low = rng.nextUShort();
+        u16 high = rng.nextUShort();
+        u16 sid = rng.nextUShort();
+
+        // Determine if PID needs to be XORed
+        if ((low > 7 ? 0 : 1) != (high ^ sid ^ 40122))
+        {
+            high ^= 0x8000;
+        }
+
+        u32 pid = (high << 16) | low;
+        if (pid % 25 == nature)
+        {
+            frames.append(IVtoPIDFrame(rng.nextUInt(), pid, sid, Method::Channel));
+        }
+    }
+}
+
+// Cute Charm buffers the nature by the gender threshold of each gender ratio
+void IVtoPIDCalc::searchCuteCharm(QVector<IVtoPIDFrame> &frames, u32 seed, u8 choppedPID, u8 nature, Method method) const
+{
+    if (choppedPID % 25 != nature)
+    {
+        return;
+    }
+
+    for (u8 buffer : { 0x0, 0x96, 0xC8, 0x4B, 0x32 })
+    {
+        u8 pid = choppedPID + buffer;
+        frames.append(IVtoPIDFrame(seed, pid, (pid ^ tid) & 0xFFF8, method));
+    }
+}
@@ -0,0 +1,49 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef IVTOPIDCALC_HPP
+#define IVTOPIDCALC_HPP
+
+#include <Core/RNG/RNGCache.hpp>
+#include <Core/RNG/RNGEuclidean.hpp>
+#include <Core/Util/IVtoPIDFrame.hpp>
+
+class IVtoPIDCalc
+{
+
+public:
+    IVtoPIDCalc(u16 tid);
+    QVector<IVtoPIDFrame> getSeeds(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 nature) const;
+
+private:
+    RNGCache cache;
+    RNGCache cache4;
+    RNGEuclidean euclidean;
+    RNGEuclidean euclideanChannel;
+    u16 tid;
+
+    void searchMethod124(QVector<IVtoPIDFrame> &frames, u32 first, u32 second, u8 nature) const;
+    void searchMethod4(QVector<IVtoPIDFrame> &frames, u32 first, u32 second, u8 nature) const;
+    void searchMethodXDColo(QVector<IVtoPIDFrame> &frames, u32 first, u32 second, u8 nature) const;
+    void searchMethodChannel(QVector<IVtoPIDFrame> &frames, u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 nature) const;
+    void searchCuteCharm(QVector<IVtoPIDFrame> &frames, u32 seed, u8 choppedPID, u8 nature, Method method) const;
+
+};
+
+#endif // IVTOPIDCALC_HPP
@@ -0,0 +1,58 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVtoPIDFrame.hpp"
+
+IVtoPIDFrame::IVtoPIDFrame(u32 seed, u32 pid, u16 sid, Method method)
+{
+    this->seed = seed;
+    this->pid = pid;
+    this->sid = sid;
+    this->method = method;
+}
+
+u32 IVtoPIDFrame::getSeed() const
+{
+    return seed;
+}
+
+u32 IVtoPIDFrame::getPID() const
+{
+    return pid;
+}
+
+u16 IVtoPIDFrame::getSID() const
+{
+    return sid;
+}
+
+Method IVtoPIDFrame::getMethod() const
+{
+    return method;
+}
+
+u8 IVtoPIDFrame::getAbility() const
+{
+    return pid & 1;
+}
+
+bool IVtoPIDFrame::isMale(u8 genderRatio) const
+{
+    return (pid & 0xFF) > genderRatio;
+}
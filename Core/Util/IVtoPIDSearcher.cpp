@@ -0,0 +1,76 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QTimer>
+#include "IVtoPIDSearcher.hpp"
+#include <Core/Util/SearchScheduler.hpp>
+
+IVtoPIDSearcher::IVtoPIDSearcher(const QVector<QVector<u8>> &ivs, u8 nature, u16 tid) :
+    calc(tid)
+{
+    this->ivs = ivs;
+    this->nature = nature;
+    searching = false;
+    cancel = false;
+    job = -1;
+
+    connect(this, &IVtoPIDSearcher::finished, this, [ = ]
+    {
+        searching = false;
+        emit updateProgress(results.takeAll(), progress.sample());
+        QTimer::singleShot(1000, this, &IVtoPIDSearcher::deleteLater);
+    });
+}
+
+void IVtoPIDSearcher::startSearch()
+{
+    if (!searching)
+    {
+        progress.start(static_cast<u64>(ivs.size()));
+        searching = true;
+        cancel = false;
+
+        auto *timer = new QTimer(this);
+        connect(this, &IVtoPIDSearcher::finished, timer, &QTimer::stop);
+        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(results.take(), progress.sample()); });
+        timer->start(1000);
+
+        job = SearchScheduler::getInstance().submit(ivs.size(), [ = ](int chunk) { search(chunk); }, [ = ](bool) { emit finished(); });
+    }
+}
+
+void IVtoPIDSearcher::cancelSearch()
+{
+    cancel = true;
+    SearchScheduler::getInstance().cancel(job);
+}
+
+// Each chunk is one IV spread, all sharing the calculator's caches
+void IVtoPIDSearcher::search(int chunk)
+{
+    if (cancel)
+    {
+        return;
+    }
+
+    const auto &iv = ivs.at(chunk);
+
+    results.add(chunk, calc.getSeeds(iv.at(0), iv.at(1), iv.at(2), iv.at(3), iv.at(4), iv.at(5), nature));
+    progress.add();
+}
@@ -0,0 +1,56 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef IVTOPIDSEARCHER_HPP
+#define IVTOPIDSEARCHER_HPP
+
+#include <QObject>
+#include <Core/Util/ChunkResults.hpp>
+#include <Core/Util/IVtoPIDCalc.hpp>
+#include <Core/Util/SearchProgress.hpp>
+
+class IVtoPIDSearcher : public QObject
+{
+    Q_OBJECT
+
+signals:
+    void finished();
+    void updateProgress(const QVector<IVtoPIDFrame> &, const ProgressReport &progress);
+
+public:
+    IVtoPIDSearcher(const QVector<QVector<u8>> &ivs, u8 nature, u16 tid);
+    void startSearch();
+
+public slots:
+    void cancelSearch();
+
+private:
+    QVector<QVector<u8>> ivs;
+    u8 nature;
+    IVtoPIDCalc calc;
+    ChunkResults<IVtoPIDFrame> results;
+    bool searching, cancel;
+    int job;
+    SearchProgress progress;
+
+    void search(int chunk);
+
+};
+
+#endif // IVTOPIDSEARCHER_HPP
@@ -52,7 +52,9 @@ enum Method
     Gen4Masuada,
     DPPtIVs,
     HGSSIVs,
-    Gen4Combined
+    Gen4Combined,
+    CuteCharmDPPt,
+    CuteCharmHGSS
 };
 
 #endif // METHOD_HPP
@@ -17,10 +17,17 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <QMutex>
 #include <QTranslator>
 #include <QVector>
 #include "Nature.hpp"
 
+namespace
+{
+    QMutex mutex;
+    QStringList names; // Frame ordered names in the current language
+}
+
 QStringList Nature::getNatures()
 {
     const QStringList natures =
@@ -38,7 +45,18 @@ QStringList Nature::getNatures()
 
 QString Nature::getNature(u8 nature)
 {
-    return getFrameNatures().at(nature);
+    QMutexLocker locker(&mutex);
+    if (names.isEmpty())
+    {
+        names = getFrameNatures();
+    }
+    return names.at(nature);
+}
+
+void Nature::clearNames()
+{
+    QMutexLocker locker(&mutex);
+    names.clear();
 }
 
 QStringList Nature::getFrameNatures()
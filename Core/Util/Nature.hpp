@@ -27,6 +27,7 @@ namespace Nature
 {
     QStringList getNatures();
     QString getNature(u8 nature);
+    void clearNames();
     QStringList getFrameNatures();
     QVector<double> getNatureModifier(u8 nature);
     u8 getAdjustedNature(u8 nature);
@@ -17,9 +17,16 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <QMutex>
 #include <QTranslator>
 #include "Power.hpp"
 
+namespace
+{
+    QMutex mutex;
+    QStringList names; // Names in the current language
+}
+
 QStringList Power::getPowers()
 {
     QStringList powers =
@@ -34,5 +41,16 @@ QStringList Power::getPowers()
 
 QString Power::getPower(u8 power)
 {
-    return getPowers().at(power);
+    QMutexLocker locker(&mutex);
+    if (names.isEmpty())
+    {
+        names = getPowers();
+    }
+    return names.at(power);
+}
+
+void Power::clearNames()
+{
+    QMutexLocker locker(&mutex);
+    names.clear();
 }
@@ -27,6 +27,7 @@ namespace Power
 {
     QStringList getPowers();
     QString getPower(u8 power);
+    void clearNames();
 };
 
 #endif // POWER_HPP
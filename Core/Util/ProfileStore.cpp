@@ -0,0 +1,181 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QCoreApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QSettings>
+#include <QTimer>
+#include "ProfileStore.hpp"
+
+#define PERSIST_DELAY 500
+
+namespace
+{
+    template <typename Profile>
+    QVector<Profile> readProfiles(const QJsonArray &array)
+    {
+        QVector<Profile> list;
+        for (const auto &&i : array)
+        {
+            list.append(Profile(i.toObject()));
+        }
+        return list;
+    }
+
+    template <typename Profile>
+    QJsonArray writeProfiles(const QVector<Profile> &list)
+    {
+        QJsonArray array;
+        for (const auto &profile : list)
+        {
+            array.append(profile.getJson());
+        }
+        return array;
+    }
+
+    template <typename Profile>
+    bool removeFirst(QVector<Profile> &list, const Profile &profile)
+    {
+        int index = list.indexOf(profile);
+        if (index == -1)
+        {
+            return false;
+        }
+        list.removeAt(index);
+        return true;
+    }
+
+    template <typename Profile>
+    bool replaceFirst(QVector<Profile> &list, const Profile &original, const Profile &profile)
+    {
+        int index = list.indexOf(original);
+        if (index == -1 || original == profile)
+        {
+            return false;
+        }
+        list[index] = profile;
+        return true;
+    }
+}
+
+ProfileStore::ProfileStore()
+{
+    QSettings setting;
+    profiles = QJsonDocument::fromJson(setting.value("profiles").toByteArray()).object();
+    profiles3 = readProfiles<Profile3>(profiles["gen3"].toArray());
+    profiles4 = readProfiles<Profile4>(profiles["gen4"].toArray());
+
+    dirty = false;
+    timer = new QTimer(this);
+    timer->setSingleShot(true);
+    timer->setInterval(PERSIST_DELAY);
+    connect(timer, &QTimer::timeout, this, &ProfileStore::flush);
+
+    if (QCoreApplication::instance())
+    {
+        connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this, &ProfileStore::flush);
+    }
+}
+
+ProfileStore &ProfileStore::getInstance()
+{
+    static ProfileStore store;
+    return store;
+}
+
+QVector<Profile3> ProfileStore::getProfiles3() const
+{
+    return profiles3;
+}
+
+QVector<Profile4> ProfileStore::getProfiles4() const
+{
+    return profiles4;
+}
+
+void ProfileStore::addProfile(const Profile3 &profile)
+{
+    profiles3.append(profile);
+    profileChanged(3);
+}
+
+void ProfileStore::addProfile(const Profile4 &profile)
+{
+    profiles4.append(profile);
+    profileChanged(4);
+}
+
+void ProfileStore::removeProfile(const Profile3 &profile)
+{
+    if (removeFirst(profiles3, profile))
+    {
+        profileChanged(3);
+    }
+}
+
+void ProfileStore::removeProfile(const Profile4 &profile)
+{
+    if (removeFirst(profiles4, profile))
+    {
+        profileChanged(4);
+    }
+}
+
+void ProfileStore::updateProfile(const Profile3 &original, const Profile3 &profile)
+{
+    if (replaceFirst(profiles3, original, profile))
+    {
+        profileChanged(3);
+    }
+}
+
+void ProfileStore::updateProfile(const Profile4 &original, const Profile4 &profile)
+{
+    if (replaceFirst(profiles4, original, profile))
+    {
+        profileChanged(4);
+    }
+}
+
+void ProfileStore::flush()
+{
+    timer->stop();
+    if (!dirty)
+    {
+        return;
+    }
+
+    // Other keys in the blob are carried over untouched
+    profiles["gen3"] = writeProfiles(profiles3);
+    profiles["gen4"] = writeProfiles(profiles4);
+
+    QSettings setting;
+    setting.setValue("profiles", QJsonDocument(profiles).toJson());
+    dirty = false;
+}
+
+void ProfileStore::profileChanged(int gen)
+{
+    // Bursts of edits are written back together
+    dirty = true;
+    timer->start();
+
+    emit profilesChanged(gen);
+}
@@ -0,0 +1,64 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PROFILESTORE_HPP
+#define PROFILESTORE_HPP
+
+#include <QJsonObject>
+#include <QObject>
+#include <Core/Gen3/Profile3.hpp>
+#include <Core/Gen4/Profile4.hpp>
+
+class QTimer;
+
+// In-memory copy of the saved profiles, read from settings once and written back shortly after a change
+class ProfileStore : public QObject
+{
+    Q_OBJECT
+
+signals:
+    void profilesChanged(int gen);
+
+public:
+    static ProfileStore &getInstance();
+    QVector<Profile3> getProfiles3() const;
+    QVector<Profile4> getProfiles4() const;
+    void addProfile(const Profile3 &profile);
+    void addProfile(const Profile4 &profile);
+    void removeProfile(const Profile3 &profile);
+    void removeProfile(const Profile4 &profile);
+    void updateProfile(const Profile3 &original, const Profile3 &profile);
+    void updateProfile(const Profile4 &original, const Profile4 &profile);
+
+public slots:
+    void flush();
+
+private:
+    QJsonObject profiles;
+    QVector<Profile3> profiles3;
+    QVector<Profile4> profiles4;
+    QTimer *timer;
+    bool dirty;
+
+    ProfileStore();
+    void profileChanged(int gen);
+
+};
+
+#endif // PROFILESTORE_HPP
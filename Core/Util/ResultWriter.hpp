@@ -0,0 +1,124 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef RESULTWRITER_HPP
+#define RESULTWRITER_HPP
+
+#include <QFile>
+#include <QVariant>
+#include <Core/Util/SessionFile.hpp>
+#include <Core/Util/TableWriter.hpp>
+#include <functional>
+
+// Streams results to disk in the TableWriter layouts, formatting each item
+// as it is appended instead of keeping the results in memory
+template <typename T>
+class ResultWriter
+{
+
+public:
+    ResultWriter(const QString &fileName, TableWriter::Format format, const QStringList &header,
+                 const std::function<QVariant(const T &, int)> &formatter) :
+        file(fileName), format(format), header(header), formatter(formatter)
+    {
+    }
+
+    bool open()
+    {
+        if ((format == TableWriter::Binary && !isRawRecord<T>) || format == TableWriter::Session)
+        {
+            return false;
+        }
+
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            return false;
+        }
+
+        // The row count is the last field of the binary header and is filled in by close()
+        TableWriter::appendHeader(buffer, format, header, sessionRecordType<T>, sizeof(T), 0);
+        countOffset = buffer.size() - static_cast<int>(sizeof(u64));
+        return true;
+    }
+
+    void append(const QVector<T> &items)
+    {
+        for (const T &item : items)
+        {
+            if constexpr (isRawRecord<T>)
+            {
+                if (format == TableWriter::Binary)
+                {
+                    buffer.append(reinterpret_cast<const char *>(&item), sizeof(T));
+                    rows++;
+                    continue;
+                }
+            }
+
+            if (rows > 0)
+            {
+                buffer.append('\n');
+            }
+
+            for (int column = 0; column < header.size(); column++)
+            {
+                TableWriter::appendCell(buffer, format, formatter(item, column).toString(), column == header.size() - 1);
+            }
+            rows++;
+        }
+
+        if (buffer.size() >= 0x100000)
+        {
+            file.write(buffer);
+            buffer.resize(0);
+        }
+    }
+
+    bool close()
+    {
+        bool success = file.write(buffer) == buffer.size();
+        buffer.clear();
+
+        if (format == TableWriter::Binary)
+        {
+            success &= file.seek(countOffset);
+            success &= file.write(reinterpret_cast<const char *>(&rows), sizeof(u64)) == sizeof(u64);
+        }
+
+        file.close();
+        return success;
+    }
+
+    u64 getRows() const
+    {
+        return rows;
+    }
+
+private:
+    QFile file;
+    TableWriter::Format format;
+    QStringList header;
+    std::function<QVariant(const T &, int)> formatter;
+    QByteArray buffer;
+    qint64 countOffset{};
+    u64 rows{};
+
+};
+
+#endif // RESULTWRITER_HPP
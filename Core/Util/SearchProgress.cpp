@@ -0,0 +1,155 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QObject>
+#include "SearchProgress.hpp"
+
+// Weight of the newest sample in the throughput average
+#define SMOOTHING 0.3
+
+namespace
+{
+    QString formatRate(double rate)
+    {
+        if (rate >= 1e9)
+        {
+            return QString::number(rate / 1e9, 'f', 2) + "G";
+        }
+        if (rate >= 1e6)
+        {
+            return QString::number(rate / 1e6, 'f', 2) + "M";
+        }
+        if (rate >= 1e3)
+        {
+            return QString::number(rate / 1e3, 'f', 2) + "K";
+        }
+        return QString::number(rate, 'f', 0);
+    }
+
+    QString formatTime(qint64 seconds)
+    {
+        return QString("%1:%2:%3").arg(seconds / 3600).arg((seconds / 60) % 60, 2, 10, QChar('0')).arg(seconds % 60, 2, 10, QChar('0'));
+    }
+}
+
+ProgressReport::ProgressReport(u64 done, u64 total, double rate)
+{
+    this->done = done;
+    this->total = total;
+    this->rate = rate;
+}
+
+u64 ProgressReport::getDone() const
+{
+    return done;
+}
+
+u64 ProgressReport::getTotal() const
+{
+    return total;
+}
+
+// Items per second, averaged over the recent samples
+double ProgressReport::getRate() const
+{
+    return rate;
+}
+
+double ProgressReport::getFraction() const
+{
+    return total == 0 ? 0.0 : qMin(1.0, static_cast<double>(done) / total);
+}
+
+// Seconds until the search finishes at the current rate, -1 if it can't be estimated yet
+qint64 ProgressReport::getRemaining() const
+{
+    if (done >= total)
+    {
+        return 0;
+    }
+    if (rate <= 0)
+    {
+        return -1;
+    }
+    return static_cast<qint64>((total - done) / rate);
+}
+
+QString ProgressReport::getText() const
+{
+    QString text = QString::number(getFraction() * 100, 'f', 1) + "%";
+
+    if (done < total && rate > 0)
+    {
+        text += QObject::tr(" - %1/s - %2 left").arg(formatRate(rate), formatTime(getRemaining()));
+    }
+
+    return text;
+}
+
+void SearchProgress::start(u64 total)
+{
+    done = 0;
+    this->total = total;
+    timer.start();
+    lastTime = 0;
+    lastDone = 0;
+    rate = 0;
+}
+
+void SearchProgress::add(u64 count)
+{
+    done.fetch_add(count, std::memory_order_relaxed);
+}
+
+// Marks the remaining work as done for searches that can stop early
+void SearchProgress::complete()
+{
+    done = total.load();
+}
+
+u64 SearchProgress::getDone() const
+{
+    return done.load(std::memory_order_relaxed);
+}
+
+u64 SearchProgress::getTotal() const
+{
+    return total.load(std::memory_order_relaxed);
+}
+
+ProgressReport SearchProgress::sample()
+{
+    if (!timer.isValid())
+    {
+        return ProgressReport(getDone(), getTotal(), 0);
+    }
+
+    u64 current = getDone();
+    qint64 now = timer.elapsed();
+
+    if (now > lastTime)
+    {
+        double instant = (current - lastDone) * 1000.0 / (now - lastTime);
+        rate = lastTime == 0 ? instant : SMOOTHING * instant + (1 - SMOOTHING) * rate;
+        lastTime = now;
+        lastDone = current;
+    }
+
+    return ProgressReport(current, getTotal(), rate);
+}
@@ -0,0 +1,73 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SEARCHPROGRESS_HPP
+#define SEARCHPROGRESS_HPP
+
+#include <QElapsedTimer>
+#include <QString>
+#include <atomic>
+#include <Core/Util/Global.hpp>
+
+// How far a search has come, passed to the UI with each batch of results
+class ProgressReport
+{
+
+public:
+    ProgressReport() = default;
+    ProgressReport(u64 done, u64 total, double rate);
+    u64 getDone() const;
+    u64 getTotal() const;
+    double getRate() const;
+    double getFraction() const;
+    qint64 getRemaining() const;
+    QString getText() const;
+
+private:
+    u64 done{};
+    u64 total{};
+    double rate{};
+
+};
+
+// Work counter of a background search. Worker threads add to it without locking while the thread
+// running the progress timer samples it for a smoothed throughput and the time remaining.
+class SearchProgress
+{
+
+public:
+    SearchProgress() = default;
+    void start(u64 total);
+    void add(u64 count = 1);
+    void complete();
+    u64 getDone() const;
+    u64 getTotal() const;
+    ProgressReport sample();
+
+private:
+    std::atomic<u64> done{};
+    std::atomic<u64> total{};
+    QElapsedTimer timer;
+    qint64 lastTime{};
+    u64 lastDone{};
+    double rate{};
+
+};
+
+#endif // SEARCHPROGRESS_HPP
@@ -0,0 +1,287 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+#include "SearchScheduler.hpp"
+
+namespace
+{
+    class ChunkRunner : public QRunnable
+    {
+
+    public:
+        explicit ChunkRunner(const std::function<void()> &function) : function(function)
+        {
+        }
+
+        void run() override
+        {
+            function();
+        }
+
+    private:
+        std::function<void()> function;
+
+    };
+}
+
+// Job of the chunk running on this thread, for jobs that end themselves early
+thread_local SearchScheduler::Job *SearchScheduler::current = nullptr;
+
+SearchScheduler::SearchScheduler()
+{
+    foreground = nullptr;
+    threads = qMax(1, QThread::idealThreadCount());
+    active = 0;
+    nextID = 0;
+    QThreadPool::globalInstance()->setMaxThreadCount(threads);
+}
+
+// Stops handing out chunks on exit and waits for the running ones to return, unless the global
+// pool was already torn down and did the waiting itself
+SearchScheduler::~SearchScheduler()
+{
+    {
+        QMutexLocker locker(&mutex);
+        for (Job *job : jobs)
+        {
+            job->cancelled = true;
+        }
+    }
+    if (QThreadPool *pool = QThreadPool::globalInstance())
+    {
+        pool->waitForDone();
+    }
+
+    qDeleteAll(jobs);
+}
+
+SearchScheduler &SearchScheduler::getInstance()
+{
+    static SearchScheduler scheduler;
+    return scheduler;
+}
+
+// Queues a job of chunks 0 to chunks - 1. Each chunk is passed to work on a pool thread, and once
+// the last one returns, or the job is cancelled and its running chunks return, done is called with
+// whether the job was cancelled.
+int SearchScheduler::submit(int chunks, const std::function<void(int)> &work, const std::function<void(bool)> &done)
+{
+    QMutexLocker locker(&mutex);
+
+    int id = nextID++;
+    if (chunks <= 0)
+    {
+        locker.unlock();
+        done(false);
+        return id;
+    }
+
+    auto *job = new Job;
+    job->id = id;
+    job->owner = foreground;
+    job->chunks = chunks;
+    job->next = 0;
+    job->running = 0;
+    job->maxThreads = 0;
+    job->paused = false;
+    job->cancelled = false;
+    job->work = work;
+    job->done = done;
+    jobs.append(job);
+
+    dispatch();
+    return id;
+}
+
+void SearchScheduler::pause(int job)
+{
+    QMutexLocker locker(&mutex);
+    if (Job *item = findJob(job))
+    {
+        item->paused = true;
+    }
+}
+
+void SearchScheduler::resume(int job)
+{
+    QMutexLocker locker(&mutex);
+    if (Job *item = findJob(job))
+    {
+        item->paused = false;
+        dispatch();
+    }
+}
+
+// Chunks already running are left to return on their own; callers stop them early through their own flag
+void SearchScheduler::cancel(int job)
+{
+    QMutexLocker locker(&mutex);
+    Job *item = findJob(job);
+    if (item == nullptr || item->cancelled)
+    {
+        return;
+    }
+
+    item->cancelled = true;
+    if (item->running == 0)
+    {
+        auto done = removeJob(item);
+        dispatch();
+        locker.unlock();
+        done();
+    }
+}
+
+// Called from inside a chunk, so it works before submit has returned the job's id
+void SearchScheduler::cancelCurrent()
+{
+    QMutexLocker locker(&mutex);
+    if (current != nullptr)
+    {
+        current->cancelled = true;
+    }
+}
+
+// Limits how many chunks of the job run at once, 0 for no limit
+void SearchScheduler::setMaxThreads(int job, int maxThreads)
+{
+    QMutexLocker locker(&mutex);
+    if (Job *item = findJob(job))
+    {
+        item->maxThreads = maxThreads;
+        dispatch();
+    }
+}
+
+// Jobs submitted while window has focus are run ahead of the others
+void SearchScheduler::setForeground(const QObject *window)
+{
+    QMutexLocker locker(&mutex);
+    foreground = window;
+}
+
+int SearchScheduler::getThreadCount()
+{
+    QMutexLocker locker(&mutex);
+    return threads;
+}
+
+void SearchScheduler::setThreadCount(int count)
+{
+    QMutexLocker locker(&mutex);
+    threads = qMax(1, count);
+    QThreadPool::globalInstance()->setMaxThreadCount(threads);
+    dispatch();
+}
+
+SearchScheduler::Job *SearchScheduler::findJob(int id) const
+{
+    for (Job *job : jobs)
+    {
+        if (job->id == id)
+        {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+SearchScheduler::Job *SearchScheduler::nextJob() const
+{
+    Job *best = nullptr;
+    for (Job *job : jobs)
+    {
+        if (job->paused || job->cancelled || job->next == job->chunks || (job->maxThreads > 0 && job->running >= job->maxThreads))
+        {
+            continue;
+        }
+
+        if (foreground != nullptr && job->owner == foreground)
+        {
+            return job;
+        }
+
+        if (best == nullptr)
+        {
+            best = job;
+        }
+    }
+    return best;
+}
+
+// Hands chunks to idle threads, must be called with the mutex held
+void SearchScheduler::dispatch()
+{
+    while (active < threads)
+    {
+        Job *job = nextJob();
+        if (job == nullptr)
+        {
+            return;
+        }
+
+        int chunk = job->next++;
+        job->running++;
+        active++;
+
+        QThreadPool::globalInstance()->start(new ChunkRunner([ = ]
+        {
+            current = job;
+            job->work(chunk);
+            current = nullptr;
+            finishChunk(job);
+        }));
+    }
+}
+
+void SearchScheduler::finishChunk(Job *job)
+{
+    QMutexLocker locker(&mutex);
+
+    job->running--;
+    active--;
+
+    std::function<void()> done;
+    if (job->running == 0 && (job->cancelled || job->next == job->chunks))
+    {
+        done = removeJob(job);
+    }
+
+    dispatch();
+    locker.unlock();
+
+    if (done)
+    {
+        done();
+    }
+}
+
+// Takes a finished job off the list, returning its done callback to be called once the mutex is released
+std::function<void()> SearchScheduler::removeJob(Job *job)
+{
+    jobs.removeOne(job);
+
+    auto done = job->done;
+    bool cancelled = job->cancelled;
+    delete job;
+
+    return [ = ] { done(cancelled); };
+}
@@ -0,0 +1,80 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+#ifndef SEARCHSCHEDULER_HPP
+#define SEARCHSCHEDULER_HPP
+
+#include <QList>
+#include <QMutex>
+#include <functional>
+
+class QObject;
+
+// Runs every background search as a job split into numbered chunks. Whenever a thread frees up it
+// takes the next chunk of the most urgent job: jobs started from the foreground window first, then
+// older jobs before newer ones. Chunks run on the global thread pool, the same one QtConcurrent uses
+// for sorting and exporting, so searches and those share the CPU instead of oversubscribing it.
+class SearchScheduler
+{
+
+public:
+    static SearchScheduler &getInstance();
+    int submit(int chunks, const std::function<void(int)> &work, const std::function<void(bool)> &done);
+    void pause(int job);
+    void resume(int job);
+    void cancel(int job);
+    void cancelCurrent();
+    void setMaxThreads(int job, int maxThreads);
+    void setForeground(const QObject *window);
+    int getThreadCount();
+    void setThreadCount(int count);
+
+private:
+    struct Job
+    {
+        int id;
+        const QObject *owner;
+        int chunks;
+        int next;
+        int running;
+        int maxThreads;
+        bool paused;
+        bool cancelled;
+        std::function<void(int)> work;
+        std::function<void(bool)> done;
+    };
+
+    static thread_local Job *current;
+    QMutex mutex;
+    QList<Job *> jobs;
+    const QObject *foreground;
+    int threads;
+    int active;
+    int nextID;
+
+    SearchScheduler();
+    ~SearchScheduler();
+    Job *findJob(int id) const;
+    Job *nextJob() const;
+    void dispatch();
+    void finishChunk(Job *job);
+    std::function<void()> removeJob(Job *job);
+
+};
+
+#endif // SEARCHSCHEDULER_HPP
@@ -0,0 +1,187 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QDateTime>
+#include <QJsonDocument>
+#include "SessionFile.hpp"
+
+#define SESSION_MAGIC "PKFS"
+#define SESSION_VERSION 2
+#define FIXED_HEADER 32
+
+namespace
+{
+    template <typename Type>
+    void appendValue(QByteArray &buffer, Type value)
+    {
+        buffer.append(reinterpret_cast<const char *>(&value), sizeof(Type));
+    }
+
+    template <typename Type>
+    Type readValue(const uchar *buffer)
+    {
+        Type value;
+        std::memcpy(&value, buffer, sizeof(Type));
+        return value;
+    }
+}
+
+SessionFile::~SessionFile()
+{
+    if (data != nullptr)
+    {
+        file.unmap(data);
+    }
+}
+
+bool SessionFile::open(const QString &fileName)
+{
+    file.setFileName(fileName);
+    if (!file.open(QIODevice::ReadOnly) || file.size() < FIXED_HEADER)
+    {
+        return false;
+    }
+
+    qint64 size = file.size();
+    data = file.map(0, size);
+    if (data == nullptr || std::memcmp(data, SESSION_MAGIC, 4) != 0 || readValue<u32>(data + 4) != SESSION_VERSION)
+    {
+        return false;
+    }
+
+    recordType = readValue<u32>(data + 8);
+    recordSize = readValue<u32>(data + 12);
+    columns = readValue<u32>(data + 16);
+    u64 count = readValue<u64>(data + 20);
+    qint64 length = readValue<u32>(data + 28);
+
+    // Every size is checked in 64 bit so a corrupt header cannot wrap around
+    if (length > size - FIXED_HEADER)
+    {
+        return false;
+    }
+
+    dataOffset = (FIXED_HEADER + length + 63) & ~63;
+    if (static_cast<u64>(columns) * 4 != recordSize || count > INT_MAX
+            || dataOffset + static_cast<qint64>(count) * recordSize > size)
+    {
+        return false;
+    }
+
+    rows = static_cast<int>(count);
+    provenance = QByteArray(reinterpret_cast<const char *>(data + FIXED_HEADER), static_cast<int>(length));
+    return true;
+}
+
+u32 SessionFile::getRecordType() const
+{
+    return recordType;
+}
+
+u32 SessionFile::getRecordSize() const
+{
+    return recordSize;
+}
+
+int SessionFile::getRows() const
+{
+    return rows;
+}
+
+QJsonObject SessionFile::getProvenance() const
+{
+    return QJsonDocument::fromJson(provenance).object();
+}
+
+QJsonObject SessionFile::createProvenance(const QJsonObject &profile, Method method, const FrameCompare &compare)
+{
+    QJsonObject data;
+    data["profile"] = profile;
+    data["method"] = method;
+    data["compare"] = compare.getJson();
+    data["created"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+    return data;
+}
+
+QByteArray SessionFile::createHeader(u32 recordType, u32 recordSize, int rows, const QJsonObject &provenance)
+{
+    QByteArray json = QJsonDocument(provenance).toJson(QJsonDocument::Compact);
+
+    QByteArray header(SESSION_MAGIC, 4);
+    appendValue<u32>(header, SESSION_VERSION);
+    appendValue<u32>(header, recordType);
+    appendValue<u32>(header, recordSize);
+    appendValue<u32>(header, recordSize / 4);
+    appendValue<u64>(header, static_cast<u64>(rows));
+    appendValue<u32>(header, static_cast<u32>(json.size()));
+    header.append(json);
+    header.append((64 - header.size() % 64) % 64, '\0');
+    return header;
+}
+
+SessionWriter::SessionWriter(const QString &fileName, u32 recordType, u32 recordSize, int rows, const QJsonObject &provenance) :
+    file(fileName)
+{
+    this->recordSize = recordSize;
+    this->rows = rows;
+    written = 0;
+    header = SessionFile::createHeader(recordType, recordSize, rows, provenance);
+}
+
+bool SessionWriter::open()
+{
+    if (!file.open(QIODevice::WriteOnly) || !file.resize(header.size() + static_cast<qint64>(rows) * recordSize))
+    {
+        return false;
+    }
+    return file.write(header) == header.size();
+}
+
+// Each word of the records is gathered into one buffer and written to its column
+bool SessionWriter::append(const char *records, int count)
+{
+    column.resize(count * 4);
+    for (u32 word = 0; word < recordSize / 4; word++)
+    {
+        char *out = column.data();
+        for (int i = 0; i < count; i++)
+        {
+            std::memcpy(out + i * 4, records + static_cast<qint64>(i) * recordSize + word * 4, 4);
+        }
+
+        qint64 offset = header.size() + (static_cast<qint64>(word) * rows + written) * 4;
+        if (!file.seek(offset) || file.write(column) != column.size())
+        {
+            return false;
+        }
+    }
+
+    written += count;
+    return true;
+}
+
+void SessionWriter::close()
+{
+    file.close();
+}
+
+void SessionWriter::remove()
+{
+    file.remove();
+}
@@ -0,0 +1,115 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SESSIONFILE_HPP
+#define SESSIONFILE_HPP
+
+#include <QFile>
+#include <QJsonObject>
+#include <Core/Parents/FrameCompare.hpp>
+#include <Core/Util/Global.hpp>
+#include <Core/Util/Method.hpp>
+#include <climits>
+#include <cstring>
+#include <type_traits>
+
+class Frame3;
+class Frame4;
+
+// Tags the rows stored in a session, frames of the same size are still different records
+template <typename T>
+constexpr u32 sessionRecordType = 0;
+template <>
+constexpr u32 sessionRecordType<Frame3> = 1;
+template <>
+constexpr u32 sessionRecordType<Frame4> = 2;
+
+// Records written byte for byte need a type tag and no padding bytes
+template <typename T>
+constexpr bool isRawRecord = sessionRecordType<T> != 0 && std::has_unique_object_representations<T>::value;
+
+// Search results saved to disk in columns so they can be mapped back in without loading them.
+// Layout (little endian):
+//   "PKFS", u32 version, u32 record type, u32 record size, u32 columns, u64 rows,
+//   u32 provenance size, provenance as compact JSON, padding to a 64 byte boundary,
+//   then one column of rows u32 values for every 32 bit word of the record
+class SessionFile
+{
+
+public:
+    SessionFile() = default;
+    ~SessionFile();
+    SessionFile(const SessionFile &) = delete;
+    SessionFile &operator=(const SessionFile &) = delete;
+    bool open(const QString &fileName);
+    u32 getRecordType() const;
+    u32 getRecordSize() const;
+    int getRows() const;
+    QJsonObject getProvenance() const;
+    static QJsonObject createProvenance(const QJsonObject &profile, Method method, const FrameCompare &compare);
+    static QByteArray createHeader(u32 recordType, u32 recordSize, int rows, const QJsonObject &provenance);
+
+    template <typename T>
+    T getFrame(int row) const
+    {
+        static_assert(std::is_trivially_copyable<T>::value && sizeof(T) % 4 == 0, "Sessions store raw frames");
+
+        T frame;
+        auto *bytes = reinterpret_cast<uchar *>(&frame);
+        for (u32 column = 0; column < sizeof(T) / 4; column++)
+        {
+            std::memcpy(bytes + column * 4, data + dataOffset + (static_cast<qint64>(column) * rows + row) * 4, 4);
+        }
+        return frame;
+    }
+
+private:
+    QFile file;
+    uchar *data = nullptr;
+    qint64 dataOffset{};
+    u32 recordType{};
+    u32 recordSize{};
+    u32 columns{};
+    int rows{};
+    QByteArray provenance;
+
+};
+
+// Transposes records into the columns of a session file as they are appended
+class SessionWriter
+{
+
+public:
+    SessionWriter(const QString &fileName, u32 recordType, u32 recordSize, int rows, const QJsonObject &provenance);
+    bool open();
+    bool append(const char *records, int count);
+    void close();
+    void remove();
+
+private:
+    QFile file;
+    QByteArray header;
+    QByteArray column;
+    u32 recordSize;
+    int rows;
+    int written;
+
+};
+
+#endif // SESSIONFILE_HPP
@@ -0,0 +1,108 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QObject>
+#include "StageProfile.hpp"
+
+bool StageProfile::isEnabled()
+{
+#ifdef PROFILE_STAGES
+    return true;
+#else
+    return false;
+#endif
+}
+
+QString StageProfile::getName(Stage stage)
+{
+    switch (stage)
+    {
+        case Stage::SeedRecovery:
+            return QObject::tr("Seed recovery");
+        case Stage::PIDFilter:
+            return QObject::tr("PID filter");
+        case Stage::ReverseWalk:
+            return QObject::tr("Reverse walk");
+        case Stage::NatureLock:
+            return QObject::tr("Nature lock");
+        case Stage::InitialSeeds:
+            return QObject::tr("Initial seeds");
+        case Stage::Generation:
+            return QObject::tr("Generation");
+        default:
+            return QString();
+    }
+}
+
+void StageProfile::add(Stage stage, u64 in, u64 out, u64 nanoseconds)
+{
+    Counter &counter = counters[static_cast<int>(stage)];
+    counter.calls++;
+    counter.in += in;
+    counter.out += out;
+    counter.nanoseconds += nanoseconds;
+}
+
+void StageProfile::merge(const StageProfile &other)
+{
+    for (int i = 0; i < static_cast<int>(Stage::Count); i++)
+    {
+        counters[i].calls += other.counters[i].calls;
+        counters[i].in += other.counters[i].in;
+        counters[i].out += other.counters[i].out;
+        counters[i].nanoseconds += other.counters[i].nanoseconds;
+    }
+}
+
+void StageProfile::reset()
+{
+    for (auto &counter : counters)
+    {
+        counter = Counter();
+    }
+}
+
+bool StageProfile::isEmpty() const
+{
+    for (const auto &counter : counters)
+    {
+        if (counter.calls != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+QVector<StageStats> StageProfile::getStats() const
+{
+    QVector<StageStats> stats;
+
+    for (int i = 0; i < static_cast<int>(Stage::Count); i++)
+    {
+        const Counter &counter = counters[i];
+        if (counter.calls != 0)
+        {
+            auto stage = static_cast<Stage>(i);
+            stats.append({ stage, getName(stage), counter.calls, counter.in, counter.out, counter.nanoseconds });
+        }
+    }
+
+    return stats;
+}
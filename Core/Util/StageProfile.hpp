@@ -0,0 +1,137 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef STAGEPROFILE_HPP
+#define STAGEPROFILE_HPP
+
+#include <QString>
+#include <QVector>
+#include <chrono>
+#include <Core/Util/Global.hpp>
+
+// Steps of a search or generation that get their own counters
+enum class Stage : u8
+{
+    SeedRecovery,
+    PIDFilter,
+    ReverseWalk,
+    NatureLock,
+    InitialSeeds,
+    Generation,
+    Count
+};
+
+struct StageStats
+{
+    Stage stage;
+    QString name;
+    u64 calls;
+    u64 in;
+    u64 out;
+    u64 nanoseconds;
+};
+
+// Candidates in, candidates out and time spent for each stage of one searcher or generator.
+// The counters are only updated when Core is built with CONFIG+=profile_stages, every
+// PROFILE_* macro compiles down to the bare expression otherwise.
+// A profile belongs to the object running the search and is not synchronized.
+class StageProfile
+{
+
+public:
+    static bool isEnabled();
+    static QString getName(Stage stage);
+    void add(Stage stage, u64 in, u64 out, u64 nanoseconds = 0);
+    void merge(const StageProfile &other);
+    void reset();
+    bool isEmpty() const;
+    QVector<StageStats> getStats() const;
+
+    inline bool filter(Stage stage, bool pass)
+    {
+        add(stage, 1, pass ? 1 : 0);
+        return pass;
+    }
+
+    template <typename Function>
+    inline auto record(Stage stage, u64 in, Function function) -> decltype(function())
+    {
+        u64 start = now();
+        auto results = function();
+        add(stage, in, static_cast<u64>(results.size()), now() - start);
+        return results;
+    }
+
+    static inline u64 now()
+    {
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+private:
+    struct Counter
+    {
+        u64 calls;
+        u64 in;
+        u64 out;
+        u64 nanoseconds;
+    };
+
+    Counter counters[static_cast<int>(Stage::Count)] {};
+
+};
+
+// Times the rest of the enclosing scope as one candidate, counting what it appended to results
+template <typename Container>
+class StageScope
+{
+
+public:
+    StageScope(StageProfile &profile, Stage stage, const Container &results) :
+        profile(profile), results(results), stage(stage), size(results.size()), start(StageProfile::now())
+    {
+    }
+
+    ~StageScope()
+    {
+        profile.add(stage, 1, static_cast<u64>(results.size() - size), StageProfile::now() - start);
+    }
+
+    StageScope(const StageScope &) = delete;
+    StageScope &operator=(const StageScope &) = delete;
+
+private:
+    StageProfile &profile;
+    const Container &results;
+    Stage stage;
+    int size;
+    u64 start;
+
+};
+
+#ifdef PROFILE_STAGES
+#define PROFILE_FILTER(profile, stage, pass) (profile).filter(stage, pass)
+#define PROFILE_CALL(profile, stage, in, call) (profile).record(stage, in, [&] { return call; })
+#define PROFILE_SCOPE(profile, stage, results) StageScope<decltype(results)> stageScope(profile, stage, results)
+#else
+#define PROFILE_FILTER(profile, stage, pass) (pass)
+#define PROFILE_CALL(profile, stage, in, call) (call)
+#define PROFILE_SCOPE(profile, stage, results)
+#endif
+
+#endif // STAGEPROFILE_HPP
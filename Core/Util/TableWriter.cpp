@@ -0,0 +1,86 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "TableWriter.hpp"
+
+namespace
+{
+    template <typename Type>
+    void appendValue(QByteArray &buffer, Type value)
+    {
+        buffer.append(reinterpret_cast<const char *>(&value), sizeof(Type));
+    }
+
+    void appendCSV(QByteArray &buffer, const QString &text)
+    {
+        if (text.contains(',') || text.contains('"') || text.contains('\n'))
+        {
+            QString quoted = text;
+            buffer.append('"');
+            buffer.append(quoted.replace("\"", "\"\"").toUtf8());
+            buffer.append('"');
+        }
+        else
+        {
+            buffer.append(text.toUtf8());
+        }
+    }
+}
+
+void TableWriter::appendHeader(QByteArray &buffer, Format format, const QStringList &header, u32 recordType, u32 recordSize, u64 rows)
+{
+    if (format == Format::Binary)
+    {
+        // Version 2 replaced the display column names with the record type
+        buffer.append("PKFB", 4);
+        appendValue<u32>(buffer, 2);
+        appendValue<u32>(buffer, recordType);
+        appendValue<u32>(buffer, recordSize);
+        appendValue<u64>(buffer, rows);
+    }
+    else
+    {
+        for (int column = 0; column < header.size(); column++)
+        {
+            appendCell(buffer, format, header.at(column), column == header.size() - 1);
+        }
+        buffer.append('\n');
+    }
+}
+
+void TableWriter::appendCell(QByteArray &buffer, Format format, const QString &text, bool last)
+{
+    if (text.isEmpty())
+    {
+        buffer.append('-');
+    }
+    else if (format == Format::CSV)
+    {
+        appendCSV(buffer, text);
+    }
+    else
+    {
+        buffer.append(text.toUtf8());
+    }
+
+    if (!last)
+    {
+        buffer.append(format == Format::CSV ? ',' : '\t');
+    }
+}
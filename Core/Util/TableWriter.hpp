@@ -0,0 +1,47 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TABLEWRITER_HPP
+#define TABLEWRITER_HPP
+
+#include <QByteArray>
+#include <QStringList>
+#include <Core/Util/Global.hpp>
+
+// Text and binary layouts shared by the table export and the batch runner.
+// TSV and CSV use the display text of each cell. Binary writes the header
+// "PKFB", a u32 version, a u32 record type, a u32 record size and a u64 row
+// count, followed by the records. A record is the in-memory frame with no
+// padding bytes, its layout is fixed by the record type and the version, the
+// same tags SessionFile uses. Session writes the records in columns instead.
+namespace TableWriter
+{
+    enum Format
+    {
+        TSV,
+        CSV,
+        Binary,
+        Session
+    };
+
+    void appendHeader(QByteArray &buffer, Format format, const QStringList &header, u32 recordType, u32 recordSize, u64 rows);
+    void appendCell(QByteArray &buffer, Format format, const QString &text, bool last);
+}
+
+#endif // TABLEWRITER_HPP
@@ -18,131 +18,141 @@
  */
 
 #include <QFile>
+#include <QHash>
+#include <QMutex>
 #include <QSettings>
 #include <QTextStream>
 #include "Translator.hpp"
+#include <Core/Gen4/Frame4.hpp>
+#include <Core/Util/Nature.hpp>
+#include <Core/Util/Power.hpp>
 
-QStringList Translator::getCharacteristic()
+namespace
 {
-    QStringList names;
-    QSettings setting;
-    QFile file(QString(":/text/characteristic_%1.txt").arg(setting.value("settings/locale", "en").toString()));
-    if (file.open(QIODevice::ReadOnly))
-    {
-        QTextStream ts(&file);
-        ts.setCodec("UTF-8");
+    QMutex mutex;
+    QString currentLocale;
+    QHash<QString, QStringList> tables; // Line tables by resource path
+    QHash<QString, QVector<QString>> locationTables; // Location names indexed by location number
 
-        while (!ts.atEnd())
+    QString getLocale()
+    {
+        if (currentLocale.isEmpty())
         {
-            names.append(ts.readLine());
+            QSettings setting;
+            currentLocale = setting.value("settings/locale", "en").toString();
         }
-        file.close();
+        return currentLocale;
     }
-    return names;
-}
-
-QStringList Translator::getSpecies(const QVector<u16> &nums)
-{
-    QStringList species;
 
-    QSettings setting;
-    QFile file(QString(":/text/species_%1.txt").arg(setting.value("settings/locale", "en").toString()));
-
-    if (file.open(QIODevice::ReadOnly))
+    QStringList readLines(const QString &path)
     {
-        QTextStream ts(&file);
-        ts.setCodec("UTF-8");
-
-        QStringList input;
-        while (!ts.atEnd())
+        QStringList lines;
+        QFile file(path);
+        if (file.open(QIODevice::ReadOnly))
         {
-            input << ts.readLine();
-        }
-        file.close();
-
-        for (const u16 &x : nums)
-        {
-            species.append(input.at(x - 1));
+            QTextStream ts(&file);
+            ts.setCodec("UTF-8");
+
+            while (!ts.atEnd())
+            {
+                lines.append(ts.readLine());
+            }
+            file.close();
         }
+        return lines;
     }
 
-    return species;
-}
-
-QStringList Translator::getLocationsGen3(const QVector<u8> &nums, Game game)
-{
-    QStringList locations;
-
-    QString version;
-    if (game & Game::FRLG)
-    {
-        version = "frlg";
-    }
-    else
+    // Called with the mutex held
+    const QStringList &getTable(const QString &name)
     {
-        version = "rse";
-    }
+        QString path = QString(":/text/%1_%2.txt").arg(name, getLocale());
 
-    QSettings setting;
-    QFile file(QString(":/text/%1_%2.txt").arg(version, setting.value("settings/locale", "en").toString()));
+        auto table = tables.find(path);
+        if (table == tables.end())
+        {
+            table = tables.insert(path, readLines(path));
+        }
+        return *table;
+    }
 
-    if (file.open(QIODevice::ReadOnly))
+    // Called with the mutex held
+    const QVector<QString> &getLocationTable(const QString &version)
     {
-        QTextStream ts(&file);
-        ts.setCodec("UTF-8");
+        QString path = QString(":/text/%1_%2.txt").arg(version, getLocale());
 
-        QMap<u8, QString> input;
-        while (!ts.atEnd())
+        auto table = locationTables.find(path);
+        if (table == locationTables.end())
         {
-            QStringList entry = ts.readLine().split(',');
-            input[entry.at(0).toInt()] = entry.at(1);
+            QVector<QString> names(256);
+            for (const QString &line : readLines(path))
+            {
+                QStringList entry = line.split(',');
+                names[entry.at(0).toInt() & 0xff] = entry.at(1);
+            }
+            table = locationTables.insert(path, names);
         }
-        file.close();
+        return *table;
+    }
+
+    QStringList getLocations(const QVector<u8> &nums, const QString &version)
+    {
+        QMutexLocker locker(&mutex);
+        const QVector<QString> &names = getLocationTable(version);
 
+        QStringList locations;
+        locations.reserve(nums.size());
         for (const u8 &x : nums)
         {
-            locations.append(input[x]);
+            locations.append(names.at(x));
         }
+        return locations;
     }
-
-    return locations;
 }
 
-QStringList Translator::getLocationsGen4(const QVector<u8> &nums, Game game)
+void Translator::setLocale(const QString &locale)
 {
-    QStringList locations;
-
-    QString version;
-    if (game & Game::DPPt)
-    {
-        version = "dppt";
-    }
-    else
+    QMutexLocker locker(&mutex);
+    if (currentLocale != locale)
     {
-        version = "hgss";
-    }
+        currentLocale = locale;
+        tables.clear();
+        locationTables.clear();
 
-    QSettings setting;
-    QFile file(QString(":/text/%1_%2.txt").arg(version, setting.value("settings/locale", "en").toString()));
+        Nature::clearNames();
+        Power::clearNames();
+        Frame4::clearPitches();
+    }
+}
 
-    if (file.open(QIODevice::ReadOnly))
-    {
-        QTextStream ts(&file);
-        ts.setCodec("UTF-8");
+QStringList Translator::getCharacteristic()
+{
+    QMutexLocker locker(&mutex);
+    return getTable("characteristic");
+}
 
-        QMap<u8, QString> input;
-        while (!ts.atEnd())
-        {
-            QStringList entry = ts.readLine().split(',');
-            input[entry.at(0).toInt()] = entry.at(1);
-        }
-        file.close();
+QStringList Translator::getSpecies(const QVector<u16> &nums)
+{
+    QMutexLocker locker(&mutex);
+    const QStringList &input = getTable("species");
 
-        for (const u8 &x : nums)
+    QStringList species;
+    if (!input.isEmpty())
+    {
+        species.reserve(nums.size());
+        for (const u16 &x : nums)
         {
-            locations.append(input[x]);
+            species.append(input.at(x - 1));
         }
     }
+    return species;
+}
 
-    return locations;
+QStringList Translator::getLocationsGen3(const QVector<u8> &nums, Game game)
+{
+    return getLocations(nums, game & Game::FRLG ? "frlg" : "rse");
+}
+
+QStringList Translator::getLocationsGen4(const QVector<u8> &nums, Game game)
+{
+    return getLocations(nums, game & Game::DPPt ? "dppt" : "hgss");
 }
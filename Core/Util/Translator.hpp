@@ -26,6 +26,7 @@
 
 namespace Translator
 {
+    void setLocale(const QString &locale);
     QStringList getCharacteristic();
     QStringList getSpecies(const QVector<u16> &nums);
     QStringList getLocationsGen3(const QVector<u8> &nums, Game game);
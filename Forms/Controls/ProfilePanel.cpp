@@ -0,0 +1,70 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QHeaderView>
+#include <QTableWidget>
+#include <QVBoxLayout>
+#include "ProfilePanel.hpp"
+
+ProfilePanel::ProfilePanel(QWidget *parent) : QGroupBox(parent)
+{
+    setTitle(tr("Profiling"));
+    setCheckable(true);
+    setChecked(false);
+
+    table = new QTableWidget(0, 7, this);
+    table->setHorizontalHeaderLabels({ tr("Stage"), tr("Calls"), tr("In"), tr("Out"), tr("Pass Rate"), tr("Time (ms)"), tr("ns / Call") });
+    table->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    table->verticalHeader()->hide();
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setSelectionMode(QAbstractItemView::NoSelection);
+    table->hide();
+
+    auto *layout = new QVBoxLayout(this);
+    layout->addWidget(table);
+
+    connect(this, &QGroupBox::toggled, table, &QWidget::setVisible);
+
+    setVisible(StageProfile::isEnabled());
+}
+
+void ProfilePanel::setProfile(const StageProfile &profile)
+{
+    QVector<StageStats> stats = profile.getStats();
+
+    table->setRowCount(stats.size());
+    for (int i = 0; i < stats.size(); i++)
+    {
+        const StageStats &stage = stats.at(i);
+
+        QString passRate = stage.in == 0 ? QString() : QString::number(100.0 * stage.out / stage.in, 'f', 2) + "%";
+        QString time = stage.nanoseconds == 0 ? QString() : QString::number(stage.nanoseconds / 1000000.0, 'f', 3);
+        QString perCall = stage.nanoseconds == 0 ? QString() : QString::number(stage.nanoseconds / stage.calls);
+
+        table->setItem(i, 0, new QTableWidgetItem(stage.name));
+        table->setItem(i, 1, new QTableWidgetItem(QString::number(stage.calls)));
+        table->setItem(i, 2, new QTableWidgetItem(QString::number(stage.in)));
+        table->setItem(i, 3, new QTableWidgetItem(QString::number(stage.out)));
+        table->setItem(i, 4, new QTableWidgetItem(passRate));
+        table->setItem(i, 5, new QTableWidgetItem(time));
+        table->setItem(i, 6, new QTableWidgetItem(perCall));
+    }
+
+    table->setFixedHeight(table->horizontalHeader()->height() + table->verticalHeader()->length() + 2 * table->frameWidth());
+}
@@ -0,0 +1,41 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PROFILEPANEL_HPP
+#define PROFILEPANEL_HPP
+
+#include <QGroupBox>
+#include <Core/Util/StageProfile.hpp>
+
+class QTableWidget;
+
+// Collapsible table of the stage counters from the last run, hidden unless Core is built with profiling
+class ProfilePanel : public QGroupBox
+{
+
+public:
+    explicit ProfilePanel(QWidget *parent = nullptr);
+    void setProfile(const StageProfile &profile);
+
+private:
+    QTableWidget *table;
+
+};
+
+#endif // PROFILEPANEL_HPP
@@ -0,0 +1,87 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QContextMenuEvent>
+#include <QMenu>
+#include "ProgressBar.hpp"
+#include <Core/Util/SearchScheduler.hpp>
+
+// Totals can exceed the int range of QProgressBar so the bar works on a fixed scale
+#define RANGE 10000
+
+ProgressBar::ProgressBar(QWidget *parent) : QProgressBar(parent)
+{
+    setRange(0, RANGE);
+    searching = false;
+    paused = false;
+    maxThreads = 0;
+}
+
+void ProgressBar::setProgress(const ProgressReport &progress)
+{
+    setValue(static_cast<int>(progress.getFraction() * RANGE));
+    setFormat(progress.getText());
+    setToolTip(tr("%1 of %2").arg(progress.getDone()).arg(progress.getTotal()));
+}
+
+void ProgressBar::contextMenuEvent(QContextMenuEvent *event)
+{
+    if (!searching)
+    {
+        return;
+    }
+
+    QMenu menu(this);
+    QAction *pause = menu.addAction(paused ? tr("Resume") : tr("Pause"));
+
+    // Halving steps from the whole pool down to a single thread
+    QMenu *threads = menu.addMenu(tr("Threads"));
+    int count = SearchScheduler::getInstance().getThreadCount();
+    for (int limit = count; limit > 0; limit /= 2)
+    {
+        QAction *action = threads->addAction(limit == count ? tr("All (%1)").arg(count) : QString::number(limit));
+        action->setData(limit == count ? 0 : limit);
+        action->setCheckable(true);
+        action->setChecked(limit == count ? maxThreads == 0 || maxThreads >= count : maxThreads == limit);
+    }
+
+    QAction *action = menu.exec(event->globalPos());
+    if (action == nullptr)
+    {
+        return;
+    }
+
+    if (action == pause)
+    {
+        paused = !paused;
+        if (paused)
+        {
+            emit pauseRequested();
+        }
+        else
+        {
+            emit resumeRequested();
+        }
+    }
+    else
+    {
+        maxThreads = action->data().toInt();
+        emit maxThreadsChanged(maxThreads);
+    }
+}
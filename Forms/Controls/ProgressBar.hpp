@@ -0,0 +1,64 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PROGRESSBAR_HPP
+#define PROGRESSBAR_HPP
+
+#include <QProgressBar>
+#include <Core/Util/SearchProgress.hpp>
+
+// Progress bar driven by a search's progress report, showing the throughput and time left. While
+// the search runs its context menu pauses and resumes it or limits how many threads it takes.
+class ProgressBar : public QProgressBar
+{
+    Q_OBJECT
+
+signals:
+    void pauseRequested();
+    void resumeRequested();
+    void maxThreadsChanged(int);
+
+public:
+    explicit ProgressBar(QWidget *parent = nullptr);
+    void setProgress(const ProgressReport &progress);
+
+    template <typename Searcher>
+    void setSearcher(Searcher *searcher)
+    {
+        searching = true;
+        paused = false;
+        maxThreads = 0;
+
+        connect(this, &ProgressBar::pauseRequested, searcher, &Searcher::pauseSearch);
+        connect(this, &ProgressBar::resumeRequested, searcher, &Searcher::resumeSearch);
+        connect(this, &ProgressBar::maxThreadsChanged, searcher, &Searcher::setMaxThreads);
+        connect(searcher, &Searcher::finished, this, [ = ] { searching = false; });
+    }
+
+protected:
+    void contextMenuEvent(QContextMenuEvent *event) override;
+
+private:
+    bool searching;
+    bool paused;
+    int maxThreads;
+
+};
+
+#endif // PROGRESSBAR_HPP
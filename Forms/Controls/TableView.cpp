@@ -22,7 +22,8 @@
 #include <QFileDialog>
 #include <QHeaderView>
 #include <QKeyEvent>
-#include <QTextStream>
+#include <QMessageBox>
+#include <QProgressDialog>
 #include "TableView.hpp"
 
 TableView::TableView(QWidget *parent) :
@@ -30,6 +31,16 @@ TableView::TableView(QWidget *parent) :
 {
 }
 
+// An export is cancelled with its window, which also removes the partial file
+TableView::~TableView()
+{
+    if (exporter)
+    {
+        exporter->cancelExport();
+        exporter->waitForExport();
+    }
+}
+
 void TableView::resizeEvent(QResizeEvent *event)
 {
     QTableView::resizeEvent(event);
@@ -80,101 +91,95 @@ void TableView::outputModelTXT()
 {
     QString fileName = QFileDialog::getSaveFileName(nullptr, QObject::tr("Save Output to TXT"), QDir::currentPath(), QObject::tr("Text File (*.txt);;All Files (*)"));
 
-    if (fileName.isEmpty())
+    if (!fileName.isEmpty())
     {
-        return;
+        outputModel(fileName, TableWriter::TSV);
     }
+}
 
-    QFile file(fileName);
-    QAbstractItemModel *model = this->model();
-    if (file.open(QIODevice::WriteOnly))
+void TableView::outputModelCSV()
+{
+    QString fileName = QFileDialog::getSaveFileName(nullptr, QObject::tr("Save Output to CSV"), QDir::currentPath(), QObject::tr("CSV File (*.csv);;All Files (*)"));
+
+    if (!fileName.isEmpty())
     {
-        QTextStream ts(&file);
-        int rows = model->rowCount();
-        int columns = model->columnCount();
+        outputModel(fileName, TableWriter::CSV);
+    }
+}
 
-        QString header = "";
-        for (int i = 0; i < columns; i++)
-        {
-            header += model->headerData(i, Qt::Horizontal, 0).toString();
-            if (i != columns - 1)
-            {
-                header += "\t";
-            }
-        }
-        header += "\n";
+void TableView::outputModelBinary()
+{
+    QString fileName = QFileDialog::getSaveFileName(nullptr, QObject::tr("Save Output to Binary"), QDir::currentPath(), QObject::tr("Binary File (*.bin);;All Files (*)"));
 
-        for (int i = 0; i < rows; i++)
-        {
-            QString body = "";
-            for (int j = 0; j < columns; j++)
-            {
-                QString entry = model->data(model->index(i, j)).toString();
-                body += (entry.isEmpty() ? "-" : entry);
-                if (i != columns - 1)
-                {
-                    body += "\t";
-                }
-            }
-            if (i != rows - 1)
-            {
-                body += "\n";
-            }
-            ts << body;
-        }
+    if (!fileName.isEmpty())
+    {
+        outputModel(fileName, TableWriter::Binary);
+    }
+}
+
+void TableView::saveSession(const QJsonObject &provenance)
+{
+    QString fileName = QFileDialog::getSaveFileName(nullptr, QObject::tr("Save Session"), QDir::currentPath(), QObject::tr("Session File (*.pfs);;All Files (*)"));
 
-        file.close();
+    if (!fileName.isEmpty())
+    {
+        outputModel(fileName, TableWriter::Session, provenance);
     }
 }
 
-void TableView::outputModelCSV()
+// Returns the search parameters stored with the session, or an empty object if it could not be opened
+QJsonObject TableView::openSession()
 {
-    QString fileName = QFileDialog::getSaveFileName(nullptr, QObject::tr("Save Output to CSV"), QDir::currentPath(), QObject::tr("CSV File (*.csv);;All Files (*)"));
+    QString fileName = QFileDialog::getOpenFileName(nullptr, QObject::tr("Open Session"), QDir::currentPath(), QObject::tr("Session File (*.pfs);;All Files (*)"));
 
-    if (fileName.isEmpty())
+    auto *source = dynamic_cast<ExportSource *>(this->model());
+    if (fileName.isEmpty() || source == nullptr)
     {
-        return;
+        return QJsonObject();
     }
 
-    QFile file(fileName);
-    QAbstractItemModel *model = this->model();
-    if (file.open(QIODevice::WriteOnly))
+    auto session = QSharedPointer<SessionFile>::create();
+    if (!session->open(fileName) || !source->setSession(session))
     {
-        QTextStream ts(&file);
-        int rows = model->rowCount();
-        int columns = model->columnCount();
+        QMessageBox error;
+        error.setText(QObject::tr("Unable to open this session file."));
+        error.exec();
+        return QJsonObject();
+    }
 
-        QString header = "";
-        for (int i = 0; i < columns; i++)
-        {
-            header += model->headerData(i, Qt::Horizontal, 0).toString();
-            if (i != columns - 1)
-            {
-                header += ",";
-            }
-        }
-        header += "\n";
-        ts << header;
+    return session->getProvenance();
+}
 
-        for (int i = 0; i < rows; i++)
-        {
-            QString body = "";
-            for (int j = 0; j < columns; j++)
-            {
-                QString entry = model->data(model->index(i, j)).toString();
-                body += (entry.isEmpty() ? "-" : entry);
-                if (j != columns - 1)
-                {
-                    body += ",";
-                }
-            }
-            if (i != rows - 1)
-            {
-                body += "\n";
-            }
-            ts << body;
-        }
+void TableView::outputModel(const QString &fileName, TableWriter::Format format, const QJsonObject &provenance)
+{
+    auto *source = dynamic_cast<ExportSource *>(this->model());
+    if (source == nullptr || exporter)
+    {
+        return;
+    }
 
-        file.close();
+    exporter = source->createExporter(fileName, format);
+    if (!exporter)
+    {
+        return;
     }
+
+    exporter->setProvenance(provenance);
+
+    auto *progress = new QProgressDialog(QObject::tr("Exporting results..."), QObject::tr("Cancel"), 0, exporter->getMaxProgress(), this);
+    progress->setAttribute(Qt::WA_DeleteOnClose);
+    progress->setMinimumDuration(500);
+
+    connect(exporter, &TableExporter::updateProgress, progress, &QProgressDialog::setValue);
+    connect(exporter, &TableExporter::finished, progress, &QProgressDialog::close);
+    connect(exporter, &TableExporter::finished, this, [this] { exporter = nullptr; });
+    connect(exporter, &TableExporter::failed, this, [ = ]
+    {
+        QMessageBox error;
+        error.setText(QObject::tr("Unable to write %1.").arg(fileName));
+        error.exec();
+    });
+    connect(progress, &QProgressDialog::canceled, exporter, &TableExporter::cancelExport);
+
+    exporter->startExport();
 }
@@ -20,18 +20,29 @@
 #ifndef TABLEVIEW_HPP
 #define TABLEVIEW_HPP
 
+#include <QPointer>
 #include <QTableView>
+#include <Models/TableExporter.hpp>
 
 class TableView : public QTableView
 {
 
 public:
     explicit TableView(QWidget *parent = nullptr);
+    ~TableView() override;
     void resizeEvent(QResizeEvent *event) override;
     void mouseDoubleClickEvent(QMouseEvent *event) override;
     void keyPressEvent(QKeyEvent *event) override;
     void outputModelTXT();
     void outputModelCSV();
+    void outputModelBinary();
+    void saveSession(const QJsonObject &provenance);
+    QJsonObject openSession();
+
+private:
+    QPointer<TableExporter> exporter;
+
+    void outputModel(const QString &fileName, TableWriter::Format format, const QJsonObject &provenance = QJsonObject());
 
 };
 
@@ -172,11 +172,6 @@ void Eggs3::setupModels()
     if (setting.contains("eggs3/geometry")) this->restoreGeometry(setting.value("eggs3/geometry").toByteArray());
 }
 
-void Eggs3::refreshProfiles()
-{
-    emit alertProfiles(3);
-}
-
 void Eggs3::on_pushButtonEmeraldPIDGenerate_clicked()
 {
     emeraldPID->clearModel();
@@ -320,6 +315,5 @@ void Eggs3::on_pushButtonFRLGAnyAbility_clicked()
 void Eggs3::on_pushButtonProfileManager_clicked()
 {
     auto *manager = new ProfileManager3();
-    connect(manager, &ProfileManager3::updateProfiles, this, &Eggs3::refreshProfiles);
     manager->show();
 }
@@ -33,9 +33,6 @@ class Eggs3 : public QWidget
 {
     Q_OBJECT
 
-signals:
-    void alertProfiles(int);
-
 public:
     explicit Eggs3(QWidget *parent = nullptr);
     ~Eggs3() override;
@@ -52,7 +49,6 @@ private:
     void setupModels();
 
 private slots:
-    void refreshProfiles();
     void on_pushButtonEmeraldPIDGenerate_clicked();
     void on_pushButtonEmeraldIVsGenerate_clicked();
     void on_pushButtonRSGenerate_clicked();
@@ -25,6 +25,7 @@
 #include <Core/Gen3/IVSearcher3.hpp>
 #include <Core/Util/Nature.hpp>
 #include <Core/Util/Power.hpp>
+#include <Core/Util/SessionFile.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Forms/Gen3/GameCubeRTC.hpp>
 #include <Forms/Gen3/ProfileManager3.hpp>
@@ -138,33 +139,44 @@ void GameCube::setupModels()
 
     QAction *outputTXTGenerator = generatorMenu->addAction(tr("Output Results to TXT"));
     QAction *outputCSVGenerator = generatorMenu->addAction(tr("Output Results to CSV"));
+    QAction *outputBinaryGenerator = generatorMenu->addAction(tr("Output Results to Binary"));
 
     connect(outputTXTGenerator, &QAction::triggered, this, [ = ]() { ui->tableViewGenerator->outputModelTXT(); });
     connect(outputCSVGenerator, &QAction::triggered, this, [ = ]() { ui->tableViewGenerator->outputModelCSV(); });
+    connect(outputBinaryGenerator, &QAction::triggered, this, [ = ]() { ui->tableViewGenerator->outputModelBinary(); });
 
     QAction *copySeedToClipboard = searcherMenu->addAction(tr("Copy Seed to Clipboard"));
     QAction *seedToTime = searcherMenu->addAction(tr("Generate times for seed"));
     QAction *outputTXTSearcher = searcherMenu->addAction(tr("Output Results to TXT"));
     QAction *outputCSVSearcher = searcherMenu->addAction(tr("Output Results to CSV"));
+    QAction *outputBinarySearcher = searcherMenu->addAction(tr("Output Results to Binary"));
+    QAction *saveSessionSearcher = searcherMenu->addAction(tr("Save Session"));
+    QAction *openSessionSearcher = searcherMenu->addAction(tr("Open Session"));
 
     connect(copySeedToClipboard, &QAction::triggered, this, &GameCube::copySeedToClipboard);
     connect(seedToTime, &QAction::triggered, this, &GameCube::seedToTime);
     connect(outputTXTSearcher, &QAction::triggered, this, [ = ]() { ui->tableViewSearcher->outputModelTXT(); });
     connect(outputCSVSearcher, &QAction::triggered, this, [ = ]() { ui->tableViewSearcher->outputModelCSV(); });
+    connect(outputBinarySearcher, &QAction::triggered, this, [ = ]() { ui->tableViewSearcher->outputModelBinary(); });
+    connect(saveSessionSearcher, &QAction::triggered, this, [ = ]() { ui->tableViewSearcher->saveSession(searcherProvenance); });
+    connect(openSessionSearcher, &QAction::triggered, this, [ = ]()
+    {
+        QJsonObject provenance = ui->tableViewSearcher->openSession();
+        if (!provenance.isEmpty())
+        {
+            searcherProvenance = provenance;
+            searcherModel->setMethod(static_cast<Method>(provenance["method"].toInt()));
+        }
+    });
 
     QSettings setting;
     if (setting.contains("gamecube/geometry")) this->restoreGeometry(setting.value("gamecube/geometry").toByteArray());
 }
 
-void GameCube::updateProgress(const QVector<Frame3> &frames, int progress)
+void GameCube::updateProgress(const QVector<Frame3> &frames, const ProgressReport &progress)
 {
     searcherModel->addItems(frames);
-    ui->progressBar->setValue(progress);
-}
-
-void GameCube::refreshProfiles()
-{
-    emit alertProfiles(3);
+    ui->progressBar->setProgress(progress);
 }
 
 void GameCube::on_comboBoxProfiles_currentIndexChanged(int index)
@@ -237,6 +249,7 @@ void GameCube::on_pushButtonSearch_clicked()
                          ui->checkBoxSearcherShinyOnly->isChecked(), false,
                          ui->ivFilterSearcher->getLower(), ui->ivFilterSearcher->getUpper(), ui->comboBoxSearcherNature->getChecked(),
                          ui->comboBoxSearcherHiddenPower->getChecked(), QVector<bool>());
+    searcherProvenance = SessionFile::createProvenance(profiles.at(ui->comboBoxProfiles->currentIndex()).getJson(), static_cast<Method>(ui->comboBoxSearcherMethod->currentData().toInt()), compare);
     Searcher3 searcher(tid, sid, genderRatio, compare);
 
     searcher.setup(static_cast<Method>(ui->comboBoxSearcherMethod->currentData().toInt()));
@@ -248,20 +261,14 @@ void GameCube::on_pushButtonSearch_clicked()
     QVector<u8> min = ui->ivFilterSearcher->getLower();
     QVector<u8> max = ui->ivFilterSearcher->getUpper();
 
-    int maxProgress = 1;
-    for (u8 i = 0; i < 6; i++)
-    {
-        maxProgress *= max.at(i) - min.at(i) + 1;
-    }
-
-    ui->progressBar->setValue(0);
-    ui->progressBar->setMaximum(maxProgress);
+    ui->progressBar->setProgress(ProgressReport());
 
     auto *search = new IVSearcher3(searcher, min, max);
 
     connect(search, &IVSearcher3::finished, this, [ = ] { ui->pushButtonSearch->setEnabled(true); ui->pushButtonCancel->setEnabled(false); });
     connect(search, &IVSearcher3::updateProgress, this, &GameCube::updateProgress);
     connect(ui->pushButtonCancel, &QPushButton::clicked, search, &IVSearcher3::cancelSearch);
+    ui->progressBar->setSearcher(search);
 
     search->startSearch();
 }
@@ -422,6 +429,5 @@ void GameCube::copySeedToClipboard()
 void GameCube::on_pushButtonProfileManager_clicked()
 {
     auto *manager = new ProfileManager3();
-    connect(manager, &ProfileManager3::updateProfiles, this, &GameCube::refreshProfiles);
     manager->show();
 }
@@ -22,6 +22,7 @@
 
 #include <QMenu>
 #include <Core/Gen3/Profile3.hpp>
+#include <Core/Util/SearchProgress.hpp>
 #include <Models/Gen3/Searcher3Model.hpp>
 #include <Models/Gen3/Stationary3Model.hpp>
 
@@ -34,9 +35,6 @@ class GameCube : public QWidget
 {
     Q_OBJECT
 
-signals:
-    void alertProfiles(int);
-
 public:
     explicit GameCube(QWidget *parent = nullptr);
     ~GameCube() override;
@@ -49,12 +47,12 @@ private:
     QVector<Profile3> profiles;
     QMenu *generatorMenu{};
     QMenu *searcherMenu{};
+    QJsonObject searcherProvenance;
 
     void setupModels();
 
 private slots:
-    void updateProgress(const QVector<Frame3> &frames, int progress);
-    void refreshProfiles();
+    void updateProgress(const QVector<Frame3> &frames, const ProgressReport &progress);
     void on_comboBoxProfiles_currentIndexChanged(int index);
     void on_pushButtonGenerate_clicked();
     void on_pushButtonSearch_clicked();
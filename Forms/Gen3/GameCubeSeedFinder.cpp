@@ -125,9 +125,9 @@ void GameCubeSeedFinder::on_pushButtonGalesSearch_clicked()
         connect(searcher, &GameCubeSeedSearcher::updateProgress, this, &GameCubeSeedFinder::updateGalesProgress);
         connect(searcher, &GameCubeSeedSearcher::outputSeeds, this, &GameCubeSeedFinder::updateGales);
         connect(ui->pushButtonGalesCancel, &QPushButton::clicked, searcher, &GameCubeSeedSearcher::cancelSearch);
+        ui->progressBarGales->setSearcher(searcher);
 
-        ui->progressBarGales->setValue(0);
-        ui->progressBarGales->setMaximum(galeSeeds.size());
+        ui->progressBarGales->setProgress(ProgressReport());
         searcher->startSearch(galeSeeds);
     }
 }
@@ -185,9 +185,9 @@ void GameCubeSeedFinder::on_pushButtonColoSearch_clicked()
         connect(searcher, &GameCubeSeedSearcher::updateProgress, this, &GameCubeSeedFinder::updateColoProgress);
         connect(searcher, &GameCubeSeedSearcher::outputSeeds, this, &GameCubeSeedFinder::updateColo);
         connect(ui->pushButtonColoCancel, &QPushButton::clicked, searcher, &GameCubeSeedSearcher::cancelSearch);
+        ui->progressBarColo->setSearcher(searcher);
 
-        ui->progressBarColo->setValue(0);
-        ui->progressBarColo->setMaximum(coloSeeds.size());
+        ui->progressBarColo->setProgress(ProgressReport());
         searcher->startSearch(coloSeeds);
     }
 }
@@ -223,9 +223,9 @@ void GameCubeSeedFinder::updateGales(const QVector<u32> &seeds)
     }
 }
 
-void GameCubeSeedFinder::updateGalesProgress(int progress)
+void GameCubeSeedFinder::updateGalesProgress(const ProgressReport &progress)
 {
-    ui->progressBarGales->setValue(progress);
+    ui->progressBarGales->setProgress(progress);
 }
 
 void GameCubeSeedFinder::updateColo(const QVector<u32> &seeds)
@@ -248,7 +248,7 @@ void GameCubeSeedFinder::updateColo(const QVector<u32> &seeds)
     }
 }
 
-void GameCubeSeedFinder::updateColoProgress(int progress)
+void GameCubeSeedFinder::updateColoProgress(const ProgressReport &progress)
 {
-    ui->progressBarColo->setValue(progress);
+    ui->progressBarColo->setProgress(progress);
 }
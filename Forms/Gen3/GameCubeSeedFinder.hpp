@@ -22,6 +22,7 @@
 
 #include <QWidget>
 #include <Core/Util/Global.hpp>
+#include <Core/Util/SearchProgress.hpp>
 
 namespace Ui
 {
@@ -51,9 +52,9 @@ private:
 
 private slots:
     void updateGales(const QVector<u32> &seeds);
-    void updateGalesProgress(int progress);
+    void updateGalesProgress(const ProgressReport &progress);
     void updateColo(const QVector<u32> &seeds);
-    void updateColoProgress(int progress);
+    void updateColoProgress(const ProgressReport &progress);
 
 };
 
@@ -20,7 +20,7 @@
 #include <QSettings>
 #include "IDs3.hpp"
 #include "ui_IDs3.h"
-#include <Core/RNG/LCRNG.hpp>
+#include <Core/Gen3/IDSearcher3.hpp>
 #include <Core/Util/Utilities.hpp>
 
 IDs3::IDs3(QWidget *parent) :
@@ -43,9 +43,9 @@ IDs3::~IDs3()
 
 void IDs3::setupModels()
 {
-    xdcolo = new QStandardItemModel(ui->tableViewXDColo);
-    frlge = new QStandardItemModel(ui->tableViewFRLGE);
-    rs = new QStandardItemModel(ui->tableViewFRLGE);
+    xdcolo = new IDs3Model(ui->tableViewXDColo);
+    frlge = new IDs3Model(ui->tableViewFRLGE);
+    rs = new IDs3Model(ui->tableViewRS);
 
     ui->textBoxFRLGEPID->setValues(InputType::Seed32Bit);
     ui->textBoxFRLGETID->setValues(InputType::TIDSID);
@@ -69,23 +69,32 @@ void IDs3::setupModels()
 
     ui->dateTimeEdit->setDisplayFormat(QLocale::system().dateTimeFormat(QLocale::ShortFormat));
 
-    xdcolo->setHorizontalHeaderLabels(QStringList() << tr("Frame") << tr("TID") << tr("SID"));
     ui->tableViewXDColo->setModel(xdcolo);
 
-    frlge->setHorizontalHeaderLabels(QStringList() << tr("Frame") << tr("TID") << tr("SID"));
     ui->tableViewFRLGE->setModel(frlge);
 
-    rs->setHorizontalHeaderLabels(QStringList() << tr("Frame") << tr("TID") << tr("SID"));
     ui->tableViewRS->setModel(rs);
 
     QSettings setting;
     if (setting.contains("ids3/geometry")) this->restoreGeometry(setting.value("ids3/geometry").toByteArray());
 }
 
-void IDs3::on_pushButtonFRLGESearch_clicked()
+void IDs3::search(const IDFilter &filter, u32 seed, u32 minFrame, u32 maxResults, Game version, IDs3Model *model, QPushButton *button)
 {
-    frlge->removeRows(0, frlge->rowCount());
+    model->clearModel();
+    button->setEnabled(false);
+
+    auto *searcher = new IDSearcher3(filter, seed, minFrame, maxResults, version);
+
+    connect(searcher, &IDSearcher3::finished, this, [ = ] { button->setEnabled(true); });
+    connect(searcher, &IDSearcher3::updateProgress, this, [ = ](const QVector<IDFrame3> &frames) { model->addItems(frames); });
+    connect(this, &IDs3::destroyed, searcher, &IDSearcher3::cancelSearch);
 
+    searcher->startSearch();
+}
+
+void IDs3::on_pushButtonFRLGESearch_clicked()
+{
     u16 tid = ui->textBoxFRLGETID->getUShort();
     bool usePID = ui->checkBoxFRLGEPID->isChecked();
     bool useSID = ui->checkBoxFRLGESID->isChecked();
@@ -94,25 +103,13 @@ void IDs3::on_pushButtonFRLGESearch_clicked()
     u32 minFrame = ui->textBoxFRLGEStartingFrame->getUInt();
     u32 maxResults = ui->textBoxFRLGEMaxResults->getUInt();
 
-    PokeRNG rng(tid, minFrame - 1);
-    u16 sid = rng.nextUShort();
-
-    u32 max = minFrame + maxResults;
-    for (u32 frame = minFrame; frame <= max; ++frame)
-    {
-        sid = rng.nextUShort();
-
-        if ((!usePID || Utilities::shiny(pid, tid, sid)) && (!useSID || searchSID == sid))
-        {
-            frlge->appendRow(QList<QStandardItem *>() << new QStandardItem(QString::number(frame)) << new QStandardItem(QString::number(tid)) << new QStandardItem(QString::number(sid)));
-        }
-    }
+    // The TID seeds the RNG for the SID
+    IDFilter filter(usePID, pid, false, tid, useSID, searchSID);
+    search(filter, tid, minFrame, maxResults, Game::FRLG, frlge, ui->pushButtonFRLGESearch);
 }
 
 void IDs3::on_pushButtonRSSearch_clicked()
 {
-    rs->removeRows(0, rs->rowCount());
-
     u32 seed;
     bool usePID = ui->checkBoxRSPID->isChecked();
     bool useSID = ui->checkBoxRSSID->isChecked();
@@ -132,27 +129,12 @@ void IDs3::on_pushButtonRSSearch_clicked()
         seed = Utilities::calcGen3Seed(ui->dateTimeEdit->date(), ui->dateTimeEdit->time().hour(), ui->dateTimeEdit->time().minute());
     }
 
-    PokeRNG rng(seed, minFrame);
-
-    u16 tid = rng.nextUShort(), sid;
-
-    u32 max = minFrame + maxResults;
-    for (u32 frame = minFrame; frame <= max; ++frame)
-    {
-        sid = tid;
-        tid = rng.nextUShort();
-
-        if ((!usePID || Utilities::shiny(pid, tid, sid)) && (!useTID || searchTID == tid) && (!useSID || searchSID == sid))
-        {
-            rs->appendRow(QList<QStandardItem *>() << new QStandardItem(QString::number(frame)) << new QStandardItem(QString::number(tid)) << new QStandardItem(QString::number(sid)));
-        }
-    }
+    IDFilter filter(usePID, pid, useTID, searchTID, useSID, searchSID);
+    search(filter, seed, minFrame, maxResults, Game::RS, rs, ui->pushButtonRSSearch);
 }
 
 void IDs3::on_pushButtonXDColoSearch_clicked()
 {
-    xdcolo->removeRows(0, xdcolo->rowCount());
-
     u32 seed = ui->textBoxXDColoSeed->getUInt();
     bool usePID = ui->checkBoxXDColoPID->isChecked();
     bool useSID = ui->checkBoxXDColoSID->isChecked();
@@ -163,20 +145,8 @@ void IDs3::on_pushButtonXDColoSearch_clicked()
     u32 minFrame = ui->textBoxXDColoStartingFrame->getUInt();
     u32 maxResults = ui->textBoxXDColoMaxResults->getUInt();
 
-    XDRNG rng(seed, minFrame + 1);
-    u16 sid = rng.nextUShort(), tid;
-
-    u32 max = minFrame + maxResults;
-    for (u32 frame = minFrame; frame <= max; ++frame)
-    {
-        tid = sid;
-        sid = rng.nextUShort();
-
-        if ((!usePID || Utilities::shiny(pid, tid, sid)) && (!useTID || searchTID == tid) && (!useSID || searchSID == sid))
-        {
-            xdcolo->appendRow(QList<QStandardItem *>() << new QStandardItem(QString::number(frame)) << new QStandardItem(QString::number(tid)) << new QStandardItem(QString::number(sid)));
-        }
-    }
+    IDFilter filter(usePID, pid, useTID, searchTID, useSID, searchSID);
+    search(filter, seed, minFrame, maxResults, Game::GC, xdcolo, ui->pushButtonXDColoSearch);
 }
 
 void IDs3::on_checkBoxRSDeadBattery_clicked(bool checked)
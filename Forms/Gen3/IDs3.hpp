@@ -20,8 +20,11 @@
 #ifndef IDS3_HPP
 #define IDS3_HPP
 
-#include <QStandardItemModel>
+#include <QPushButton>
 #include <QWidget>
+#include <Core/Parents/IDFilter.hpp>
+#include <Core/Util/Game.hpp>
+#include <Models/Gen3/IDs3Model.hpp>
 
 namespace Ui
 {
@@ -38,11 +41,12 @@ public:
 
 private:
     Ui::IDs3 *ui;
-    QStandardItemModel *xdcolo{};
-    QStandardItemModel *frlge{};
-    QStandardItemModel *rs{};
+    IDs3Model *xdcolo{};
+    IDs3Model *frlge{};
+    IDs3Model *rs{};
 
     void setupModels();
+    void search(const IDFilter &filter, u32 seed, u32 minFrame, u32 maxResults, Game version, IDs3Model *model, QPushButton *button);
 
 private slots:
     void on_pushButtonXDColoSearch_clicked();
@@ -120,7 +120,7 @@ void PokeSpot::on_pushButtonGenerate_clicked()
                     {
                         continue;
                     }
-                    frame.setLockReason(tr("Common"));
+                    frame.setLockReason(LockReason::Common);
                 }
                 else if (call > 49 && call < 85)
                 {
@@ -128,7 +128,7 @@ void PokeSpot::on_pushButtonGenerate_clicked()
                     {
                         continue;
                     }
-                    frame.setLockReason(tr("Uncommon"));
+                    frame.setLockReason(LockReason::Uncommon);
                 }
                 else
                 {
@@ -136,7 +136,7 @@ void PokeSpot::on_pushButtonGenerate_clicked()
                     {
                         continue;
                     }
-                    frame.setLockReason(tr("Rare"));
+                    frame.setLockReason(LockReason::Rare);
                 }
 
                 u16 high = rngList.at(cnt + 3);
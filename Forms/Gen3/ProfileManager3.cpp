@@ -60,7 +60,6 @@ void ProfileManager3::on_pushButtonNew_clicked()
         Profile3 profile = dialog->getNewProfile();
         profile.saveProfile();
         model->addItem(profile);
-        emit updateProfiles();
     }
 }
 
@@ -81,7 +80,6 @@ void ProfileManager3::on_pushButtonEdit_clicked()
         Profile3 profile = dialog->getNewProfile();
         profile.updateProfile(dialog->getOriginal());
         model->updateItem(profile, row);
-        emit updateProfiles();
     }
 }
 
@@ -103,7 +101,5 @@ void ProfileManager3::on_pushButtonDelete_clicked()
         Profile3 profile = model->getItem(row);
         profile.deleteProfile();
         model->removeItem(row);
-
-        emit updateProfiles();
     }
 }
@@ -32,9 +32,6 @@ class ProfileManager3 : public QWidget
 {
     Q_OBJECT
 
-signals:
-    void updateProfiles();
-
 public:
     explicit ProfileManager3(QWidget *parent = nullptr);
     ~ProfileManager3() override;
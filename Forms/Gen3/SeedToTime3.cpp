@@ -17,12 +17,11 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <QDateTime>
 #include <QMessageBox>
 #include <QSettings>
 #include "SeedToTime3.hpp"
 #include "ui_SeedToTime3.h"
-#include <Core/RNG/LCRNG.hpp>
+#include <Core/Gen3/SeedToTimeSearcher3.hpp>
 
 SeedToTime3::SeedToTime3(QWidget *parent) :
     QWidget(parent),
@@ -45,7 +44,7 @@ SeedToTime3::SeedToTime3(u32 seed, QWidget *parent) :
 
     setupModels();
 
-    ui->textBoxSeed->setText(QString::number(seed, 16));
+    ui->lineEditSeeds->setText(QString::number(seed, 16));
     on_pushButtonFind_clicked();
 }
 
@@ -54,6 +53,7 @@ SeedToTime3::~SeedToTime3()
     QSettings setting;
     setting.beginGroup("seedToTime3");
     setting.setValue("year", ui->textBoxYear->text());
+    setting.setValue("endYear", ui->textBoxEndYear->text());
     setting.setValue("geometry", this->saveGeometry());
     setting.endGroup();
 
@@ -62,98 +62,77 @@ SeedToTime3::~SeedToTime3()
 
 void SeedToTime3::setupModels()
 {
-    model = new QStandardItemModel(ui->tableView);
+    model = new SeedToTime3Model(ui->tableView);
 
-    ui->textBoxSeed->setValues(InputType::Seed32Bit);
     ui->textBoxYear->setValues(0, 2037);
+    ui->textBoxEndYear->setValues(0, 2037);
 
-    model->setHorizontalHeaderLabels(QStringList() << tr("Time") << tr("Frame"));
     ui->tableView->setModel(model);
 
     QSettings setting;
     setting.beginGroup("seedToTime3");
     if (setting.contains("year")) ui->textBoxYear->setText(setting.value("year").toString());
+    if (setting.contains("endYear")) ui->textBoxEndYear->setText(setting.value("endYear").toString());
     if (setting.contains("geometry")) this->restoreGeometry(setting.value("geometry").toByteArray());
     setting.endGroup();
 }
 
-u16 SeedToTime3::originSeed(u32 seed)
+void SeedToTime3::on_pushButtonFind_clicked()
 {
-    PokeRNGR rng(seed);
-    while (rng.getSeed() > 0xFFFF)
+    QVector<u32> seeds;
+    for (const QString &text : ui->lineEditSeeds->text().split(QRegExp("[,\\s]"), QString::SkipEmptyParts))
     {
-        rng.nextUInt();
-        frame++;
+        bool ok;
+        u32 seed = text.toUInt(&ok, 16);
+        if (!ok)
+        {
+            QMessageBox error;
+            error.setText(tr("%1 is not a valid seed").arg(text));
+            error.exec();
+            return;
+        }
+        seeds.append(seed);
     }
-    return rng.getSeed();
-}
-
-void SeedToTime3::seedToTime(u32 seed, u32 year)
-{
-    model->removeRows(0, model->rowCount());
 
-    u32 minDay = 0;
-    u32 maxDay = 0;
+    if (seeds.isEmpty())
+    {
+        QMessageBox error;
+        error.setText(tr("Please enter at least one seed"));
+        error.exec();
+        return;
+    }
 
-    // For whatever reason the start date is different if the year is greater then 2000
-    QDateTime start(QDate(year == 2000 ? 2000 : 2001, 1, 1), QTime(0, 0));
+    u32 minYear = ui->textBoxYear->getUInt();
+    u32 maxYear = ui->textBoxEndYear->getUInt();
 
     // Hard cap upper year since game crashes above year 2037
     // Signed overflow error due to how the clock is setup
-    if (year < 2000 || year > 2037)
+    if (minYear < 2000 || maxYear > 2037)
     {
         QMessageBox error;
-        error.setText(tr("Please enter a year between 2000 and 2037"));
+        error.setText(tr("Please enter years between 2000 and 2037"));
         error.exec();
         return;
     }
 
-    // Game decides to ignore a year of counting days
-    for (u32 x = 2001; x < year; x++)
+    if (minYear > maxYear)
     {
-        QDate temp(x, 1, 1);
-        minDay += static_cast<u32>(temp.daysInYear());
-        maxDay += static_cast<u32>(temp.daysInYear());
+        QMessageBox error;
+        error.setText(tr("Start year must not be after the end year"));
+        error.exec();
+        return;
     }
 
-    // Loop through the year generating seeds to check against user input
-    for (u32 month = 1; month < 13; month++)
-    {
-        QDate temp(2000, month, 1);
-        maxDay += static_cast<u32>(temp.daysInMonth());
-        for (u32 day = minDay; day < maxDay; day++)
-        {
-            for (u32 hour = 0; hour < 24; hour++)
-            {
-                for (u32 minute = 0; minute < 60; minute++)
-                {
-                    // Formula to generate intial seed
-                    u32 v = 1440 * day + 960 * (hour / 10) + 60 * (hour % 10) + 16 * (minute / 10) + (minute % 10) + 0x5A0;
-                    v = (v >> 16) ^ (v & 0xFFFF);
-
-                    if (v == seed)
-                    {
-                        QDateTime finalTime = start.addDays(day).addSecs((hour * 60 * 60) + (minute * 60));
-                        QString result = finalTime.toString(Qt::SystemLocaleShortDate);
-                        model->appendRow(QList<QStandardItem *>() << new QStandardItem(result) << new QStandardItem(QString::number(frame)));
-                    }
-                }
-            }
-        }
-        minDay += static_cast<u32>(temp.daysInMonth());
-    }
-}
+    model->clearModel();
+    ui->pushButtonFind->setEnabled(false);
+    ui->pushButtonCancel->setEnabled(true);
 
-void SeedToTime3::on_pushButtonFind_clicked()
-{
-    u32 seed = ui->textBoxSeed->getUInt();
-    u32 year = ui->textBoxYear->getUInt();
-    frame = 1;
-    if (seed > 0xFFFF)
-    {
-        seed = originSeed(seed);
-        ui->textBoxSeed->setText(QString::number(seed, 16));
-    }
+    auto *search = new SeedToTimeSearcher3(seeds, minYear, maxYear);
+
+    connect(search, &SeedToTimeSearcher3::finished, this, [ = ] { ui->pushButtonFind->setEnabled(true); ui->pushButtonCancel->setEnabled(false); });
+    connect(search, &SeedToTimeSearcher3::updateProgress, this, [ = ](const QVector<DateTime3> &results) { model->addItems(results); });
+    connect(ui->pushButtonCancel, &QPushButton::clicked, search, &SeedToTimeSearcher3::cancelSearch);
+    connect(this, &SeedToTime3::destroyed, search, &SeedToTimeSearcher3::cancelSearch);
 
-    seedToTime(seed, year);
+    search->startSearch();
 }
@@ -20,9 +20,8 @@
 #ifndef SEEDTOTIME3_HPP
 #define SEEDTOTIME3_HPP
 
-#include <QStandardItemModel>
 #include <QWidget>
-#include <Core/Util/Global.hpp>
+#include <Models/Gen3/SeedToTime3Model.hpp>
 
 namespace Ui
 {
@@ -40,12 +39,9 @@ public:
 
 private:
     Ui::SeedToTime3 *ui;
-    QStandardItemModel *model{};
-    u32 frame = 1;
+    SeedToTime3Model *model{};
 
     void setupModels();
-    u16 originSeed(u32 seed);
-    void seedToTime(u32 seed, u32 year);
 
 private slots:
     void on_pushButtonFind_clicked();
@@ -25,6 +25,7 @@
 #include <Core/Gen3/IVSearcher3.hpp>
 #include <Core/Util/Nature.hpp>
 #include <Core/Util/Power.hpp>
+#include <Core/Util/SessionFile.hpp>
 #include <Forms/Gen3/ProfileManager3.hpp>
 #include <Forms/Gen3/SeedToTime3.hpp>
 
@@ -138,6 +139,7 @@ void Stationary3::setupModels()
     QAction *center1Minute = generatorMenu->addAction(tr("Center to +/- 1 Minute and Set as Target Frame"));
     QAction *outputTXTGenerator = generatorMenu->addAction(tr("Output Results to TXT"));
     QAction *outputCSVGenerator = generatorMenu->addAction(tr("Output Results to CSV"));
+    QAction *outputBinaryGenerator = generatorMenu->addAction(tr("Output Results to Binary"));
 
     connect(setTargetFrame, &QAction::triggered, this, &Stationary3::setTargetFrameGenerator);
     connect(jumpToTarget, &QAction::triggered, this, &Stationary3::jumpToTargetGenerator);
@@ -149,16 +151,31 @@ void Stationary3::setupModels()
     connect(center1Minute, &QAction::triggered, this, [ = ]() { centerFramesAndSetTargetGenerator(3600); });
     connect(outputTXTGenerator, &QAction::triggered, this, [ = ]() { ui->tableViewGenerator->outputModelTXT(); });
     connect(outputCSVGenerator, &QAction::triggered, this, [ = ]() { ui->tableViewGenerator->outputModelCSV(); });
+    connect(outputBinaryGenerator, &QAction::triggered, this, [ = ]() { ui->tableViewGenerator->outputModelBinary(); });
 
     QAction *copySeedToClipboard = searcherMenu->addAction(tr("Copy Seed to Clipboard"));
     QAction *seedToTime = searcherMenu->addAction(tr("Generate times for seed"));
     QAction *outputTXTSearcher = searcherMenu->addAction(tr("Output Results to TXT"));
     QAction *outputCSVSearcher = searcherMenu->addAction(tr("Output Results to CSV"));
+    QAction *outputBinarySearcher = searcherMenu->addAction(tr("Output Results to Binary"));
+    QAction *saveSessionSearcher = searcherMenu->addAction(tr("Save Session"));
+    QAction *openSessionSearcher = searcherMenu->addAction(tr("Open Session"));
 
     connect(copySeedToClipboard, &QAction::triggered, this, &Stationary3::copySeedToClipboard);
     connect(seedToTime, &QAction::triggered, this, &Stationary3::seedToTime);
     connect(outputTXTSearcher, &QAction::triggered, this, [ = ]() { ui->tableViewSearcher->outputModelTXT(); });
     connect(outputCSVSearcher, &QAction::triggered, this, [ = ]() { ui->tableViewSearcher->outputModelCSV(); });
+    connect(outputBinarySearcher, &QAction::triggered, this, [ = ]() { ui->tableViewSearcher->outputModelBinary(); });
+    connect(saveSessionSearcher, &QAction::triggered, this, [ = ]() { ui->tableViewSearcher->saveSession(searcherProvenance); });
+    connect(openSessionSearcher, &QAction::triggered, this, [ = ]()
+    {
+        QJsonObject provenance = ui->tableViewSearcher->openSession();
+        if (!provenance.isEmpty())
+        {
+            searcherProvenance = provenance;
+            searcherModel->setMethod(static_cast<Method>(provenance["method"].toInt()));
+        }
+    });
 
     QSettings setting;
     if (setting.contains("stationary3/geometry")) this->restoreGeometry(setting.value("stationary3/geometry").toByteArray());
@@ -182,15 +199,10 @@ void Stationary3::moveResults(const QString &seed, const QString &method, u8 hp,
     ui->ivFilterGenerator->setValues(hp, atk, def, spa, spd, spe);
 }
 
-void Stationary3::updateProgress(const QVector<Frame3> &frames, int progress)
+void Stationary3::updateProgress(const QVector<Frame3> &frames, const ProgressReport &progress)
 {
     searcherModel->addItems(frames);
-    ui->progressBar->setValue(progress);
-}
-
-void Stationary3::refreshProfiles()
-{
-    emit alertProfiles(3);
+    ui->progressBar->setProgress(progress);
 }
 
 void Stationary3::on_comboBoxProfiles_currentIndexChanged(int index)
@@ -239,6 +251,7 @@ void Stationary3::on_pushButtonGenerate_clicked()
 
     QVector<Frame3> frames = generator.generate(compare);
     generatorModel->addItems(frames);
+    ui->profilePanel->setProfile(generator.getProfile());
 }
 
 void Stationary3::on_pushButtonSearch_clicked()
@@ -258,26 +271,22 @@ void Stationary3::on_pushButtonSearch_clicked()
     FrameCompare compare(ui->comboBoxSearcherGender->currentIndex(), ui->comboBoxSearcherAbility->currentIndex(),
                          ui->checkBoxSearcherShinyOnly->isChecked(), false, min, max,
                          ui->comboBoxSearcherNature->getChecked(), ui->comboBoxSearcherHiddenPower->getChecked(), QVector<bool>());
+    searcherProvenance = SessionFile::createProvenance(profiles.at(ui->comboBoxProfiles->currentIndex()).getJson(), static_cast<Method>(ui->comboBoxSearcherMethod->currentData().toInt()), compare);
     Searcher3 searcher(tid, sid, genderRatio, compare);
 
     searcher.setup(static_cast<Method>(ui->comboBoxSearcherMethod->currentData().toInt()));
 
 
 
-    int maxProgress = 1;
-    for (u8 i = 0; i < 6; i++)
-    {
-        maxProgress *= max.at(i) - min.at(i) + 1;
-    }
-
-    ui->progressBar->setValue(0);
-    ui->progressBar->setMaximum(maxProgress);
+    ui->progressBar->setProgress(ProgressReport());
 
     auto *search = new IVSearcher3(searcher, min, max);
 
     connect(search, &IVSearcher3::finished, this, [ = ] { ui->pushButtonSearch->setEnabled(true); ui->pushButtonCancel->setEnabled(false); });
+    connect(search, &IVSearcher3::finished, this, [ = ] { ui->profilePanel->setProfile(search->getProfile()); });
     connect(search, &IVSearcher3::updateProgress, this, &Stationary3::updateProgress);
     connect(ui->pushButtonCancel, &QPushButton::clicked, search, &IVSearcher3::cancelSearch);
+    ui->progressBar->setSearcher(search);
 
     search->startSearch();
 }
@@ -351,6 +360,5 @@ void Stationary3::copySeedToClipboard()
 void Stationary3::on_pushButtonProfileManager_clicked()
 {
     auto *manager = new ProfileManager3();
-    connect(manager, &ProfileManager3::updateProfiles, this, &Stationary3::refreshProfiles);
     manager->show();
 }
@@ -22,6 +22,7 @@
 
 #include <QMenu>
 #include <Core/Gen3/Profile3.hpp>
+#include <Core/Util/SearchProgress.hpp>
 #include <Models/Gen3/Searcher3Model.hpp>
 #include <Models/Gen3/Stationary3Model.hpp>
 
@@ -34,9 +35,6 @@ class Stationary3 : public QWidget
 {
     Q_OBJECT
 
-signals:
-    void alertProfiles(int);
-
 public:
     explicit Stationary3(QWidget *parent = nullptr);
     ~Stationary3() override;
@@ -49,6 +47,7 @@ private:
     QVector<Profile3> profiles;
     QMenu *generatorMenu{};
     QMenu *searcherMenu{};
+    QJsonObject searcherProvenance;
     QModelIndex lastIndex;
     QModelIndex targetFrame;
 
@@ -58,8 +57,7 @@ public slots:
     void moveResults(const QString &seed, const QString &method, u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe);
 
 private slots:
-    void updateProgress(const QVector<Frame3> &frames, int progress);
-    void refreshProfiles();
+    void updateProgress(const QVector<Frame3> &frames, const ProgressReport &progress);
     void on_comboBoxProfiles_currentIndexChanged(int index);
     void on_pushButtonGenerate_clicked();
     void on_pushButtonSearch_clicked();
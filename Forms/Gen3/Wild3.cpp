@@ -26,6 +26,7 @@
 #include <Core/Gen3/IVSearcher3.hpp>
 #include <Core/Util/Nature.hpp>
 #include <Core/Util/Power.hpp>
+#include <Core/Util/SessionFile.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Forms/Gen3/ProfileManager3.hpp>
 #include <Forms/Gen3/SeedToTime3.hpp>
@@ -166,6 +167,7 @@ void Wild3::setupModels()
     QAction *center1Minute = generatorMenu->addAction(tr("Center to +/- 1 Minute and Set as Target Frame"));
     QAction *outputTXTGenerator = generatorMenu->addAction(tr("Output Results to TXT"));
     QAction *outputCSVGenerator = generatorMenu->addAction(tr("Output Results to CSV"));
+    QAction *outputBinaryGenerator = generatorMenu->addAction(tr("Output Results to Binary"));
 
     connect(setTargetFrame, &QAction::triggered, this, &Wild3::setTargetFrameGenerator);
     connect(jumpToTarget, &QAction::triggered, this, &Wild3::jumpToTargetGenerator);
@@ -177,16 +179,31 @@ void Wild3::setupModels()
     connect(center1Minute, &QAction::triggered, this, [ = ]() { centerFramesAndSetTargetGenerator(3600); });
     connect(outputTXTGenerator, &QAction::triggered, this, [ = ]() { ui->tableViewGenerator->outputModelTXT(); });
     connect(outputCSVGenerator, &QAction::triggered, this, [ = ]() { ui->tableViewGenerator->outputModelCSV(); });
+    connect(outputBinaryGenerator, &QAction::triggered, this, [ = ]() { ui->tableViewGenerator->outputModelBinary(); });
 
     QAction *copySeedToClipboard = searcherMenu->addAction(tr("Copy Seed to Clipboard"));
     QAction *seedToTime = searcherMenu->addAction(tr("Generate times for seed"));
     QAction *outputTXTSearcher = searcherMenu->addAction(tr("Output Results to TXT"));
     QAction *outputCSVSearcher = searcherMenu->addAction(tr("Output Results to CSV"));
+    QAction *outputBinarySearcher = searcherMenu->addAction(tr("Output Results to Binary"));
+    QAction *saveSessionSearcher = searcherMenu->addAction(tr("Save Session"));
+    QAction *openSessionSearcher = searcherMenu->addAction(tr("Open Session"));
 
     connect(copySeedToClipboard, &QAction::triggered, this, &Wild3::copySeedToClipboard);
     connect(seedToTime, &QAction::triggered, this, &Wild3::seedToTime);
     connect(outputTXTSearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->outputModelTXT(); });
     connect(outputCSVSearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->outputModelCSV(); });
+    connect(outputBinarySearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->outputModelBinary(); });
+    connect(saveSessionSearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->saveSession(searcherProvenance); });
+    connect(openSessionSearcher, &QAction::triggered, [ = ]()
+    {
+        QJsonObject provenance = ui->tableViewSearcher->openSession();
+        if (!provenance.isEmpty())
+        {
+            searcherProvenance = provenance;
+            searcherModel->setMethod(static_cast<Method>(provenance["method"].toInt()));
+        }
+    });
 
     QSettings setting;
     if (setting.contains("wild3/geometry")) this->restoreGeometry(setting.value("wild3/geometry").toByteArray());
@@ -268,15 +285,10 @@ void Wild3::updatePokemonSearcher()
     }
 }
 
-void Wild3::updateProgress(const QVector<Frame3> &frames, int progress)
+void Wild3::updateProgress(const QVector<Frame3> &frames, const ProgressReport &progress)
 {
     searcherModel->addItems(frames);
-    ui->progressBar->setValue(progress);
-}
-
-void Wild3::refreshProfiles()
-{
-    emit alertProfiles(3);
+    ui->progressBar->setProgress(progress);
 }
 
 void Wild3::on_comboBoxProfiles_currentIndexChanged(int index)
@@ -368,6 +380,7 @@ void Wild3::on_pushButtonGenerate_clicked()
 
     QVector<Frame3> frames = generator.generate(compare);
     generatorModel->addItems(frames);
+    ui->profilePanel->setProfile(generator.getProfile());
 }
 
 void Wild3::on_pushButtonSearch_clicked()
@@ -386,6 +399,7 @@ void Wild3::on_pushButtonSearch_clicked()
                          ui->checkBoxSearcherShinyOnly->isChecked(), false,
                          ui->ivFilterSearcher->getLower(), ui->ivFilterSearcher->getUpper(), ui->comboBoxSearcherNature->getChecked(),
                          ui->comboBoxSearcherHiddenPower->getChecked(), ui->comboBoxSearcherEncounterSlot->getChecked());
+    searcherProvenance = SessionFile::createProvenance(profiles.at(ui->comboBoxProfiles->currentIndex()).getJson(), static_cast<Method>(ui->comboBoxGeneratorMethod->currentData().toInt()), compare);
 
     Searcher3 searcher(tid, sid, genderRatio, compare);
 
@@ -397,20 +411,15 @@ void Wild3::on_pushButtonSearch_clicked()
     QVector<u8> min = ui->ivFilterSearcher->getLower();
     QVector<u8> max = ui->ivFilterSearcher->getUpper();
 
-    int maxProgress = 1;
-    for (u8 i = 0; i < 6; i++)
-    {
-        maxProgress *= max.at(i) - min.at(i) + 1;
-    }
-
-    ui->progressBar->setValue(0);
-    ui->progressBar->setMaximum(maxProgress);
+    ui->progressBar->setProgress(ProgressReport());
 
     auto *search = new IVSearcher3(searcher, min, max);
 
     connect(search, &IVSearcher3::finished, this, [ = ] { ui->pushButtonSearch->setEnabled(true); ui->pushButtonCancel->setEnabled(false); });
+    connect(search, &IVSearcher3::finished, this, [ = ] { ui->profilePanel->setProfile(search->getProfile()); });
     connect(search, &IVSearcher3::updateProgress, this, &Wild3::updateProgress);
     connect(ui->pushButtonCancel, &QPushButton::clicked, search, &IVSearcher3::cancelSearch);
+    ui->progressBar->setSearcher(search);
 
     search->startSearch();
 }
@@ -613,6 +622,5 @@ void Wild3::on_comboBoxSearcherPokemon_currentIndexChanged(int index)
 void Wild3::on_pushButtonProfileManager_clicked()
 {
     auto *manager = new ProfileManager3();
-    connect(manager, &ProfileManager3::updateProfiles, this, &Wild3::refreshProfiles);
     manager->show();
 }
@@ -23,6 +23,7 @@
 #include <QMenu>
 #include <Core/Gen3/EncounterArea3.hpp>
 #include <Core/Gen3/Profile3.hpp>
+#include <Core/Util/SearchProgress.hpp>
 #include <Models/Gen3/Searcher3Model.hpp>
 #include <Models/Gen3/Wild3Model.hpp>
 
@@ -35,9 +36,6 @@ class Wild3 : public QWidget
 {
     Q_OBJECT
 
-signals:
-    void alertProfiles(int);
-
 public:
     explicit Wild3(QWidget *parent = nullptr);
     ~Wild3() override;
@@ -50,6 +48,7 @@ private:
     Wild3Model *generatorModel{};
     QMenu *generatorMenu{};
     QMenu *searcherMenu{};
+    QJsonObject searcherProvenance;
     QModelIndex lastIndex;
     QModelIndex targetFrame;
     QVector<EncounterArea3> encounterGenerator;
@@ -62,8 +61,7 @@ private:
     void updatePokemonSearcher();
 
 private slots:
-    void updateProgress(const QVector<Frame3> &frames, int progress);
-    void refreshProfiles();
+    void updateProgress(const QVector<Frame3> &frames, const ProgressReport &progress);
     void on_comboBoxProfiles_currentIndexChanged(int index);
     void on_pushButtonGenerate_clicked();
     void on_pushButtonSearch_clicked();
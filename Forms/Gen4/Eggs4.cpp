@@ -143,15 +143,10 @@ void Eggs4::setupModels()
     setting.endGroup();
 }
 
-void Eggs4::updateProgress(const QVector<Frame4> &frames, int progress)
+void Eggs4::updateProgress(const QVector<Frame4> &frames, const ProgressReport &progress)
 {
     searcherModel->addItems(frames);
-    ui->progressBarSearcher->setValue(progress);
-}
-
-void Eggs4::refreshProfiles()
-{
-    emit alertProfiles(4);
+    ui->progressBarSearcher->setProgress(progress);
 }
 
 void Eggs4::on_pushButtonGenerate_clicked()
@@ -237,14 +232,14 @@ void Eggs4::on_pushButtonSearch_clicked()
     Method typePID = ui->checkBoxSearcherMasuada->isChecked() ? Method::Gen4Masuada : Method::Gen4Normal;
     Egg4 generatorPID(maxFramePID - minFramePID + 1, minFramePID, tid, sid, typePID, 0, genderRatio);
 
-    ui->progressBarSearcher->setValue(0);
-    ui->progressBarSearcher->setMaximum(static_cast<int>(256 * 24 * (maxDelay - minDelay + 1)));
+    ui->progressBarSearcher->setProgress(ProgressReport());
 
     auto *search = new EggSearcher4(generatorIV, generatorPID, compare, minDelay, maxDelay, ui->comboBoxSearcherMethod->currentIndex());
 
     connect(search, &EggSearcher4::finished, this, [ = ] { ui->pushButtonSearch->setEnabled(true); ui->pushButtonCancel->setEnabled(false); });
     connect(search, &EggSearcher4::updateProgress, this, &Eggs4::updateProgress);
     connect(ui->pushButtonCancel, &QPushButton::clicked, search, &EggSearcher4::cancelSearch);
+    ui->progressBarSearcher->setSearcher(search);
 
     search->startSearch();
 }
@@ -292,6 +287,5 @@ void Eggs4::seedToTime()
 void Eggs4::on_pushButtonProfileManager_clicked()
 {
     auto *manager = new ProfileManager4();
-    connect(manager, &ProfileManager4::updateProfiles, this, &Eggs4::refreshProfiles);
     manager->show();
 }
@@ -22,6 +22,7 @@
 
 #include <QMenu>
 #include <Core/Gen4/Profile4.hpp>
+#include <Core/Util/SearchProgress.hpp>
 #include <Models/Gen4/Egg4Model.hpp>
 
 namespace Ui
@@ -33,9 +34,6 @@ class Eggs4 : public QWidget
 {
     Q_OBJECT
 
-signals:
-    void alertProfiles(int);
-
 public:
     explicit Eggs4(QWidget *parent = nullptr);
     ~Eggs4() override;
@@ -51,8 +49,7 @@ private:
     void setupModels();
 
 private slots:
-    void updateProgress(const QVector<Frame4> &frames, int progress);
-    void refreshProfiles();
+    void updateProgress(const QVector<Frame4> &frames, const ProgressReport &progress);
     void on_pushButtonGenerate_clicked();
     void on_pushButtonSearch_clicked();
     void on_comboBoxProfiles_currentIndexChanged(int index);
@@ -21,7 +21,6 @@
 #include "IDs4.hpp"
 #include "ui_IDs4.h"
 #include <Core/Gen4/IDSearcher4.hpp>
-#include <Core/RNG/MTRNG.hpp>
 
 IDs4::IDs4(QWidget *parent) :
     QWidget(parent),
@@ -43,17 +42,14 @@ IDs4::~IDs4()
 
 void IDs4::setupModels()
 {
-    shinyPID = new QStandardItemModel(ui->tableViewShinyPID);
+    shinyPID = new IDs4Model(ui->tableViewShinyPID);
     ui->tableViewShinyPID->setModel(shinyPID);
-    shinyPID->setHorizontalHeaderLabels(QStringList() << tr("Seed") << tr("TID") << tr("SID") << tr("Delay"));
 
-    tidSID = new QStandardItemModel(ui->tableViewTIDSID);
+    tidSID = new IDs4Model(ui->tableViewTIDSID);
     ui->tableViewTIDSID->setModel(tidSID);
-    tidSID->setHorizontalHeaderLabels(QStringList() << tr("Seed") << tr("TID") << tr("SID") << tr("Delay"));
 
-    seedFinder = new QStandardItemModel(ui->tableViewSeedFinder);
+    seedFinder = new IDs4Model(ui->tableViewSeedFinder, true);
     ui->tableViewSeedFinder->setModel(seedFinder);
-    seedFinder->setHorizontalHeaderLabels(QStringList() << tr("Seed") << tr("TID") << tr("SID") << tr("Delay") << tr("Seconds"));
 
     ui->textBoxTIDSIDTID->setValues(InputType::TIDSID);
     ui->textBoxTIDSIDSID->setValues(InputType::TIDSID);
@@ -75,22 +71,16 @@ void IDs4::setupModels()
     if (setting.contains("ids4/geometry")) this->restoreGeometry(setting.value("ids4/geometry").toByteArray());
 }
 
-void IDs4::updateProgressShinyPID(const QVector<QList<QStandardItem *> > &frames, int progress)
+void IDs4::updateProgressShinyPID(const QVector<IDFrame4> &frames, const ProgressReport &progress)
 {
-    for (const auto &item : frames)
-    {
-        shinyPID->appendRow(item);
-    }
-    ui->progressBarShinyPID->setValue(progress);
+    shinyPID->addItems(frames);
+    ui->progressBarShinyPID->setProgress(progress);
 }
 
-void IDs4::updateProgressTIDSID(const QVector<QList<QStandardItem *> > &frames, int progress)
+void IDs4::updateProgressTIDSID(const QVector<IDFrame4> &frames, const ProgressReport &progress)
 {
-    for (const auto &item : frames)
-    {
-        tidSID->appendRow(item);
-    }
-    ui->progressBarTIDSID->setValue(progress);
+    tidSID->addItems(frames);
+    ui->progressBarTIDSID->setProgress(progress);
 }
 
 void IDs4::on_pushButtonShinyPIDSearch_clicked()
@@ -100,7 +90,7 @@ void IDs4::on_pushButtonShinyPIDSearch_clicked()
         return;
     }
 
-    shinyPID->removeRows(0, shinyPID->rowCount());
+    shinyPID->clearModel();
 
     ui->pushButtonShinyPIDSearch->setEnabled(false);
     ui->pushButtonShinyPIDCancel->setEnabled(true);
@@ -115,14 +105,15 @@ void IDs4::on_pushButtonShinyPIDSearch_clicked()
     minDelay += (year - 2000);
     maxDelay += (year - 2000);
 
-    ui->progressBarShinyPID->setValue(0);
-    ui->progressBarShinyPID->setMaximum(static_cast<int>(256 * 24 * (infinite ? 0xE8FFFF : (maxDelay - minDelay + 1))));
+    ui->progressBarShinyPID->setProgress(ProgressReport());
 
-    auto *search = new ShinyPIDSearcher(pid, useTID, tid, year, minDelay, maxDelay, infinite);
+    IDFilter filter(true, pid, useTID, tid, false, 0);
+    auto *search = new IDSearcher4(filter, year, minDelay, maxDelay, infinite);
 
-    connect(search, &ShinyPIDSearcher::finished, this, [ = ] { ui->pushButtonShinyPIDSearch->setEnabled(true); ui->pushButtonShinyPIDCancel->setEnabled(false); });
-    connect(search, &ShinyPIDSearcher::updateProgress, this, &IDs4::updateProgressShinyPID);
-    connect(ui->pushButtonShinyPIDCancel, &QPushButton::clicked, search, &ShinyPIDSearcher::cancelSearch);
+    connect(search, &IDSearcher4::finished, this, [ = ] { ui->pushButtonShinyPIDSearch->setEnabled(true); ui->pushButtonShinyPIDCancel->setEnabled(false); });
+    connect(search, &IDSearcher4::updateProgress, this, &IDs4::updateProgressShinyPID);
+    connect(ui->pushButtonShinyPIDCancel, &QPushButton::clicked, search, &IDSearcher4::cancelSearch);
+    ui->progressBarShinyPID->setSearcher(search);
 
     search->startSearch();
 }
@@ -134,7 +125,7 @@ void IDs4::on_pushButtonTIDSIDSearch_clicked()
         return;
     }
 
-    tidSID->removeRows(0, tidSID->rowCount());
+    tidSID->clearModel();
 
     ui->pushButtonTIDSIDSearch->setEnabled(false);
     ui->pushButtonTIDSIDCancel->setEnabled(true);
@@ -149,14 +140,15 @@ void IDs4::on_pushButtonTIDSIDSearch_clicked()
     minDelay += (year - 2000);
     maxDelay += (year - 2000);
 
-    ui->progressBarTIDSID->setValue(0);
-    ui->progressBarTIDSID->setMaximum(static_cast<int>(256 * 24 * (infinite ? 0xE8FFFF : (maxDelay - minDelay + 1))));
+    ui->progressBarTIDSID->setProgress(ProgressReport());
 
-    auto *search = new TIDSIDSearcher(tid, useSID, searchSID, year, minDelay, maxDelay, infinite);
+    IDFilter filter(false, 0, true, tid, useSID, searchSID);
+    auto *search = new IDSearcher4(filter, year, minDelay, maxDelay, infinite);
 
-    connect(search, &TIDSIDSearcher::finished, this, [ = ] { ui->pushButtonTIDSIDSearch->setEnabled(true); ui->pushButtonTIDSIDCancel->setEnabled(false); });
-    connect(search, &TIDSIDSearcher::updateProgress, this, &IDs4::updateProgressTIDSID);
-    connect(ui->pushButtonTIDSIDCancel, &QPushButton::clicked, search, &TIDSIDSearcher::cancelSearch);
+    connect(search, &IDSearcher4::finished, this, [ = ] { ui->pushButtonTIDSIDSearch->setEnabled(true); ui->pushButtonTIDSIDCancel->setEnabled(false); });
+    connect(search, &IDSearcher4::updateProgress, this, &IDs4::updateProgressTIDSID);
+    connect(ui->pushButtonTIDSIDCancel, &QPushButton::clicked, search, &IDSearcher4::cancelSearch);
+    ui->progressBarTIDSID->setSearcher(search);
 
     search->startSearch();
 }
@@ -168,40 +160,24 @@ void IDs4::on_pushButtonSeedFinderSearch_clicked()
         return;
     }
 
-    seedFinder->removeRows(0, seedFinder->rowCount());
+    seedFinder->clearModel();
 
     u16 tid = ui->textBoxSeedFinderTID->getUShort();
     QDateTime dateTime = ui->dateTimeEdit->dateTime();
-    u32 month = dateTime.date().month();
-    u32 day = dateTime.date().day();
-    u32 year = dateTime.date().year();
-    u32 hour = dateTime.time().hour();
-    u32 minute = dateTime.time().minute();
+    u32 year = static_cast<u32>(dateTime.date().year());
     u32 minDelay = ui->textBoxSeedFinderMinDelay->getUInt();
     u32 maxDelay = ui->textBoxSeedFinderMaxDelay->getUInt();
 
     minDelay += (year - 2000);
     maxDelay += (year - 2000);
 
-    for (u8 second = 0; second < 60; second++)
-    {
-        for (u32 efgh = minDelay; efgh <= maxDelay; efgh++)
-        {
-            u32 seed = (((((month * day) + (minute + second)) & 0xFF) << 24) | (hour << 16)) + efgh;
-
-            MersenneTwister mt(seed, 1);
-            u32 y = mt.nextUInt();
-
-            u16 id = y & 0xFFFF;
-            u16 sid = y >> 16;
-
-            if (tid == id)
-            {
-                u32 delay = efgh + 2000 - year;
-                auto frame = QList<QStandardItem *>() << new QStandardItem(QString::number(seed, 16).toUpper().rightJustified(8, '0')) << new QStandardItem(QString::number(id))
-                             << new QStandardItem(QString::number(sid)) << new QStandardItem(QString::number(delay)) << new QStandardItem(QString::number(second));
-                seedFinder->appendRow(frame);
-            }
-        }
-    }
+    ui->pushButtonSeedFinderSearch->setEnabled(false);
+
+    IDFilter filter(false, 0, true, tid, false, 0);
+    auto *search = new IDSearcher4(filter, dateTime, minDelay, maxDelay);
+
+    connect(search, &IDSearcher4::finished, this, [ = ] { ui->pushButtonSeedFinderSearch->setEnabled(true); });
+    connect(search, &IDSearcher4::updateProgress, this, [ = ](const QVector<IDFrame4> &frames) { seedFinder->addItems(frames); });
+
+    search->startSearch();
 }
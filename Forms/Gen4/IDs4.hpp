@@ -20,9 +20,9 @@
 #ifndef IDS4_HPP
 #define IDS4_HPP
 
-#include <QStandardItemModel>
 #include <QWidget>
-#include <Core/Util/Global.hpp>
+#include <Core/Util/SearchProgress.hpp>
+#include <Models/Gen4/IDs4Model.hpp>
 
 namespace Ui
 {
@@ -42,15 +42,15 @@ public:
 
 private:
     Ui::IDs4 *ui;
-    QStandardItemModel *shinyPID{};
-    QStandardItemModel *tidSID{};
-    QStandardItemModel *seedFinder{};
+    IDs4Model *shinyPID{};
+    IDs4Model *tidSID{};
+    IDs4Model *seedFinder{};
 
     void setupModels();
 
 private slots:
-    void updateProgressShinyPID(const QVector<QList<QStandardItem *>> &frames, int progress);
-    void updateProgressTIDSID(const QVector<QList<QStandardItem *>> &frames, int progress);
+    void updateProgressShinyPID(const QVector<IDFrame4> &frames, const ProgressReport &progress);
+    void updateProgressTIDSID(const QVector<IDFrame4> &frames, const ProgressReport &progress);
     void on_pushButtonShinyPIDSearch_clicked();
     void on_pushButtonTIDSIDSearch_clicked();
     void on_pushButtonSeedFinderSearch_clicked();
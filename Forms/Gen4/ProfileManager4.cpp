@@ -60,7 +60,6 @@ void ProfileManager4::on_pushButtonNew_clicked()
         Profile4 profile = dialog->getNewProfile();
         profile.saveProfile();
         model->addItem(profile);
-        emit updateProfiles();
     }
 }
 
@@ -81,7 +80,6 @@ void ProfileManager4::on_pushButtonEdit_clicked()
         Profile4 profile = dialog->getNewProfile();
         profile.updateProfile(dialog->getOriginal());
         model->updateItem(profile, row);
-        emit updateProfiles();
     }
 }
 
@@ -102,7 +100,5 @@ void ProfileManager4::on_pushButtonDelete_clicked()
         Profile4 profile = model->getItem(row);
         profile.deleteProfile();
         model->removeItem(row);
-
-        emit updateProfiles();
     }
 }
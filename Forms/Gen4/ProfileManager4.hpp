@@ -32,9 +32,6 @@ class ProfileManager4 : public QWidget
 {
     Q_OBJECT
 
-signals:
-    void updateProfiles();
-
 public:
     explicit ProfileManager4(QWidget *parent = nullptr);
     ~ProfileManager4() override;
@@ -21,7 +21,7 @@
 #define SEARCHCALLS_HPP
 
 #include <QDialog>
-#include <Util/DateTime.hpp>
+#include <Core/Gen4/DateTime.hpp>
 
 namespace Ui
 {
@@ -21,6 +21,7 @@
 #include <QSettings>
 #include "SeedtoTime4.hpp"
 #include "ui_SeedtoTime4.h"
+#include <Core/Gen4/SeedtoTimeSearcher4.hpp>
 #include <Core/Util/Utilities.hpp>
 #include <Forms/Gen4/RoamerMap.hpp>
 #include <Forms/Gen4/SearchCalls.hpp>
@@ -65,11 +66,13 @@ SeedtoTime4::~SeedtoTime4()
     QSettings setting;
     setting.beginGroup("seedToTime4");
     setting.setValue("dpptYear", ui->textBoxDPPtYear->text());
+    setting.setValue("dpptEndYear", ui->textBoxDPPtEndYear->text());
     setting.setValue("minusDelayDPPt", ui->lineEditDPPtDelayMinus->text());
     setting.setValue("plusDelayDPPt", ui->lineEditDPPtDelayPlus->text());
     setting.setValue("minusSecondsDPPt", ui->lineEditDPPtSecondMinus->text());
     setting.setValue("plusSecondsDPPt", ui->lineEditDPPtSecondPlus->text());
     setting.setValue("hgssYear", ui->textBoxHGSSYear->text());
+    setting.setValue("hgssEndYear", ui->textBoxHGSSEndYear->text());
     setting.setValue("minusDelayHGSS", ui->lineEditHGSSDelayMinus->text());
     setting.setValue("plusDelayHGSS", ui->lineEditHGSSDelayPlus->text());
     setting.setValue("minusSecondsHGSS", ui->lineEditHGSSSecondMinus->text());
@@ -89,9 +92,11 @@ void SeedtoTime4::setupModels()
 
     ui->textBoxDPPtSeed->setValues(InputType::Seed32Bit);
     ui->textBoxDPPtYear->setValues(0, 2099);
+    ui->textBoxDPPtEndYear->setValues(0, 2099);
     ui->textBoxDPPtSecond->setValues(0, 59);
     ui->textBoxHGSSSeed->setValues(InputType::Seed32Bit);
     ui->textBoxHGSSYear->setValues(0, 2099);
+    ui->textBoxHGSSEndYear->setValues(0, 2099);
     ui->textBoxHGSSSecond->setValues(0, 59);
 
     ui->tableViewDPPtSearch->setModel(dppt);
@@ -102,11 +107,13 @@ void SeedtoTime4::setupModels()
     QSettings setting;
     setting.beginGroup("seedToTime4");
     if (setting.contains("dpptYear")) ui->textBoxDPPtYear->setText(setting.value("dpptYear").toString());
+    if (setting.contains("dpptEndYear")) ui->textBoxDPPtEndYear->setText(setting.value("dpptEndYear").toString());
     if (setting.contains("minusDelayDPPt")) ui->lineEditDPPtDelayMinus->setText(setting.value("minusDelayDPPt").toString());
     if (setting.contains("plusDelayDPPt")) ui->lineEditDPPtDelayPlus->setText(setting.value("plusDelayDPPt").toString());
     if (setting.contains("minusSecondsDPPt")) ui->lineEditDPPtSecondMinus->setText(setting.value("minusSecondsDPPt").toString());
     if (setting.contains("plusSecondsDPPt")) ui->lineEditDPPtSecondPlus->setText(setting.value("plusSecondsDPPt").toString());
     if (setting.contains("hgssYear")) ui->textBoxHGSSYear->setText(setting.value("hgssYear").toString());
+    if (setting.contains("hgssEndYear")) ui->textBoxHGSSEndYear->setText(setting.value("hgssEndYear").toString());
     if (setting.contains("minusDelayHGSS")) ui->lineEditHGSSDelayMinus->setText(setting.value("minusDelayHGSS").toString());
     if (setting.contains("plusDelayHGSS")) ui->lineEditHGSSDelayPlus->setText(setting.value("plusDelayHGSS").toString());
     if (setting.contains("minusSecondsHGSS")) ui->lineEditHGSSSecondMinus->setText(setting.value("minusSecondsHGSS").toString());
@@ -115,113 +122,59 @@ void SeedtoTime4::setupModels()
     setting.endGroup();
 }
 
-QVector<DateTime> SeedtoTime4::generate(u32 seed, u32 year, bool forceSecond, int forcedSecond, Game version)
+void SeedtoTime4::generate(u32 seed, u32 minYear, u32 maxYear, bool forceSecond, int forcedSecond, Game version, SeedtoTime4Model *model, QPushButton *button)
 {
-    if (year < 2000 || year > 2099)
+    if (minYear < 2000 || maxYear > 2099)
     {
         QMessageBox error;
-        error.setText(tr("Please enter a year between 2000 and 2099"));
+        error.setText(tr("Please enter years between 2000 and 2099"));
         error.exec();
-        return QVector<DateTime>();
+        return;
     }
 
-    u8 ab = seed >> 24;
-    u8 cd = (seed >> 16) & 0xFF;
-    u32 efgh = seed & 0xFFFF;
-
-    u32 delay = efgh + (2000 - year);
-    u32 hour = cd;
-
-    if (hour > 23)
+    if (minYear > maxYear)
     {
         QMessageBox error;
-        error.setText(tr("Seed is invalid. Please enter a valid seed."));
+        error.setText(tr("Start year must not be after the end year"));
         error.exec();
-        return QVector<DateTime>();
+        return;
     }
 
     QVector<bool> roamer = { ui->checkBoxHGSSRaikou->isChecked(), ui->checkBoxHGSSEntei->isChecked(), ui->checkBoxHGSSLati->isChecked() };
     QVector<u8> routes = { static_cast<u8>(ui->lineEditHGSSRaikou->text().toUInt()), static_cast<u8>(ui->lineEditHGSSEntei->text().toUInt()), static_cast<u8>(ui->lineEditHGSSLati->text().toUInt()) };
 
-    QVector<DateTime> results;
-    for (int month = 0; month < 13; month++)
+    SeedtoTimeCalc4 calc(seed, version, roamer, routes);
+    if (!calc.isValid())
     {
-        int maxDays = QDate(static_cast<int>(year), month, 1).daysInMonth();
-        for (int day = 1; day <= maxDays; day++)
-        {
-            for (int minute = 0; minute < 60; minute++)
-            {
-                for (int second = 0; second < 60; second++)
-                {
-                    if (ab == ((month * day + minute + second) & 0xFF))
-                    {
-                        if (!forceSecond || second == forcedSecond)
-                        {
-                            QDateTime dateTime(QDate(static_cast<int>(year), month, day), QTime(static_cast<int>(hour), minute, second));
-                            results.append(DateTime(dateTime, delay, version, roamer, routes));
-                        }
-                    }
-                }
-            }
-        }
+        QMessageBox error;
+        error.setText(tr("Seed is invalid. Please enter a valid seed."));
+        error.exec();
+        return;
     }
-    return results;
-}
 
-QVector<DateTime> SeedtoTime4::calibrate(int minusDelay, int plusDelay, int minusSecond, int plusSecond, const DateTime &target)
-{
-    QDateTime time = target.getDateTime();
-    u32 delay = target.getDelay();
+    button->setEnabled(false);
 
-    QVector<int> secondRange;
-    QVector<int> delayRange;
+    auto *search = new SeedtoTimeSearcher4(calc, minYear, maxYear, forceSecond, forcedSecond);
 
-    for (int i = minusDelay; i > 0; i--)
-    {
-        delayRange.append(-i);
-    }
-    for (int i = 0; i <= plusDelay; i++)
-    {
-        delayRange.append(i);
-    }
-
-    for (int i = minusSecond; i > 0; i--)
-    {
-        secondRange.append(-i);
-    }
-    for (int i = 0; i <= plusSecond; i++)
-    {
-        secondRange.append(i);
-    }
+    connect(search, &SeedtoTimeSearcher4::finished, this, [ = ] { button->setEnabled(true); });
+    connect(search, &SeedtoTimeSearcher4::updateProgress, this, [ = ](const QVector<DateTime> &results) { model->addItems(results); });
 
-    QVector<DateTime> results;
-    for (int i : secondRange)
-    {
-        for (int j : delayRange)
-        {
-            QDateTime offset = time.addSecs(i);
-            DateTime result(offset, delay + j, target.getVersion(), target.getInfo());
-            results.append(result);
-        }
-    }
-
-    return results;
+    search->startSearch();
 }
 
 void SeedtoTime4::on_pushButtonDPPtGenerate_clicked()
 {
     u32 seed = ui->textBoxDPPtSeed->getUInt();
-    u32 year = ui->textBoxDPPtYear->getUInt();
+    u32 minYear = ui->textBoxDPPtYear->getUInt();
+    u32 maxYear = ui->textBoxDPPtEndYear->getUInt();
 
     bool forceSecond = ui->checkBoxDPPtSecond->isChecked();
     int forcedSecond = ui->textBoxDPPtSecond->getInt();
 
     dppt->clearModel();
 
-    QVector<DateTime> results = generate(seed, year, forceSecond, forcedSecond, Game::Diamond);
+    generate(seed, minYear, maxYear, forceSecond, forcedSecond, Game::Diamond, dppt, ui->pushButtonDPPtGenerate);
     ui->labelDPPtCoinFlips->setText(tr("Coin Flips: ") + Utilities::coinFlips(seed, 15));
-
-    dppt->addItems(results);
 }
 
 void SeedtoTime4::on_pushButtonHGSSGenerate_clicked()
@@ -229,7 +182,8 @@ void SeedtoTime4::on_pushButtonHGSSGenerate_clicked()
     hgss->clearModel();
 
     u32 seed = ui->textBoxHGSSSeed->getUInt();
-    u32 year = ui->textBoxHGSSYear->getUInt();
+    u32 minYear = ui->textBoxHGSSYear->getUInt();
+    u32 maxYear = ui->textBoxHGSSEndYear->getUInt();
 
     bool forceSecond = ui->checkBoxHGSSSecond->isChecked();
     int forcedSecond = ui->textBoxHGSSSecond->getInt();
@@ -239,13 +193,11 @@ void SeedtoTime4::on_pushButtonHGSSGenerate_clicked()
 
     HGSSRoamer info(seed, roamer, routes);
 
-    QVector<DateTime> results = generate(seed, year, forceSecond, forcedSecond, Game::HeartGold);
+    generate(seed, minYear, maxYear, forceSecond, forcedSecond, Game::HeartGold, hgss, ui->pushButtonHGSSGenerate);
     ui->labelHGSSElmCalls->setText(tr("Elm Calls: ") + Utilities::getCalls(seed, 15, info));
     QString str = info.getRouteString();
     str = str.isEmpty() ? tr("No roamers") : str;
     ui->labelHGSSRoamers->setText(tr("Roamers: ") + str);
-
-    hgss->addItems(results);
 }
 
 void SeedtoTime4::on_pushButtonDPPtCalibrate_clicked()
@@ -269,7 +221,7 @@ void SeedtoTime4::on_pushButtonDPPtCalibrate_clicked()
     dpptCalibrate->clearModel();
 
     DateTime target = dppt->getItem(index.row());
-    QVector<DateTime> results = calibrate(minusDelay, plusDelay, minusSecond, plusSecond, target);
+    QVector<DateTime> results = SeedtoTimeCalc4::calibrate(minusDelay, plusDelay, minusSecond, plusSecond, target);
 
     dpptCalibrate->addItems(results);
 
@@ -301,7 +253,7 @@ void SeedtoTime4::on_pushButtonHGSSCalibrate_clicked()
     hgssCalibrate->clearModel();
 
     DateTime target = hgss->getItem(index.row());
-    QVector<DateTime> results = calibrate(minusDelay, plusDelay, minusSecond, plusSecond, target);
+    QVector<DateTime> results = SeedtoTimeCalc4::calibrate(minusDelay, plusDelay, minusSecond, plusSecond, target);
 
     hgssCalibrate->addItems(results);
 
@@ -20,6 +20,7 @@
 #ifndef SEEDTOTIME4_HPP
 #define SEEDTOTIME4_HPP
 
+#include <QPushButton>
 #include <QWidget>
 #include <Core/Gen4/Profile4.hpp>
 #include <Models/Gen4/SeedtoTime4Model.hpp>
@@ -46,8 +47,7 @@ private:
     SeedtoTime4Model *hgssCalibrate{};
 
     void setupModels();
-    QVector<DateTime> generate(u32 seed, u32 year, bool forceSecond, int forcedSecond, Game version);
-    QVector<DateTime> calibrate(int minusDelay, int plusDelay, int minusSecond, int plusSecond, const DateTime &target);
+    void generate(u32 seed, u32 minYear, u32 maxYear, bool forceSecond, int forcedSecond, Game version, SeedtoTime4Model *model, QPushButton *button);
 
 private slots:
     void on_pushButtonDPPtGenerate_clicked();
@@ -24,6 +24,7 @@
 #include <Core/Gen4/IVSearcher4.hpp>
 #include <Core/Util/Nature.hpp>
 #include <Core/Util/Power.hpp>
+#include <Core/Util/SessionFile.hpp>
 #include <Forms/Gen4/ProfileManager4.hpp>
 #include <Forms/Gen4/SeedtoTime4.hpp>
 
@@ -131,17 +132,33 @@ void Stationary4::setupModels()
 
     QAction *outputTXTGenerator = generatorMenu->addAction(tr("Output Results to TXT"));
     QAction *outputCSVGenerator = generatorMenu->addAction(tr("Output Results to CSV"));
+    QAction *outputBinaryGenerator = generatorMenu->addAction(tr("Output Results to Binary"));
 
     connect(outputTXTGenerator, &QAction::triggered, [ = ]() { ui->tableViewGenerator->outputModelTXT(); });
     connect(outputCSVGenerator, &QAction::triggered, [ = ]() { ui->tableViewGenerator->outputModelCSV(); });
+    connect(outputBinaryGenerator, &QAction::triggered, [ = ]() { ui->tableViewGenerator->outputModelBinary(); });
 
     QAction *seedToTime = searcherMenu->addAction(tr("Generate times for seed"));
     QAction *outputTXTSearcher = searcherMenu->addAction(tr("Output Results to TXT"));
     QAction *outputCSVSearcher = searcherMenu->addAction(tr("Output Results to CSV"));
+    QAction *outputBinarySearcher = searcherMenu->addAction(tr("Output Results to Binary"));
+    QAction *saveSessionSearcher = searcherMenu->addAction(tr("Save Session"));
+    QAction *openSessionSearcher = searcherMenu->addAction(tr("Open Session"));
 
     connect(seedToTime, &QAction::triggered, this, &Stationary4::seedToTime);
     connect(outputTXTSearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->outputModelTXT(); });
     connect(outputCSVSearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->outputModelCSV(); });
+    connect(outputBinarySearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->outputModelBinary(); });
+    connect(saveSessionSearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->saveSession(searcherProvenance); });
+    connect(openSessionSearcher, &QAction::triggered, [ = ]()
+    {
+        QJsonObject provenance = ui->tableViewSearcher->openSession();
+        if (!provenance.isEmpty())
+        {
+            searcherProvenance = provenance;
+            searcherModel->setMethod(static_cast<Method>(provenance["method"].toInt()));
+        }
+    });
 
     QSettings setting;
     setting.beginGroup("stationary4");
@@ -153,15 +170,10 @@ void Stationary4::setupModels()
     setting.endGroup();
 }
 
-void Stationary4::updateProgress(const QVector<Frame4> &frames, int progress)
+void Stationary4::updateProgress(const QVector<Frame4> &frames, const ProgressReport &progress)
 {
     searcherModel->addItems(frames);
-    ui->progressBar->setValue(progress);
-}
-
-void Stationary4::refreshProfiles()
-{
-    emit alertProfiles(4);
+    ui->progressBar->setProgress(progress);
 }
 
 void Stationary4::on_pushButtonGenerate_clicked()
@@ -208,6 +220,7 @@ void Stationary4::on_pushButtonGenerate_clicked()
 
     QVector<Frame4> frames = generator.generate(compare);
     generatorModel->addItems(frames);
+    ui->profilePanel->setProfile(generator.getProfile());
 }
 
 void Stationary4::on_pushButtonSearch_clicked()
@@ -226,6 +239,7 @@ void Stationary4::on_pushButtonSearch_clicked()
                          ui->checkBoxSearcherShinyOnly->isChecked(), false,
                          ui->ivFilterSearcher->getLower(), ui->ivFilterSearcher->getUpper(), ui->comboBoxSearcherNature->getChecked(),
                          ui->comboBoxSearcherHiddenPower->getChecked(), QVector<bool>());
+    searcherProvenance = SessionFile::createProvenance(profiles.at(ui->comboBoxProfiles->currentIndex()).getJson(), static_cast<Method>(ui->comboBoxSearcherMethod->currentData().toInt()), compare);
     Searcher4 searcher(tid, sid, genderRatio, ui->textBoxSearcherMinDelay->getUInt(), ui->textBoxSearcherMaxDelay->getUInt(),
                        ui->textBoxSearcherMinFrame->getUInt(), ui->textBoxSearcherMaxFrame->getUInt(), compare, static_cast<Method>(ui->comboBoxSearcherMethod->currentData().toInt()));
     searcher.setLeadType(static_cast<Lead>(ui->comboBoxSearcherLead->currentData().toInt()));
@@ -239,14 +253,15 @@ void Stationary4::on_pushButtonSearch_clicked()
         maxProgress *= max.at(i) - min.at(i) + 1;
     }
 
-    ui->progressBar->setValue(0);
-    ui->progressBar->setMaximum(maxProgress);
+    ui->progressBar->setProgress(ProgressReport());
 
     auto *search = new IVSearcher4(searcher, min, max);
 
     connect(search, &IVSearcher4::finished, this, [ = ] { ui->pushButtonSearch->setEnabled(true); ui->pushButtonCancel->setEnabled(false); });
+    connect(search, &IVSearcher4::finished, this, [ = ] { ui->profilePanel->setProfile(search->getProfile()); });
     connect(search, &IVSearcher4::updateProgress, this, &Stationary4::updateProgress);
     connect(ui->pushButtonCancel, &QPushButton::clicked, search, &IVSearcher4::cancelSearch);
+    ui->progressBar->setSearcher(search);
 
     search->startSearch();
 }
@@ -338,6 +353,5 @@ void Stationary4::on_tableViewSearcher_customContextMenuRequested(const QPoint &
 void Stationary4::on_pushButtonProfileManager_clicked()
 {
     auto *manager = new ProfileManager4();
-    connect(manager, &ProfileManager4::updateProfiles, this, &Stationary4::refreshProfiles);
     manager->show();
 }
@@ -22,6 +22,7 @@
 
 #include <QMenu>
 #include <Core/Gen4/Profile4.hpp>
+#include <Core/Util/SearchProgress.hpp>
 #include <Models/Gen4/Searcher4Model.hpp>
 #include <Models/Gen4/Stationary4Model.hpp>
 
@@ -34,9 +35,6 @@ class Stationary4 : public QWidget
 {
     Q_OBJECT
 
-signals:
-    void alertProfiles(int);
-
 public:
     explicit Stationary4(QWidget *parent = nullptr);
     ~Stationary4() override;
@@ -49,12 +47,12 @@ private:
     QVector<Profile4> profiles;
     QMenu *generatorMenu{};
     QMenu *searcherMenu{};
+    QJsonObject searcherProvenance;
 
     void setupModels();
 
 private slots:
-    void updateProgress(const QVector<Frame4> &frames, int progress);
-    void refreshProfiles();
+    void updateProgress(const QVector<Frame4> &frames, const ProgressReport &progress);
     void on_pushButtonGenerate_clicked();
     void on_pushButtonSearch_clicked();
     void on_comboBoxProfiles_currentIndexChanged(int index);
@@ -25,6 +25,7 @@
 #include <Core/Gen4/IVSearcher4.hpp>
 #include <Core/Util/Nature.hpp>
 #include <Core/Util/Power.hpp>
+#include <Core/Util/SessionFile.hpp>
 #include <Core/Util/Translator.hpp>
 #include <Forms/Gen4/ProfileManager4.hpp>
 #include <Forms/Gen4/SeedtoTime4.hpp>
@@ -132,17 +133,33 @@ void Wild4::setupModels()
 
     QAction *outputTXTGenerator = generatorMenu->addAction(tr("Output Results to TXT"));
     QAction *outputCSVGenerator = generatorMenu->addAction(tr("Output Results to CSV"));
+    QAction *outputBinaryGenerator = generatorMenu->addAction(tr("Output Results to Binary"));
 
     connect(outputTXTGenerator, &QAction::triggered, [ = ]() { ui->tableViewGenerator->outputModelTXT(); });
     connect(outputCSVGenerator, &QAction::triggered, [ = ]() { ui->tableViewGenerator->outputModelCSV(); });
+    connect(outputBinaryGenerator, &QAction::triggered, [ = ]() { ui->tableViewGenerator->outputModelBinary(); });
 
     QAction *seedToTime = searcherMenu->addAction(tr("Generate times for seed"));
     QAction *outputTXTSearcher = searcherMenu->addAction(tr("Output Results to TXT"));
     QAction *outputCSVSearcher = searcherMenu->addAction(tr("Output Results to CSV"));
+    QAction *outputBinarySearcher = searcherMenu->addAction(tr("Output Results to Binary"));
+    QAction *saveSessionSearcher = searcherMenu->addAction(tr("Save Session"));
+    QAction *openSessionSearcher = searcherMenu->addAction(tr("Open Session"));
 
     connect(seedToTime, &QAction::triggered, this, &Wild4::seedToTime);
     connect(outputTXTSearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->outputModelTXT(); });
     connect(outputCSVSearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->outputModelCSV(); });
+    connect(outputBinarySearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->outputModelBinary(); });
+    connect(saveSessionSearcher, &QAction::triggered, [ = ]() { ui->tableViewSearcher->saveSession(searcherProvenance); });
+    connect(openSessionSearcher, &QAction::triggered, [ = ]()
+    {
+        QJsonObject provenance = ui->tableViewSearcher->openSession();
+        if (!provenance.isEmpty())
+        {
+            searcherProvenance = provenance;
+            searcherModel->setMethod(static_cast<Method>(provenance["method"].toInt()));
+        }
+    });
 
     QSettings setting;
     setting.beginGroup("wild4");
@@ -232,15 +249,10 @@ void Wild4::updatePokemonSearcher()
     }
 }
 
-void Wild4::updateProgress(const QVector<Frame4> &frames, int progress)
+void Wild4::updateProgress(const QVector<Frame4> &frames, const ProgressReport &progress)
 {
     searcherModel->addItems(frames);
-    ui->progressBar->setValue(progress);
-}
-
-void Wild4::refreshProfiles()
-{
-    emit alertProfiles(4);
+    ui->progressBar->setProgress(progress);
 }
 
 void Wild4::on_pushButtonGenerate_clicked()
@@ -292,6 +304,7 @@ void Wild4::on_pushButtonGenerate_clicked()
 
     QVector<Frame4> frames = generator.generate(compare);
     generatorModel->addItems(frames);
+    ui->profilePanel->setProfile(generator.getProfile());
 }
 
 void Wild4::on_pushButtonSearch_clicked()
@@ -310,6 +323,7 @@ void Wild4::on_pushButtonSearch_clicked()
                          ui->checkBoxSearcherShinyOnly->isChecked(), false,
                          ui->ivFilterSearcher->getLower(), ui->ivFilterSearcher->getUpper(), ui->comboBoxSearcherNature->getChecked(),
                          ui->comboBoxSearcherHiddenPower->getChecked(), ui->comboBoxSearcherEncounterSlot->getChecked());
+    searcherProvenance = SessionFile::createProvenance(profiles.at(ui->comboBoxProfiles->currentIndex()).getJson(), static_cast<Method>(ui->comboBoxSearcherMethod->currentData().toInt()), compare);
     Searcher4 searcher(tid, sid, genderRatio, ui->textBoxSearcherMinDelay->getUInt(), ui->textBoxSearcherMaxDelay->getUInt(),
                        ui->textBoxSearcherMinFrame->getUInt(), ui->textBoxSearcherMaxFrame->getUInt(), compare, static_cast<Method>(ui->comboBoxSearcherMethod->currentData().toInt()));
 
@@ -320,20 +334,15 @@ void Wild4::on_pushButtonSearch_clicked()
     QVector<u8> min = ui->ivFilterSearcher->getLower();
     QVector<u8> max = ui->ivFilterSearcher->getUpper();
 
-    int maxProgress = 1;
-    for (u8 i = 0; i < 6; i++)
-    {
-        maxProgress *= max.at(i) - min.at(i) + 1;
-    }
-
-    ui->progressBar->setValue(0);
-    ui->progressBar->setMaximum(maxProgress);
+    ui->progressBar->setProgress(ProgressReport());
 
     auto *search = new IVSearcher4(searcher, min, max);
 
     connect(search, &IVSearcher4::finished, this, [ = ] { ui->pushButtonSearch->setEnabled(true); ui->pushButtonCancel->setEnabled(false); });
+    connect(search, &IVSearcher4::finished, this, [ = ] { ui->profilePanel->setProfile(search->getProfile()); });
     connect(search, &IVSearcher4::updateProgress, this, &Wild4::updateProgress);
     connect(ui->pushButtonCancel, &QPushButton::clicked, search, &IVSearcher4::cancelSearch);
+    ui->progressBar->setSearcher(search);
 
     search->startSearch();
 }
@@ -599,6 +608,5 @@ void Wild4::on_tableViewSearcher_customContextMenuRequested(const QPoint &pos)
 void Wild4::on_pushButtonProfileManager_clicked()
 {
     auto *manager = new ProfileManager4();
-    connect(manager, &ProfileManager4::updateProfiles, this, &Wild4::refreshProfiles);
     manager->show();
 }
@@ -23,6 +23,7 @@
 #include <QMenu>
 #include <Core/Gen4/EncounterArea4.hpp>
 #include <Core/Gen4/Profile4.hpp>
+#include <Core/Util/SearchProgress.hpp>
 #include <Models/Gen4/Searcher4Model.hpp>
 #include <Models/Gen4/Wild4Model.hpp>
 
@@ -35,9 +36,6 @@ class Wild4 : public QWidget
 {
     Q_OBJECT
 
-signals:
-    void alertProfiles(int);
-
 public:
     explicit Wild4(QWidget *parent = nullptr);
     ~Wild4() override;
@@ -50,6 +48,7 @@ private:
     Wild4Model *generatorModel{};
     QMenu *generatorMenu{};
     QMenu *searcherMenu{};
+    QJsonObject searcherProvenance;
     QVector<EncounterArea4> encounterGenerator;
     QVector<EncounterArea4> encounterSearcher;
 
@@ -60,8 +59,7 @@ private:
     void updatePokemonSearcher();
 
 private slots:
-    void updateProgress(const QVector<Frame4> &frames, int progress);
-    void refreshProfiles();
+    void updateProgress(const QVector<Frame4> &frames, const ProgressReport &progress);
     void on_pushButtonGenerate_clicked();
     void on_pushButtonSearch_clicked();
     void on_comboBoxProfiles_currentIndexChanged(int index);
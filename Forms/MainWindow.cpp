@@ -17,10 +17,13 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <QApplication>
 #include <QDesktopServices>
 #include <QtNetwork>
 #include "MainWindow.hpp"
 #include "ui_MainWindow.h"
+#include <Core/Util/ProfileStore.hpp>
+#include <Core/Util/SearchScheduler.hpp>
 #include <Forms/Gen3/GameCubeRTC.hpp>
 #include <Forms/Gen3/GameCubeSeedFinder.hpp>
 #include <Forms/Gen3/JirachiPattern.hpp>
@@ -35,6 +38,8 @@
 #include <Forms/Util/IVtoPID.hpp>
 #include <Forms/Util/Researcher.hpp>
 
+#define UPDATE_TIMEOUT 10000
+
 MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent),
     ui(new Ui::MainWindow)
@@ -43,6 +48,16 @@ MainWindow::MainWindow(QWidget *parent) :
 
     setupLanguage();
     setupStyle();
+    connect(&ProfileStore::getInstance(), &ProfileStore::profilesChanged, this, &MainWindow::updateProfiles);
+
+    // Searches started from the window in use are scheduled ahead of those in the background
+    connect(qApp, &QApplication::focusChanged, this, [](QWidget *, QWidget *now)
+    {
+        if (now != nullptr)
+        {
+            SearchScheduler::getInstance().setForeground(now->window());
+        }
+    });
     QTimer::singleShot(1000, this, &MainWindow::checkUpdates);
 
     QSettings setting;
@@ -51,6 +66,8 @@ MainWindow::MainWindow(QWidget *parent) :
 
 MainWindow::~MainWindow()
 {
+    cancelUpdateCheck();
+
     QSettings setting;
     setting.beginGroup("settings");
     setting.setValue("locale", currentLanguage);
@@ -128,32 +145,60 @@ void MainWindow::checkUpdates()
     QDate today = QDate::currentDate();
     QDate lastOpened = setting.value("settings/lastOpened", today).toDate();
 
-    if (lastOpened.daysTo(today) > 0)
+    if (lastOpened.daysTo(today) > 0 && !updateReply)
     {
-        QNetworkAccessManager manager;
-        QNetworkRequest request(QUrl("https://api.github.com/repos/Admiral-Fish/PokeFinder/releases/latest"));
-        QScopedPointer<QNetworkReply> reply(manager.get(request));
-
-        QEventLoop loop;
-        connect(reply.data(), SIGNAL(finished()), &loop, SLOT(quit()));
-        connect(reply.data(), SIGNAL(error(QNetworkReply::NetworkError)), &loop, SLOT(quit()));
-        loop.exec();
-
-        auto response = QJsonDocument::fromJson(reply->readAll());
-        QString webVersion = response.object()["tag_name"].toString();
-        if (!webVersion.isEmpty() && VERSION != webVersion)
+        if (!manager)
         {
-            QMessageBox info(QMessageBox::Question, tr("Update Check"), tr("An update is available. Would you like to download the newest version?"), QMessageBox::Yes | QMessageBox::No);
-            if (info.exec() == QMessageBox::Yes)
-            {
-                QDesktopServices::openUrl(QUrl("https://github.com/Admiral-Fish/PokeFinder/releases/latest"));
-            }
+            manager = new QNetworkAccessManager(this);
         }
+
+        // The release endpoint can be pointed at a local server for testing
+        QUrl url(setting.value("settings/updateUrl", "https://api.github.com/repos/Admiral-Fish/PokeFinder/releases/latest").toString());
+        updateReply = manager->get(QNetworkRequest(url));
+
+        connect(updateReply, &QNetworkReply::finished, this, &MainWindow::updateCheckFinished);
+        QTimer::singleShot(UPDATE_TIMEOUT, updateReply, &QNetworkReply::abort);
     }
 
     setting.setValue("settings/lastOpened", today);
 }
 
+void MainWindow::cancelUpdateCheck()
+{
+    if (updateReply)
+    {
+        disconnect(updateReply, nullptr, this, nullptr);
+        updateReply->abort();
+        updateReply->deleteLater();
+    }
+}
+
+void MainWindow::updateCheckFinished()
+{
+    QNetworkReply *reply = updateReply;
+    if (!reply)
+    {
+        return;
+    }
+    reply->deleteLater();
+
+    if (reply->error() != QNetworkReply::NoError)
+    {
+        return;
+    }
+
+    auto response = QJsonDocument::fromJson(reply->readAll());
+    QString webVersion = response.object()["tag_name"].toString();
+    if (!webVersion.isEmpty() && VERSION != webVersion)
+    {
+        QMessageBox info(QMessageBox::Question, tr("Update Check"), tr("An update is available. Would you like to download the newest version?"), QMessageBox::Yes | QMessageBox::No);
+        if (info.exec() == QMessageBox::Yes)
+        {
+            QDesktopServices::openUrl(QUrl("https://github.com/Admiral-Fish/PokeFinder/releases/latest"));
+        }
+    }
+}
+
 void MainWindow::slotLanguageChanged(QAction *action)
 {
     if (action)
@@ -214,7 +259,6 @@ void MainWindow::on_pushButtonStationary3_clicked()
     if (!stationary3)
     {
         stationary3 = new Stationary3();
-        connect(stationary3, &Stationary3::alertProfiles, this, &MainWindow::updateProfiles);
     }
     stationary3->show();
     stationary3->raise();
@@ -225,7 +269,6 @@ void MainWindow::on_pushButtonWild3_clicked()
     if (!wild3)
     {
         wild3 = new Wild3();
-        connect(wild3, &Wild3::alertProfiles, this, &MainWindow::updateProfiles);
     }
     wild3->show();
     wild3->raise();
@@ -236,7 +279,6 @@ void MainWindow::on_pushButtonGameCube_clicked()
     if (!gamecube)
     {
         gamecube = new GameCube();
-        connect(gamecube, &GameCube::alertProfiles, this, &MainWindow::updateProfiles);
     }
     gamecube->show();
     gamecube->raise();
@@ -247,7 +289,6 @@ void MainWindow::on_pushButtonEgg3_clicked()
     if (!egg3)
     {
         egg3 = new Eggs3();
-        connect(egg3, &Eggs3::alertProfiles, this, &MainWindow::updateProfiles);
     }
     egg3->show();
     egg3->raise();
@@ -328,7 +369,6 @@ void MainWindow::on_pushButtonStationary4_clicked()
     if (!stationary4)
     {
         stationary4 = new Stationary4();
-        connect(stationary4, &Stationary4::alertProfiles, this, &MainWindow::updateProfiles);
     }
     stationary4->show();
     stationary4->raise();
@@ -339,7 +379,6 @@ void MainWindow::on_pushButtonWild4_clicked()
     if (!wild4)
     {
         wild4 = new Wild4();
-        connect(wild4, &Wild4::alertProfiles, this, &MainWindow::updateProfiles);
     }
     wild4->show();
     wild4->raise();
@@ -350,7 +389,6 @@ void MainWindow::on_pushButtonEgg4_clicked()
     if (!egg4)
     {
         egg4 = new Eggs4();
-        connect(egg4, &Eggs4::alertProfiles, this, &MainWindow::updateProfiles);
     }
     egg4->show();
     egg4->raise();
@@ -21,6 +21,7 @@
 #define MAINWINDOW_HPP
 
 #include <QMainWindow>
+#include <QPointer>
 #include <Forms/Gen3/Eggs3.hpp>
 #include <Forms/Gen3/GameCube.hpp>
 #include <Forms/Gen3/IDs3.hpp>
@@ -31,6 +32,9 @@
 #include <Forms/Gen4/Stationary4.hpp>
 #include <Forms/Gen4/Wild4.hpp>
 
+class QNetworkAccessManager;
+class QNetworkReply;
+
 namespace Ui
 {
     class MainWindow;
@@ -61,14 +65,18 @@ private:
     Wild4 *wild4{};
     Eggs4 *egg4{};
     IDs4 *ids4{};
+    QNetworkAccessManager *manager{};
+    QPointer<QNetworkReply> updateReply;
 
     void setupLanguage();
     void setupStyle();
     void checkUpdates();
+    void cancelUpdateCheck();
 
 private slots:
     void slotLanguageChanged(QAction *action);
     void slotStyleChanged(QAction *action);
+    void updateCheckFinished();
     void updateProfiles(int num);
     void on_pushButtonStationary3_clicked();
     void on_pushButtonWild3_clicked();
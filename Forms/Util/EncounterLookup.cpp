@@ -24,6 +24,26 @@
 #include <Core/Gen4/Encounters4.hpp>
 #include <Core/Util/Translator.hpp>
 
+// The index only holds ids so it stays valid after the language changes,
+// each entry is packed as location << 32 | encounter type << 16 | min level << 8 | max level
+namespace
+{
+    u64 packEncounter(u8 location, Encounter type, u8 minLevel, u8 maxLevel)
+    {
+        return static_cast<u64>(location) << 32 | static_cast<u64>(type) << 16 | static_cast<u64>(minLevel) << 8 | maxLevel;
+    }
+
+    u8 getLocation(u64 encounter)
+    {
+        return static_cast<u8>(encounter >> 32);
+    }
+
+    Encounter getType(u64 encounter)
+    {
+        return static_cast<Encounter>((encounter >> 16) & 0xffff);
+    }
+}
+
 EncounterLookup::EncounterLookup(QWidget *parent) :
     QWidget(parent),
     ui(new Ui::EncounterLookup)
@@ -65,9 +85,37 @@ void EncounterLookup::setupModels()
     if (setting.contains("encounterLookup/geometry")) this->restoreGeometry(setting.value("encounterLookup/geometry").toByteArray());
 }
 
-QSet<QPair<u8, QString>> EncounterLookup::getEncounters3(Game game, u16 specie)
+QSet<u64> EncounterLookup::getEncounters3(Game game, u16 specie)
+{
+    // Built once per game, after that a lookup is a single hash probe
+    static QHash<int, QHash<u16, QSet<u64>>> indexes;
+
+    auto index = indexes.find(game);
+    if (index == indexes.end())
+    {
+        index = indexes.insert(game, getIndex3(game));
+    }
+
+    return index->value(specie);
+}
+
+QSet<u64> EncounterLookup::getEncounters4(Game game, u16 specie)
+{
+    // Built once per game, after that a lookup is a single hash probe
+    static QHash<int, QHash<u16, QSet<u64>>> indexes;
+
+    auto index = indexes.find(game);
+    if (index == indexes.end())
+    {
+        index = indexes.insert(game, getIndex4(game));
+    }
+
+    return index->value(specie);
+}
+
+QHash<u16, QSet<u64>> EncounterLookup::getIndex3(Game game)
 {
-    QSet<QPair<u8, QString>> encounters;
+    QHash<u16, QSet<u64>> index;
     Profile3 profile("", game, 0, 0);
 
     // Encounter variables to iterate through
@@ -75,30 +123,15 @@ QSet<QPair<u8, QString>> EncounterLookup::getEncounters3(Game game, u16 specie)
 
     for (const auto &type : types)
     {
-        QVector<EncounterArea3> areas = Encounters3(type, profile).getEncounters();
-        for (const auto &area : areas)
-        {
-            QVector<Slot> pokemon = area.getPokemon();
-            for (const auto &entry : pokemon)
-            {
-                if (entry.getSpecie() == specie)
-                {
-                    QString info = getEncounterString(type);
-                    QPair<u8, u8> range = area.getLevelRange(specie);
-                    info += QString("/%1-%2").arg(range.first).arg(range.second);
-                    encounters.insert(qMakePair(area.getLocation(), info));
-                    break;
-                }
-            }
-        }
+        addAreas(index, Encounters3(type, profile).getEncounters(), type);
     }
 
-    return encounters;
+    return index;
 }
 
-QSet<QPair<u8, QString>> EncounterLookup::getEncounters4(Game game, u16 specie)
+QHash<u16, QSet<u64>> EncounterLookup::getIndex4(Game game)
 {
-    QSet<QPair<u8, QString>> encounters;
+    QHash<u16, QSet<u64>> index;
     QVector<Profile4> profiles;
 
     // Encounter variables to iterate through
@@ -136,27 +169,25 @@ QSet<QPair<u8, QString>> EncounterLookup::getEncounters4(Game game, u16 specie)
         {
             for (const auto &time : { 0, 1, 2 })
             {
-                QVector<EncounterArea4> areas = Encounters4(type, time, profile).getEncounters();
-                for (const auto &area : areas)
-                {
-                    QVector<Slot> pokemon = area.getPokemon();
-                    for (const auto &entry : pokemon)
-                    {
-                        if (entry.getSpecie() == specie)
-                        {
-                            QString info = getEncounterString(type);
-                            QPair<u8, u8> range = area.getLevelRange(specie);
-                            info += QString("/%1-%2").arg(range.first).arg(range.second);
-                            encounters.insert(qMakePair(area.getLocation(), info));
-                            break;
-                        }
-                    }
-                }
+                addAreas(index, Encounters4(type, time, profile).getEncounters(), type);
             }
         }
     }
 
-    return encounters;
+    return index;
+}
+
+template <typename Area>
+void EncounterLookup::addAreas(QHash<u16, QSet<u64>> &index, const QVector<Area> &areas, Encounter type)
+{
+    for (const auto &area : areas)
+    {
+        for (u16 specie : area.getUniqueSpecies())
+        {
+            QPair<u8, u8> range = area.getLevelRange(specie);
+            index[specie].insert(packEncounter(area.getLocation(), type, range.first, range.second));
+        }
+    }
 }
 
 QString EncounterLookup::getEncounterString(Encounter type)
@@ -188,7 +219,7 @@ void EncounterLookup::on_pushButtonFind_clicked()
 
     Game game = static_cast<Game>(ui->comboBoxGame->currentData().toInt());
     u16 specie = ui->comboBoxPokemon->currentIndex() + 1;
-    QSet<QPair<u8, QString>> encounters;
+    QSet<u64> encounters;
     QVector<u8> locations;
     QStringList locationNames;
 
@@ -197,7 +228,7 @@ void EncounterLookup::on_pushButtonFind_clicked()
         encounters = getEncounters3(game, specie);
         for (const auto &encounter : encounters)
         {
-            locations.append(encounter.first);
+            locations.append(getLocation(encounter));
         }
         locationNames = Translator::getLocationsGen3(locations, game);
     }
@@ -206,7 +237,7 @@ void EncounterLookup::on_pushButtonFind_clicked()
         encounters = getEncounters4(game, specie);
         for (const auto &encounter : encounters)
         {
-            locations.append(encounter.first);
+            locations.append(getLocation(encounter));
         }
         locationNames = Translator::getLocationsGen4(locations, game);
     }
@@ -215,8 +246,8 @@ void EncounterLookup::on_pushButtonFind_clicked()
     for (const auto &encounter : encounters)
     {
         QList<QStandardItem *> row;
-        QStringList split = encounter.second.split('/');
-        row << new QStandardItem(locationNames[i++]) << new QStandardItem(split.at(0)) << new QStandardItem(split.at(1));
+        QString levels = QString("%1-%2").arg((encounter >> 8) & 0xff).arg(encounter & 0xff);
+        row << new QStandardItem(locationNames[i++]) << new QStandardItem(getEncounterString(getType(encounter))) << new QStandardItem(levels);
         model->appendRow(row);
     }
 }
@@ -44,8 +44,12 @@ private:
     QStandardItemModel *model{};
 
     void setupModels();
-    QSet<QPair<u8, QString>> getEncounters3(Game game, u16 specie);
-    QSet<QPair<u8, QString>> getEncounters4(Game game, u16 specie);
+    QSet<u64> getEncounters3(Game game, u16 specie);
+    QSet<u64> getEncounters4(Game game, u16 specie);
+    QHash<u16, QSet<u64>> getIndex3(Game game);
+    QHash<u16, QSet<u64>> getIndex4(Game game);
+    template <typename Area>
+    void addAreas(QHash<u16, QSet<u64>> &index, const QVector<Area> &areas, Encounter type);
     QString getEncounterString(Encounter type);
 
 private slots:
@@ -20,8 +20,7 @@
 #include <QSettings>
 #include "IVtoPID.hpp"
 #include "ui_IVtoPID.h"
-#include <Core/RNG/LCRNG.hpp>
-#include <Core/RNG/RNGEuclidean.hpp>
+#include <Core/Util/IVtoPIDSearcher.hpp>
 #include <Core/Util/Nature.hpp>
 
 IVtoPID::IVtoPID(QWidget *parent) :
@@ -45,8 +44,7 @@ IVtoPID::~IVtoPID()
 
 void IVtoPID::setupModels()
 {
-    model = new QStandardItemModel(ui->tableView);
-    model->setHorizontalHeaderLabels(QStringList() << tr("Seed") << tr("PID") << tr("Method") << tr("Ability") << "50%" << "12.5%" << "25%" << "75%" << tr("SID"));
+    model = new IVtoPIDModel(ui->tableView);
     ui->tableView->setModel(model);
 
     ui->textBoxTID->setValues(InputType::TIDSID);
@@ -56,272 +54,14 @@ void IVtoPID::setupModels()
     if (setting.contains("ivToPID/geometry")) this->restoreGeometry(setting.value("ivToPID/geometry").toByteArray());
 }
 
-QVector<QList<QStandardItem *>> IVtoPID::getSeeds(u16 ivs1, u16 ivs2, u8 nature, u16 tid)
+void IVtoPID::updateProgress(const QVector<IVtoPIDFrame> &frames, const ProgressReport & /*progress*/)
 {
-    QVector<QList<QStandardItem *>> results;
-
-    u32 x_test = ivs2 << 16;
-    u32 x_testXD = ivs1 << 16;
-    u32 pid = 0;
-    u16 sid = 0;
-    bool pass = false;
-
-    for (u32 cnt = 0; cnt <= 0xFFFF; cnt++)
-    {
-        u32 seedXD = x_testXD | cnt;
-        XDRNG rngXD(seedXD);
-        XDRNGR rngXDR(seedXD);
-        u16 rng1XD = rngXD.nextUShort();
-
-        // Gales/Colo
-        if ((rng1XD & 0x7FFF) == (ivs2 & 0x7FFF))
-        {
-            rngXD.nextUShort();
-            u16 rng3XD = rngXD.nextUShort();
-            u16 rng4XD = rngXD.nextUShort();
-            u32 XDColoSeed = rngXDR.nextUInt();
-            sid = (rng4XD ^ rng3XD ^ tid) & 0xFFF8;
-
-            pid = (rng3XD << 16) | rng4XD;
-            if (pid % 25 == nature)
-            {
-                QList<QStandardItem *> result;
-                result << new QStandardItem(QString::number(XDColoSeed, 16).toUpper()) << new QStandardItem(QString::number(pid, 16).toUpper()) << new QStandardItem(tr("XD/Colo"))
-                       << new QStandardItem(QString::number(pid & 1)) << new QStandardItem(((pid & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 30) ? "M" : "F")
-                       << new QStandardItem(((pid & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                results.append(result);
-            }
-        }
-
-        u32 seed = x_test | cnt;
-        PokeRNGR rng(seed);
-        u16 rng1 = rng.nextUShort();
-
-        u16 rng2 = rng.nextUShort();
-        u16 rng3 = rng.nextUShort();
-        u16 rng4 = rng.nextUShort();
-
-        u32 method1Seed = rng.getSeed();
-        sid = (rng2 ^ rng3 ^ tid) & 0xFFF8;
-
-        u32 method234Seed = rng.nextUInt();
-
-        if ((rng1 & 0x7FFF) == (ivs1 & 0x7FFF))
-        {
-            // Method 1
-            pid = (rng2 << 16) | rng3;
-            if (pid % 25 == nature)
-            {
-                QList<QStandardItem *> result;
-                result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(pid, 16).toUpper()) << new QStandardItem(tr("Method 1"))
-                       << new QStandardItem(QString::number(pid & 1)) << new QStandardItem(((pid & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 30) ? "M" : "F")
-                       << new QStandardItem(((pid & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                results.append(result);
-            }
-
-            // Method 1 reverse pid
-            pid = (rng3 << 16) | rng2;
-            if (pid % 25 == nature)
-            {
-                QList<QStandardItem *> result;
-                result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(pid, 16).toUpper()) << new QStandardItem(tr("Reverse Method 1"))
-                       << new QStandardItem(QString::number(pid & 1)) << new QStandardItem(((pid & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 30) ? "M" : "F")
-                       << new QStandardItem(((pid & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                results.append(result);
-            }
-
-            // Method 2
-            pid = (rng3 << 16) | rng4;
-            if (pid % 25 == nature)
-            {
-                sid = (rng3 ^ rng4 ^ tid) & 0xFFF8;
-                QList<QStandardItem *> result;
-                result << new QStandardItem(QString::number(method234Seed, 16).toUpper()) << new QStandardItem(QString::number(pid, 16).toUpper()) << new QStandardItem(tr("Method 2"))
-                       << new QStandardItem(QString::number(pid & 1)) << new QStandardItem(((pid & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 30) ? "M" : "F")
-                       << new QStandardItem(((pid & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                results.append(result);
-            }
-
-            // Cute Charm DPPt
-            if (rng3 / 0x5556 != 0)
-            {
-                u8 choppedPID = rng2 / 0xA3E;
-                sid = (choppedPID ^ tid) & 0xFFF8;
-                pass = choppedPID % 25 == nature;
-                if (pass)
-                {
-                    QList<QStandardItem *> result;
-                    result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(choppedPID, 16).toUpper()) << new QStandardItem(tr("Cute Charm (DPPt)"))
-                           << new QStandardItem(QString::number(choppedPID & 1)) << new QStandardItem(((choppedPID & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 30) ? "M" : "F")
-                           << new QStandardItem(((choppedPID & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                    results.append(result);
-                }
-
-                if (pass)
-                {
-                    choppedPID += 0x96;
-                    sid = (choppedPID ^ tid) & 0xFFF8;
-                    QList<QStandardItem *> result;
-                    result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(choppedPID, 16).toUpper()) << new QStandardItem(tr("Cute Charm (DPPt)"))
-                           << new QStandardItem(QString::number(choppedPID & 1)) << new QStandardItem(((choppedPID & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 30) ? "M" : "F")
-                           << new QStandardItem(((choppedPID & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                    results.append(result);
-                }
-
-                if (pass)
-                {
-                    choppedPID += 0x32;
-                    sid = (choppedPID ^ tid) & 0xFFF8;
-                    QList<QStandardItem *> result;
-                    result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(choppedPID, 16).toUpper()) << new QStandardItem(tr("Cute Charm (DPPt)"))
-                           << new QStandardItem(QString::number(choppedPID & 1)) << new QStandardItem(((choppedPID & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 30) ? "M" : "F")
-                           << new QStandardItem(((choppedPID & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                    results.append(result);
-                }
-
-                if (pass)
-                {
-                    choppedPID -= 0x7D;
-                    sid = (choppedPID ^ tid) & 0xFFF8;
-                    QList<QStandardItem *> result;
-                    result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(choppedPID, 16).toUpper()) << new QStandardItem(tr("Cute Charm (DPPt)"))
-                           << new QStandardItem(QString::number(choppedPID & 1)) << new QStandardItem(((choppedPID & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 30) ? "M" : "F")
-                           << new QStandardItem(((choppedPID & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                    results.append(result);
-                }
-
-                if (pass)
-                {
-                    choppedPID -= 0x19;
-                    sid = (choppedPID ^ tid) & 0xFFF8;
-                    QList<QStandardItem *> result;
-                    result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(choppedPID, 16).toUpper()) << new QStandardItem(tr("Cute Charm (DPPt)"))
-                           << new QStandardItem(QString::number(choppedPID & 1)) << new QStandardItem(((choppedPID & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 30) ? "M" : "F")
-                           << new QStandardItem(((choppedPID & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                    results.append(result);
-                }
-
-            }
-
-            // Cute Charm HGSS
-            if (rng3 % 3 != 0)
-            {
-                u8 choppedPID = rng2 % 25;
-                sid = (choppedPID ^ tid) & 0xFFF8;
-                pass = choppedPID == nature;
-                if (pass)
-                {
-                    QList<QStandardItem *> result;
-                    result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(choppedPID, 16).toUpper()) << new QStandardItem(tr("Cute Charm (HGSS)"))
-                           << new QStandardItem(QString::number(choppedPID & 1)) << new QStandardItem(((choppedPID & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 30) ? "M" : "F")
-                           << new QStandardItem(((choppedPID & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                    results.append(result);
-                }
-
-                if (pass)
-                {
-                    choppedPID += 0x96;
-                    sid = (choppedPID ^ tid) & 0xFFF8;
-                    QList<QStandardItem *> result;
-                    result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(choppedPID, 16).toUpper()) << new QStandardItem(tr("Cute Charm (HGSS)"))
-                           << new QStandardItem(QString::number(choppedPID & 1)) << new QStandardItem(((choppedPID & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 30) ? "M" : "F")
-                           << new QStandardItem(((choppedPID & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                    results.append(result);
-                }
-
-                if (pass)
-                {
-                    choppedPID += 0x32;
-                    sid = (choppedPID ^ tid) & 0xFFF8;
-                    QList<QStandardItem *> result;
-                    result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(choppedPID, 16).toUpper()) << new QStandardItem(tr("Cute Charm (HGSS)"))
-                           << new QStandardItem(QString::number(choppedPID & 1)) << new QStandardItem(((choppedPID & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 30) ? "M" : "F")
-                           << new QStandardItem(((choppedPID & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                    results.append(result);
-                }
-
-                if (pass)
-                {
-                    choppedPID -= 0x7D;
-                    sid = (choppedPID ^ tid) & 0xFFF8;
-                    QList<QStandardItem *> result;
-                    result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(choppedPID, 16).toUpper()) << new QStandardItem(tr("Cute Charm (HGSS)"))
-                           << new QStandardItem(QString::number(choppedPID & 1)) << new QStandardItem(((choppedPID & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 30) ? "M" : "F")
-                           << new QStandardItem(((choppedPID & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                    results.append(result);
-                }
-
-                if (pass)
-                {
-                    choppedPID -= 0x19;
-                    sid = (choppedPID ^ tid) & 0xFFF8;
-                    QList<QStandardItem *> result;
-                    result << new QStandardItem(QString::number(method1Seed, 16).toUpper()) << new QStandardItem(QString::number(choppedPID, 16).toUpper()) << new QStandardItem(tr("Cute Charm (HGSS)"))
-                           << new QStandardItem(QString::number(choppedPID & 1)) << new QStandardItem(((choppedPID & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 30) ? "M" : "F")
-                           << new QStandardItem(((choppedPID & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((choppedPID & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                    results.append(result);
-                }
-            }
-        }
-
-        // Method 4
-        if ((rng2 & 0x7FFF) == (ivs1 & 0x7FFF))
-        {
-            pid = (rng3 << 16) | rng4;
-            sid = (rng3 ^ rng4 ^ tid) & 0xFFF8;
-            if (pid % 25 == nature)
-            {
-                QList<QStandardItem *> result;
-                result << new QStandardItem(QString::number(method234Seed, 16).toUpper()) << new QStandardItem(QString::number(pid, 16).toUpper()) << new QStandardItem(tr("Method 4"))
-                       << new QStandardItem(QString::number(pid & 1)) << new QStandardItem(((pid & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 30) ? "M" : "F")
-                       << new QStandardItem(((pid & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-                results.append(result);
-            }
-        }
-    }
-
-    return results;
-}
-
-QVector<QList<QStandardItem *>> IVtoPID::getSeedsChannel(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 nature)
-{
-    QVector<QList<QStandardItem *>> results;
-
-    RNGEuclidean euclidean(Channel);
-    QVector<u32> seeds = euclidean.recoverLower27BitsChannel(hp, atk, def, spa, spd, spe);
-
-    for (const auto &seed : seeds)
-    {
-        XDRNGR rng(seed, 3);
-
-        u16 pid2 = rng.nextUShort();
-        u16 pid1 = rng.nextUShort();
-        u16 sid = rng.nextUShort();
-
-        // Determine if PID needs to be XORed
-        if ((pid2 > 7 ? 0 : 1) != (pid1 ^ sid ^ 40122))
-        {
-            pid1 ^= 0x8000;
-        }
-
-        u32 pid = (pid1 << 16) | pid2;
-
-        if (pid % 25 == nature)
-        {
-            QList<QStandardItem *> result;
-            result << new QStandardItem(QString::number(rng.nextUInt(), 16).toUpper()) << new QStandardItem(QString::number(pid, 16).toUpper()) << new QStandardItem(tr("Channel"))
-                   << new QStandardItem(QString::number(pid & 1)) << new QStandardItem(((pid & 0xFF) > 126) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 30) ? "M" : "F")
-                   << new QStandardItem(((pid & 0xFF) > 63) ? "M" : "F") << new QStandardItem(((pid & 0xFF) > 190) ? "M" : "F") << new QStandardItem(QString::number(sid));
-            results.append(result);
-        }
-    }
-
-    return results;
+    model->addItems(frames);
 }
 
 void IVtoPID::on_pushButtonFind_clicked()
 {
-    model->removeRows(0, model->rowCount());
+    model->clearModel();
 
     u8 hp = ui->spinBoxHP->value();
     u8 atk = ui->spinBoxAtk->value();
@@ -334,15 +74,12 @@ void IVtoPID::on_pushButtonFind_clicked()
 
     u16 tid = ui->textBoxTID->text().toUShort();
 
-    u32 ivs2 = spe | (spa << 5) | (spd << 10);
-    u32 ivs1 = hp | (atk << 5) | (def << 10);
+    ui->pushButtonFind->setEnabled(false);
+
+    auto *search = new IVtoPIDSearcher(QVector<QVector<u8>>() << QVector<u8>({ hp, atk, def, spa, spd, spe }), nature, tid);
 
-    auto seeds = getSeeds(ivs1, ivs2, nature, tid);
-    seeds.append(getSeeds(ivs1 ^ 0x8000, ivs2 ^ 0x8000, nature, tid));
-    seeds.append(getSeedsChannel(hp, atk, def, spa, spd, spe, nature));
+    connect(search, &IVtoPIDSearcher::finished, this, [ = ] { ui->pushButtonFind->setEnabled(true); });
+    connect(search, &IVtoPIDSearcher::updateProgress, this, &IVtoPID::updateProgress);
 
-    for (const auto &seed : seeds)
-    {
-        model->appendRow(seed);
-    }
+    search->startSearch();
 }
@@ -20,9 +20,9 @@
 #ifndef IVTOPIDHPP
 #define IVTOPIDHPP
 
-#include <QStandardItemModel>
 #include <QWidget>
-#include <Core/Util/Global.hpp>
+#include <Core/Util/SearchProgress.hpp>
+#include <Models/Util/IVtoPIDModel.hpp>
 
 namespace Ui
 {
@@ -39,13 +39,12 @@ public:
 
 private:
     Ui::IVtoPID *ui;
-    QStandardItemModel *model{};
+    IVtoPIDModel *model{};
 
     void setupModels();
-    QVector<QList<QStandardItem *>> getSeeds(u16 ivs1, u16 ivs2, u8 nature, u16 tid);
-    QVector<QList<QStandardItem *>> getSeedsChannel(u8 hp, u8 atk, u8 def, u8 spa, u8 spd, u8 spe, u8 nature);
 
 private slots:
+    void updateProgress(const QVector<IVtoPIDFrame> &frames, const ProgressReport &progress);
     void on_pushButtonFind_clicked();
 
 };
@@ -30,6 +30,7 @@ Egg3Model::Egg3Model(QObject *parent, Method method) :
 void Egg3Model::setMethod(Method method)
 {
     this->method = method;
+    clearCache();
     emit headerDataChanged(Qt::Horizontal, 0, columnCount());
 }
 
@@ -51,203 +52,208 @@ int Egg3Model::columnCount(const QModelIndex & /*parent*/) const
     }
 }
 
-QVariant Egg3Model::data(const QModelIndex &index, int role) const
+QVariant Egg3Model::getDisplayData(const Frame3 &frame, int column) const
 {
-    if (role == Qt::DisplayRole)
+    switch (method)
     {
-        auto frame = model.at(index.row());
-        switch (method)
-        {
-            case Method::EBred:
-            case Method::EBredAlternate:
-            case Method::EBredSplit:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.getTime();
-                    case 2:
-                        if (showInheritance)
+        case Method::EBred:
+        case Method::EBredAlternate:
+        case Method::EBredSplit:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.getTime();
+                case 2:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(0);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(0);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(0);
-                    case 3:
-                        if (showInheritance)
+                    }
+                    return frame.getIV(0);
+                case 3:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(1);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(1);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(1);
-                    case 4:
-                        if (showInheritance)
+                    }
+                    return frame.getIV(1);
+                case 4:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(2);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(2);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(2);
-                    case 5:
-                        if (showInheritance)
+                    }
+                    return frame.getIV(2);
+                case 5:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(3);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(3);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(3);
-                    case 6:
-                        if (showInheritance)
+                    }
+                    return frame.getIV(3);
+                case 6:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(4);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(4);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(4);
-                    case 7:
-                        if (showInheritance)
+                    }
+                    return frame.getIV(4);
+                case 7:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(5);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(5);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(5);
-                    case 8:
-                        return frame.getPowerString();
-                    case 9:
-                        return frame.getPower();
-                    default:
-                        return QVariant();
-                }
-            case Method::EBredPID:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.getTime();
-                    case 2:
-                        return frame.getEggFrame();
-                    case 3:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 4:
-                        return frame.getShinyString();
-                    case 5:
-                        return frame.getNatureString();
-                    case 6:
-                        return frame.getAbility();
-                    case 7:
-                        return frame.getGenderString();
-                }
-            case Method::RSBred:
-            case Method::FRLGBred:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.getTime();
-                    case 2:
-                        return frame.getEggFrame();
-                    case 3:
-                        return frame.getTimeEgg();
-                    case 4:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 5:
-                        return frame.getShinyString();
-                    case 6:
-                        return frame.getNatureString();
-                    case 7:
-                        return frame.getAbility();
-                    case 8:
-                        if (showInheritance)
+                    }
+                    return frame.getIV(5);
+                case 8:
+                    return frame.getPowerString();
+                case 9:
+                    return frame.getPower();
+                default:
+                    return QVariant();
+            }
+        case Method::EBredPID:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.getTime();
+                case 2:
+                    return frame.getEggFrame();
+                case 3:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 4:
+                    return frame.getShinyString();
+                case 5:
+                    return frame.getNatureString();
+                case 6:
+                    return frame.getAbility();
+                case 7:
+                    return frame.getGenderString();
+            }
+        case Method::RSBred:
+        case Method::FRLGBred:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.getTime();
+                case 2:
+                    return frame.getEggFrame();
+                case 3:
+                    return frame.getTimeEgg();
+                case 4:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 5:
+                    return frame.getShinyString();
+                case 6:
+                    return frame.getNatureString();
+                case 7:
+                    return frame.getAbility();
+                case 8:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(0);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(0);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(0);
-                    case 9:
-                        if (showInheritance)
+                    }
+                    return frame.getIV(0);
+                case 9:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(1);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(1);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(1);
-                    case 10:
-                        if (showInheritance)
+                    }
+                    return frame.getIV(1);
+                case 10:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(2);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(2);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(2);
-                    case 11:
-                        if (showInheritance)
+                    }
+                    return frame.getIV(2);
+                case 11:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(3);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(3);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(3);
-                    case 12:
-                        if (showInheritance)
+                    }
+                    return frame.getIV(3);
+                case 12:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(4);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(4);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(4);
-                    case 13:
-                        if (showInheritance)
+                    }
+                    return frame.getIV(4);
+                case 13:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(5);
+                        if (!inh.isNull())
                         {
-                            QChar inh = frame.getInheritance(5);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
+                            return inh;
                         }
-                        return frame.getIV(5);
-                    case 14:
-                        return frame.getPowerString();
-                    case 15:
-                        return frame.getPower();
-                    case 16:
-                        return frame.getGenderString();
-                }
-            default:
-                break;
-        }
+                    }
+                    return frame.getIV(5);
+                case 14:
+                    return frame.getPowerString();
+                case 15:
+                    return frame.getPower();
+                case 16:
+                    return frame.getGenderString();
+            }
+        default:
+            break;
+    }
+    return QVariant();
+}
+
+QVariant Egg3Model::data(const QModelIndex &index, int role) const
+{
+    if (role == Qt::DisplayRole)
+    {
+        return getCachedData(index);
     }
     else if (role == Qt::FontRole)
     {
-        auto frame = model.at(index.row());
+        auto frame = itemAt(index.row());
         switch (method)
         {
             case Method::EBred:
@@ -367,5 +373,6 @@ void Egg3Model::toggleInheritance(bool flag)
 {
     beginResetModel();
     showInheritance = flag;
+    clearCache();
     endResetModel();
 }
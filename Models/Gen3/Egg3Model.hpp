@@ -58,6 +58,9 @@ private:
         tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
     };
 
+
+    QVariant getDisplayData(const Frame3 &frame, int column) const override;
+
 };
 
 #endif // EGG3MODEL_HPP
@@ -0,0 +1,57 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IDs3Model.hpp"
+
+IDs3Model::IDs3Model(QObject *parent) :
+    TableModel<IDFrame3>(parent)
+{
+}
+
+int IDs3Model::columnCount(const QModelIndex & /*parent*/) const
+{
+    return 3;
+}
+
+QVariant IDs3Model::data(const QModelIndex &index, int role) const
+{
+    if (role == Qt::DisplayRole)
+    {
+        auto frame = itemAt(index.row());
+        switch (index.column())
+        {
+            case 0:
+                return frame.getFrame();
+            case 1:
+                return frame.getTID();
+            case 2:
+                return frame.getSID();
+        }
+    }
+    return QVariant();
+}
+
+QVariant IDs3Model::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
+    {
+        return header.at(section);
+    }
+    return QVariant();
+}
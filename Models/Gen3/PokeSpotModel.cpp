@@ -29,28 +29,33 @@ int PokeSpotModel::columnCount(const QModelIndex & /*parent*/) const
     return 7;
 }
 
+QVariant PokeSpotModel::getDisplayData(const Frame3 &frame, int column) const
+{
+    switch (column)
+    {
+        case 0:
+            return frame.getFrame();
+        case 1:
+            return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+        case 2:
+            return frame.getShinyString();
+        case 3:
+            return frame.getLockReasonString();
+        case 4:
+            return frame.getNatureString();
+        case 5:
+            return frame.getAbility();
+        case 6:
+            return frame.getGenderString();
+    }
+    return QVariant();
+}
+
 QVariant PokeSpotModel::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto frame = model.at(index.row());
-        switch (index.column())
-        {
-            case 0:
-                return frame.getFrame();
-            case 1:
-                return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-            case 2:
-                return frame.getShinyString();
-            case 3:
-                return frame.getLockReason();
-            case 4:
-                return frame.getNatureString();
-            case 5:
-                return frame.getAbility();
-            case 6:
-                return frame.getGenderString();
-        }
+        return getCachedData(index);
     }
     return QVariant();
 }
@@ -39,6 +39,9 @@ private:
         tr("Frame"), tr("PID"), "!!!", tr("Type"), tr("Nature"), tr("Ability"), tr("Gender")
     };
 
+
+    QVariant getDisplayData(const Frame3 &frame, int column) const override;
+
 };
 
 #endif // POKESPOTMODEL_HPP
@@ -24,483 +24,129 @@ Searcher3Model::Searcher3Model(QObject *parent, Method method) :
     TableModel<Frame3>(parent)
 {
     this->method = method;
+    columns = Searcher3Columns(method);
+    header = columns.getHeader();
 }
 
 void Searcher3Model::setMethod(Method method)
 {
     this->method = method;
+    columns = Searcher3Columns(method);
+    header = columns.getHeader();
+    clearCache();
     emit headerDataChanged(Qt::Horizontal, 0, columnCount());
 }
 
-void Searcher3Model::sort(int column, Qt::SortOrder order)
+int Searcher3Model::columnCount(const QModelIndex & /*parent*/) const
 {
-    if (!model.empty())
-    {
-        emit layoutAboutToBeChanged();
-        bool flag = order == Qt::AscendingOrder;
-        switch (method)
-        {
-            case Method::MethodH1:
-            case Method::MethodH2:
-            case Method::MethodH4:
-                switch (column)
-                {
-                    case 0:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getSeed() < frame2.getSeed() : frame1.getSeed() > frame2.getSeed();
-                        });
-                        break;
-                    case 1:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getLeadType() < frame2.getLeadType(): frame1.getLeadType() > frame2.getLeadType();
-                        });
-                        break;
-                    case 2:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getEncounterSlot() < frame2.getEncounterSlot(): frame1.getEncounterSlot() > frame2.getEncounterSlot();
-                        });
-                        break;
-                    case 3:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getLevel() < frame2.getLevel(): frame1.getLevel() > frame2.getLevel();
-                        });
-                        break;
-                    case 4:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getPID() < frame2.getPID(): frame1.getPID() > frame2.getPID();
-                        });
-                        break;
-                    case 5:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getShiny() < frame2.getShiny(): frame1.getShiny() > frame2.getShiny();
-                        });
-                        break;
-                    case 6:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getNature() < frame2.getNature() : frame1.getNature() > frame2.getNature();
-                        });
-                        break;
-                    case 7:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getAbility() < frame2.getAbility(): frame1.getAbility() > frame2.getAbility();
-                        });
-                        break;
-                    case 8:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(0) < frame2.getIV(0): frame1.getIV(0) > frame2.getIV(0);
-                        });
-                        break;
-                    case 9:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(1) < frame2.getIV(1): frame1.getIV(1) > frame2.getIV(1);
-                        });
-                        break;
-                    case 10:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(2) < frame2.getIV(2): frame1.getIV(2) > frame2.getIV(2);
-                        });
-                        break;
-                    case 11:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(3) < frame2.getIV(3): frame1.getIV(3) > frame2.getIV(3);
-                        });
-                        break;
-                    case 12:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(4) < frame2.getIV(4): frame1.getIV(4) > frame2.getIV(4);
-                        });
-                        break;
-                    case 13:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(5) < frame2.getIV(5): frame1.getIV(5) > frame2.getIV(5);
-                        });
-                        break;
-                    case 14:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getHidden() < frame2.getHidden() : frame1.getHidden() > frame2.getHidden();
-                        });
-                        break;
-                    case 15:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getPower() < frame2.getPower() : frame1.getPower() > frame2.getPower();
-                        });
-                        break;
-                    case 16:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getGender() < frame2.getGender() : frame1.getGender() > frame2.getGender();
-                        });
-                        break;
-                }
-                break;
-            case Method::XD:
-            case Method::Colo:
-                switch (column)
-                {
-                    case 0:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getSeed() < frame2.getSeed() : frame1.getSeed() > frame2.getSeed();
-                        });
-                        break;
-                    case 1:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getPID() < frame2.getPID() : frame1.getPID() > frame2.getPID();
-                        });
-                        break;
-                    case 2:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getShiny() < frame2.getShiny() : frame1.getShiny() > frame2.getShiny();
-                        });
-                        break;
-                    case 3:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getNature() < frame2.getNature() : frame1.getNature() > frame2.getNature();
-                        });
-                        break;
-                    case 4:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getAbility() < frame2.getAbility() : frame1.getAbility() > frame2.getAbility();
-                        });
-                        break;
-                    case 5:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(0) < frame2.getIV(0): frame1.getIV(0) > frame2.getIV(0);
-                        });
-                        break;
-                    case 6:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(1) < frame2.getIV(1): frame1.getIV(1) > frame2.getIV(1);
-                        });
-                        break;
-                    case 7:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(2) < frame2.getIV(2): frame1.getIV(2) > frame2.getIV(2);
-                        });
-                        break;
-                    case 8:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(3) < frame2.getIV(3): frame1.getIV(3) > frame2.getIV(3);
-                        });
-                        break;
-                    case 9:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(4) < frame2.getIV(4): frame1.getIV(4) > frame2.getIV(4);
-                        });
-                        break;
-                    case 10:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(5) < frame2.getIV(5): frame1.getIV(5) > frame2.getIV(5);
-                        });
-                        break;
-                    case 11:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getHidden() < frame2.getHidden() : frame1.getHidden() > frame2.getHidden();
-                        });
-                        break;
-                    case 12:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getPower() < frame2.getPower() : frame1.getPower() > frame2.getPower();
-                        });
-                        break;
-                    case 13:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getGender() < frame2.getGender() : frame1.getGender() > frame2.getGender();
-                        });
-                        break;
-                    case 14:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getLockReason() < frame2.getLockReason() : frame1.getLockReason() > frame2.getLockReason();
-                        });
-                        break;
-                }
-                break;
-            case Method::Method1:
-            case Method::Method1Reverse:
-            case Method::Method2:
-            case Method::Method4:
-            case Method::XDColo:
-            case Method::Channel:
-                switch (column)
-                {
-                    case 0:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getSeed() < frame2.getSeed() : frame1.getSeed() > frame2.getSeed();
-                        });
-                        break;
-                    case 1:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getPID() < frame2.getPID() : frame1.getPID() > frame2.getPID();
-                        });
-                        break;
-                    case 2:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getShiny() < frame2.getShiny() : frame1.getShiny() > frame2.getShiny();
-                        });
-                        break;
-                    case 3:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getNature() < frame2.getNature() : frame1.getNature() > frame2.getNature();
-                        });
-                        break;
-                    case 4:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getAbility() < frame2.getAbility() : frame1.getAbility() > frame2.getAbility();
-                        });
-                        break;
-                    case 5:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(0) < frame2.getIV(0): frame1.getIV(0) > frame2.getIV(0);
-                        });
-                        break;
-                    case 6:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(1) < frame2.getIV(1): frame1.getIV(1) > frame2.getIV(1);
-                        });
-                        break;
-                    case 7:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(2) < frame2.getIV(2): frame1.getIV(2) > frame2.getIV(2);
-                        });
-                        break;
-                    case 8:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(3) < frame2.getIV(3): frame1.getIV(3) > frame2.getIV(3);
-                        });
-                        break;
-                    case 9:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(4) < frame2.getIV(4): frame1.getIV(4) > frame2.getIV(4);
-                        });
-                        break;
-                    case 10:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getIV(5) < frame2.getIV(5): frame1.getIV(5) > frame2.getIV(5);
-                        });
-                        break;
-                    case 11:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getHidden() < frame2.getHidden() : frame1.getHidden() > frame2.getHidden();
-                        });
-                        break;
-                    case 12:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getPower() < frame2.getPower() : frame1.getPower() > frame2.getPower();
-                        });
-                        break;
-                    case 13:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame3 & frame1, const Frame3 & frame2)
-                        {
-                            return flag ? frame1.getGender() < frame2.getGender() : frame1.getGender() > frame2.getGender();
-                        });
-                        break;
-                }
-                break;
-            default:
-                break;
-        }
+    return columns.getColumnCount();
+}
 
-        emit layoutChanged();
-    }
+QVariant Searcher3Model::getDisplayData(const Frame3 &frame, int column) const
+{
+    return columns.getData(frame, column);
 }
 
-int Searcher3Model::columnCount(const QModelIndex & /*parent*/) const
+std::function<QVariant(const Frame3 &, int)> Searcher3Model::getFormatter() const
+{
+    return [columns = columns](const Frame3 &frame, int column)
+    {
+        return columns.getData(frame, column);
+    };
+}
+
+u32 Searcher3Model::getSortKey(const Frame3 &frame, int column) const
 {
     switch (method)
     {
         case Method::MethodH1:
         case Method::MethodH2:
         case Method::MethodH4:
-            return 17;
-        case Method::XD:
-        case Method::Colo:
-            return 15;
+            switch (column)
+            {
+                case 0:
+                    return frame.getSeed();
+                case 1:
+                    return frame.getLeadType();
+                case 2:
+                    return frame.getEncounterSlot();
+                case 3:
+                    return frame.getLevel();
+                case 4:
+                    return frame.getPID();
+                case 5:
+                    return frame.getShiny();
+                case 6:
+                    return frame.getNature();
+                case 7:
+                    return frame.getAbility();
+                case 8:
+                case 9:
+                case 10:
+                case 11:
+                case 12:
+                case 13:
+                    return frame.getIV(column - 8);
+                case 14:
+                    return frame.getHidden();
+                case 15:
+                    return frame.getPower();
+                case 16:
+                    return frame.getGender();
+            }
+            break;
         case Method::Method1:
         case Method::Method1Reverse:
         case Method::Method2:
         case Method::Method4:
         case Method::XDColo:
         case Method::Channel:
-            return 14;
+        case Method::XD:
+        case Method::Colo:
+            switch (column)
+            {
+                case 0:
+                    return frame.getSeed();
+                case 1:
+                    return frame.getPID();
+                case 2:
+                    return frame.getShiny();
+                case 3:
+                    return frame.getNature();
+                case 4:
+                    return frame.getAbility();
+                case 5:
+                case 6:
+                case 7:
+                case 8:
+                case 9:
+                case 10:
+                    return frame.getIV(column - 5);
+                case 11:
+                    return frame.getHidden();
+                case 12:
+                    return frame.getPower();
+                case 13:
+                    return frame.getGender();
+                case 14:
+                    return static_cast<u32>(frame.getLockReason());
+            }
+            break;
         default:
-            return 0;
+            break;
     }
+    return 0;
 }
 
 QVariant Searcher3Model::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto frame = model.at(index.row());
-        switch (method)
-        {
-            case Method::MethodH1:
-            case Method::MethodH2:
-            case Method::MethodH4:
-                switch (index.column())
-                {
-                    case 0:
-                        return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
-                    case 1:
-                        {
-                            Lead type = frame.getLeadType();
-                            return type == Lead::None ? tr("None") : type == Lead::Synchronize ? tr("Synch") : tr("Cute Charm");
-                        }
-                    case 2:
-                        return frame.getEncounterSlot();
-                    case 3:
-                        return frame.getLevel();
-                    case 4:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 5:
-                        return frame.getShinyString();
-                    case 6:
-                        return frame.getNatureString();
-                    case 7:
-                        return frame.getAbility();
-                    case 8:
-                        return frame.getIV(0);
-                    case 9:
-                        return frame.getIV(1);
-                    case 10:
-                        return frame.getIV(2);
-                    case 11:
-                        return frame.getIV(3);
-                    case 12:
-                        return frame.getIV(4);
-                    case 13:
-                        return frame.getIV(5);
-                    case 14:
-                        return frame.getPowerString();
-                    case 15:
-                        return frame.getPower();
-                    case 16:
-                        return frame.getGenderString();
-                    default:
-                        return QVariant();
-                }
-            case Method::Method1:
-            case Method::Method1Reverse:
-            case Method::Method2:
-            case Method::Method4:
-            case Method::XDColo:
-            case Method::Channel:
-                switch (index.column())
-                {
-                    case 0:
-                        return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
-                    case 1:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 2:
-                        return frame.getShinyString();
-                    case 3:
-                        return frame.getNatureString();
-                    case 4:
-                        return frame.getAbility();
-                    case 5:
-                        return frame.getIV(0);
-                    case 6:
-                        return frame.getIV(1);
-                    case 7:
-                        return frame.getIV(2);
-                    case 8:
-                        return frame.getIV(3);
-                    case 9:
-                        return frame.getIV(4);
-                    case 10:
-                        return frame.getIV(5);
-                    case 11:
-                        return frame.getPowerString();
-                    case 12:
-                        return frame.getPower();
-                    case 13:
-                        return frame.getGenderString();
-                }
-            case Method::XD:
-            case Method::Colo:
-                switch (index.column())
-                {
-                    case 0:
-                        return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
-                    case 1:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 2:
-                        return frame.getShinyString();
-                    case 3:
-                        return frame.getNatureString();
-                    case 4:
-                        return frame.getAbility();
-                    case 5:
-                        return frame.getIV(0);
-                    case 6:
-                        return frame.getIV(1);
-                    case 7:
-                        return frame.getIV(2);
-                    case 8:
-                        return frame.getIV(3);
-                    case 9:
-                        return frame.getIV(4);
-                    case 10:
-                        return frame.getIV(5);
-                    case 11:
-                        return frame.getPowerString();
-                    case 12:
-                        return frame.getPower();
-                    case 13:
-                        return frame.getGenderString();
-                    case 14:
-                        return frame.getLockReason();
-                }
-            default:
-                break;
-        }
+        return getCachedData(index);
     }
     else if (role == Qt::FontRole)
     {
-        auto frame = model.at(index.row());
+        auto frame = itemAt(index.row());
         switch (method)
         {
             case Method::MethodH1:
@@ -556,25 +202,7 @@ QVariant Searcher3Model::headerData(int section, Qt::Orientation orientation, in
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
     {
-        switch (method)
-        {
-            case Method::MethodH1:
-            case Method::MethodH2:
-            case Method::MethodH4:
-                return header1.at(section);
-            case Method::Method1:
-            case Method::Method1Reverse:
-            case Method::Method2:
-            case Method::Method4:
-            case Method::XDColo:
-            case Method::Channel:
-                return header2.at(section);
-            case Method::XD:
-            case Method::Colo:
-                return header3.at(section);
-            default:
-                break;
-        }
+        return header.value(section);
     }
     return QVariant();
 }
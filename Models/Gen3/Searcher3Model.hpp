@@ -20,7 +20,7 @@
 #ifndef SEARCHER3MODEL_HPP
 #define SEARCHER3MODEL_HPP
 
-#include <Core/Gen3/Frame3.hpp>
+#include <Core/Gen3/Frame3Columns.hpp>
 #include <Models/TableModel.hpp>
 
 class Searcher3Model : public TableModel<Frame3>
@@ -30,7 +30,6 @@ class Searcher3Model : public TableModel<Frame3>
 public:
     Searcher3Model(QObject *parent, Method method);
     void setMethod(Method method);
-    void sort(int column, Qt::SortOrder order) override;
     int columnCount(const QModelIndex &parent = QModelIndex()) const override;
     QVariant data(const QModelIndex &index, int role) const override;
     QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
@@ -38,21 +37,12 @@ public:
 private:
     Method method;
 
-    QStringList header1 =
-    {
-        tr("Seed"), tr("Lead"), tr("Slot"), tr("Level"), tr("PID"), "!!!", tr("Nature"), tr("Ability"),
-        tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
-    };
-    QStringList header2 =
-    {
-        tr("Seed"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"), tr("Atk"),
-        tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
-    };
-    QStringList header3 =
-    {
-        tr("Seed"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"), tr("Atk"), tr("Def"),
-        tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender"), tr("Reason")
-    };
+    Searcher3Columns columns;
+    QStringList header;
+
+    QVariant getDisplayData(const Frame3 &frame, int column) const override;
+    std::function<QVariant(const Frame3 &, int)> getFormatter() const override;
+    u32 getSortKey(const Frame3 &frame, int column) const override;
 
 };
 
@@ -23,55 +23,36 @@
 Stationary3Model::Stationary3Model(QObject *parent) :
     TableModel<Frame3>(parent)
 {
+    header = columns.getHeader();
 }
 
 int Stationary3Model::columnCount(const QModelIndex & /*parent*/) const
 {
-    return 15;
+    return columns.getColumnCount();
+}
+
+QVariant Stationary3Model::getDisplayData(const Frame3 &frame, int column) const
+{
+    return columns.getData(frame, column);
+}
+
+std::function<QVariant(const Frame3 &, int)> Stationary3Model::getFormatter() const
+{
+    return [columns = columns](const Frame3 &frame, int column)
+    {
+        return columns.getData(frame, column);
+    };
 }
 
 QVariant Stationary3Model::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto frame = model.at(index.row());
-        switch (index.column())
-        {
-            case 0:
-                return frame.getFrame();
-            case 1:
-                return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-            case 2:
-                return frame.getShinyString();
-            case 3:
-                return frame.getNatureString();
-            case 4:
-                return frame.getAbility();
-            case 5:
-                return frame.getIV(0);
-            case 6:
-                return frame.getIV(1);
-            case 7:
-                return frame.getIV(2);
-            case 8:
-                return frame.getIV(3);
-            case 9:
-                return frame.getIV(4);
-            case 10:
-                return frame.getIV(5);
-            case 11:
-                return frame.getPowerString();
-            case 12:
-                return frame.getPower();
-            case 13:
-                return frame.getGenderString();
-            case 14:
-                return frame.getTime();
-        }
+        return getCachedData(index);
     }
     else if (role == Qt::FontRole)
     {
-        auto frame = model.at(index.row());
+        auto frame = itemAt(index.row());
         switch (index.column())
         {
             case 5:
@@ -95,7 +76,7 @@ QVariant Stationary3Model::headerData(int section, Qt::Orientation orientation,
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
     {
-        return header.at(section);
+        return header.value(section);
     }
     return QVariant();
 }
@@ -23,59 +23,36 @@
 Wild3Model::Wild3Model(QObject *parent) :
     TableModel<Frame3>(parent)
 {
+    header = columns.getHeader();
 }
 
 int Wild3Model::columnCount(const QModelIndex & /*parent*/) const
 {
-    return 17;
+    return columns.getColumnCount();
+}
+
+QVariant Wild3Model::getDisplayData(const Frame3 &frame, int column) const
+{
+    return columns.getData(frame, column);
+}
+
+std::function<QVariant(const Frame3 &, int)> Wild3Model::getFormatter() const
+{
+    return [columns = columns](const Frame3 &frame, int column)
+    {
+        return columns.getData(frame, column);
+    };
 }
 
 QVariant Wild3Model::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto frame = model.at(index.row());
-        switch (index.column())
-        {
-            case 0:
-                return frame.getFrame();
-            case 1:
-                return frame.getEncounterSlot();
-            case 2:
-                return frame.getLevel();
-            case 3:
-                return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-            case 4:
-                return frame.getShinyString();
-            case 5:
-                return frame.getNatureString();
-            case 6:
-                return frame.getAbility();
-            case 7:
-                return frame.getIV(0);
-            case 8:
-                return frame.getIV(1);
-            case 9:
-                return frame.getIV(2);
-            case 10:
-                return frame.getIV(3);
-            case 11:
-                return frame.getIV(4);
-            case 12:
-                return frame.getIV(5);
-            case 13:
-                return frame.getPowerString();
-            case 14:
-                return frame.getPower();
-            case 15:
-                return frame.getGenderString();
-            case 16:
-                return frame.getTime();
-        }
+        return getCachedData(index);
     }
     else if (role == Qt::FontRole)
     {
-        auto frame = model.at(index.row());
+        auto frame = itemAt(index.row());
         switch (index.column())
         {
             case 8:
@@ -99,7 +76,7 @@ QVariant Wild3Model::headerData(int section, Qt::Orientation orientation, int ro
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
     {
-        return header.at(section);
+        return header.value(section);
     }
     return QVariant();
 }
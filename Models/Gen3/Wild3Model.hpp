@@ -20,7 +20,7 @@
 #ifndef WILD3MODEL_HPP
 #define WILD3MODEL_HPP
 
-#include <Core/Gen3/Frame3.hpp>
+#include <Core/Gen3/Frame3Columns.hpp>
 #include <Models/TableModel.hpp>
 
 class Wild3Model : public TableModel<Frame3>
@@ -34,11 +34,11 @@ public:
     QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
 
 private:
-    QStringList header =
-    {
-        tr("Frame"), tr("Slot"), tr("Level"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"),
-        tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender"), tr("Time")
-    };
+    Wild3Columns columns;
+    QStringList header;
+
+    QVariant getDisplayData(const Frame3 &frame, int column) const override;
+    std::function<QVariant(const Frame3 &, int)> getFormatter() const override;
 
 };
 
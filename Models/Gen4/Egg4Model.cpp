@@ -30,6 +30,7 @@ Egg4GeneratorModel::Egg4GeneratorModel(QObject *parent, Method method) :
 void Egg4GeneratorModel::setMethod(Method method)
 {
     this->method = method;
+    clearCache();
     emit headerDataChanged(Qt::Horizontal, 0, columnCount());
 }
 
@@ -49,185 +50,190 @@ int Egg4GeneratorModel::columnCount(const QModelIndex & /*parent*/) const
     }
 }
 
+QVariant Egg4GeneratorModel::getDisplayData(const Frame4 &frame, int column) const
+{
+    switch (method)
+    {
+        case Method::Gen4Normal:
+        case Method::Gen4Masuada:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 2:
+                    return frame.getShinyString();
+                case 3:
+                    return frame.getNatureString();
+                case 4:
+                    return frame.getAbility();
+                case 5:
+                    return frame.getGenderString();
+            }
+        case Method::DPPtIVs:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.chatotPitch();
+                case 2:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(0);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(0);
+                case 3:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(1);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(1);
+                case 4:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(2);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(2);
+                case 5:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(3);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(3);
+                case 6:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(4);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(4);
+                case 7:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(5);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(5);
+                case 8:
+                    return frame.getPowerString();
+                case 9:
+                    return frame.getPower();
+                default:
+                    return QVariant();
+            }
+        case Method::HGSSIVs:
+            switch (column)
+            {
+                case 0:
+                    return frame.getFrame();
+                case 1:
+                    return frame.getCall();
+                case 2:
+                    return frame.chatotPitch();
+                case 3:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(0);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(0);
+                case 4:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(1);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(1);
+                case 5:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(2);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(2);
+                case 6:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(3);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(3);
+                case 7:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(4);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(4);
+                case 8:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(5);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(5);
+                case 9:
+                    return frame.getPowerString();
+                case 10:
+                    return frame.getPower();
+            }
+        default:
+            break;
+    }
+    return QVariant();
+}
+
 QVariant Egg4GeneratorModel::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto frame = model.at(index.row());
-        switch (method)
-        {
-            case Method::Gen4Normal:
-            case Method::Gen4Masuada:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 2:
-                        return frame.getShinyString();
-                    case 3:
-                        return frame.getNatureString();
-                    case 4:
-                        return frame.getAbility();
-                    case 5:
-                        return frame.getGenderString();
-                }
-            case Method::DPPtIVs:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.chatotPitch();
-                    case 2:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(0);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(0);
-                    case 3:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(1);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(1);
-                    case 4:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(2);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(2);
-                    case 5:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(3);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(3);
-                    case 6:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(4);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(4);
-                    case 7:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(5);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(5);
-                    case 8:
-                        return frame.getPowerString();
-                    case 9:
-                        return frame.getPower();
-                    default:
-                        return QVariant();
-                }
-            case Method::HGSSIVs:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.getCall();
-                    case 2:
-                        return frame.chatotPitch();
-                    case 3:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(0);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(0);
-                    case 4:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(1);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(1);
-                    case 5:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(2);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(2);
-                    case 6:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(3);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(3);
-                    case 7:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(4);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(4);
-                    case 8:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(5);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(5);
-                    case 9:
-                        return frame.getPowerString();
-                    case 10:
-                        return frame.getPower();
-                }
-            default:
-                break;
-        }
+        return getCachedData(index);
     }
     else if (role == Qt::FontRole)
     {
-        auto frame = model.at(index.row());
+        auto frame = itemAt(index.row());
 
         switch (method)
         {
@@ -343,6 +349,7 @@ void Egg4GeneratorModel::toggleInheritance(bool flag)
 {
     beginResetModel();
     showInheritance = flag;
+    clearCache();
     endResetModel();
 }
 
@@ -357,6 +364,7 @@ Egg4SearcherModel::Egg4SearcherModel(QObject *parent, Method method) :
 void Egg4SearcherModel::setMethod(Method method)
 {
     this->method = method;
+    clearCache();
     emit headerDataChanged(Qt::Horizontal, 0, columnCount());
 }
 
@@ -377,202 +385,207 @@ int Egg4SearcherModel::columnCount(const QModelIndex & /*parent*/) const
     }
 }
 
+QVariant Egg4SearcherModel::getDisplayData(const Frame4 &frame, int column) const
+{
+    switch (method)
+    {
+        case Method::Gen4Normal:
+        case Method::Gen4Masuada:
+            switch (column)
+            {
+                case 0:
+                    return QString::number(frame.getInitialSeed(), 16).toUpper().rightJustified(8, '0');
+                case 1:
+                    return frame.getFrame();
+                case 2:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 3:
+                    return frame.getShinyString();
+                case 4:
+                    return frame.getNatureString();
+                case 5:
+                    return frame.getAbility();
+                case 6:
+                    return frame.getGenderString();
+                default:
+                    break;
+            }
+        case Method::DPPtIVs:
+        case Method::HGSSIVs:
+            switch (column)
+            {
+                case 0:
+                    return QString::number(frame.getInitialSeed(), 16).toUpper().rightJustified(8, '0');
+                case 1:
+                    return frame.getFrame();
+                case 2:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(0);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(0);
+                case 3:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(1);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(1);
+                case 4:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(2);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(2);
+                case 5:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(3);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(3);
+                case 6:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(4);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(4);
+                case 7:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(5);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(5);
+                case 8:
+                    return frame.getPowerString();
+                case 9:
+                    return frame.getPower();
+                default:
+                    break;
+            }
+        case Method::Gen4Combined:
+            switch (column)
+            {
+                case 0:
+                    return QString::number(frame.getInitialSeed(), 16).toUpper().rightJustified(8, '0');
+                case 1:
+                    return frame.getFrame();
+                case 2:
+                    return frame.getEggFrame();
+                case 3:
+                    return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
+                case 4:
+                    return frame.getShinyString();
+                case 5:
+                    return frame.getNatureString();
+                case 6:
+                    return frame.getAbility();
+                case 7:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(0);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(0);
+                case 8:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(1);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(1);
+                case 9:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(2);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(2);
+                case 10:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(3);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(3);
+                case 11:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(4);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(4);
+                case 12:
+                    if (showInheritance)
+                    {
+                        QChar inh = frame.getInheritance(5);
+                        if (!inh.isNull())
+                        {
+                            return inh;
+                        }
+                    }
+                    return frame.getIV(5);
+                case 13:
+                    return frame.getPowerString();
+                case 14:
+                    return frame.getPower();
+                case 15:
+                    return frame.getGenderString();
+                default:
+                    break;
+            }
+        default:
+            break;
+    }
+    return QVariant();
+}
+
 QVariant Egg4SearcherModel::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto frame = model.at(index.row());
-        switch (method)
-        {
-            case Method::Gen4Normal:
-            case Method::Gen4Masuada:
-                switch (index.column())
-                {
-                    case 0:
-                        return QString::number(frame.getInitialSeed(), 16).toUpper().rightJustified(8, '0');
-                    case 1:
-                        return frame.getFrame();
-                    case 2:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 3:
-                        return frame.getShinyString();
-                    case 4:
-                        return frame.getNatureString();
-                    case 5:
-                        return frame.getAbility();
-                    case 6:
-                        return frame.getGenderString();
-                    default:
-                        break;
-                }
-            case Method::DPPtIVs:
-            case Method::HGSSIVs:
-                switch (index.column())
-                {
-                    case 0:
-                        return QString::number(frame.getInitialSeed(), 16).toUpper().rightJustified(8, '0');
-                    case 1:
-                        return frame.getFrame();
-                    case 2:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(0);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(0);
-                    case 3:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(1);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(1);
-                    case 4:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(2);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(2);
-                    case 5:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(3);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(3);
-                    case 6:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(4);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(4);
-                    case 7:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(5);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(5);
-                    case 8:
-                        return frame.getPowerString();
-                    case 9:
-                        return frame.getPower();
-                    default:
-                        break;
-                }
-            case Method::Gen4Combined:
-                switch (index.column())
-                {
-                    case 0:
-                        return QString::number(frame.getInitialSeed(), 16).toUpper().rightJustified(8, '0');
-                    case 1:
-                        return frame.getFrame();
-                    case 2:
-                        return frame.getEggFrame();
-                    case 3:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 4:
-                        return frame.getShinyString();
-                    case 5:
-                        return frame.getNatureString();
-                    case 6:
-                        return frame.getAbility();
-                    case 7:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(0);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(0);
-                    case 8:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(1);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(1);
-                    case 9:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(2);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(2);
-                    case 10:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(3);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(3);
-                    case 11:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(4);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(4);
-                    case 12:
-                        if (showInheritance)
-                        {
-                            QChar inh = frame.getInheritance(5);
-                            if (!inh.isNull())
-                            {
-                                return inh;
-                            }
-                        }
-                        return frame.getIV(5);
-                    case 13:
-                        return frame.getPowerString();
-                    case 14:
-                        return frame.getPower();
-                    case 15:
-                        return frame.getGenderString();
-                    default:
-                        break;
-                }
-            default:
-                break;
-        }
+        return getCachedData(index);
     }
     else if (role == Qt::FontRole)
     {
-        auto frame = model.at(index.row());
+        auto frame = itemAt(index.row());
         switch (method)
         {
             case Method::DPPtIVs:
@@ -688,5 +701,6 @@ void Egg4SearcherModel::toggleInheritance(bool flag)
 {
     beginResetModel();
     showInheritance = flag;
+    clearCache();
     endResetModel();
 }
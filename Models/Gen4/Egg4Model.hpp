@@ -54,6 +54,9 @@ private:
         tr("Frame"), tr("Call"), tr("Chatot"), tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power")
     };
 
+
+    QVariant getDisplayData(const Frame4 &frame, int column) const override;
+
 };
 
 class Egg4SearcherModel : public TableModel<Frame4>
@@ -88,6 +91,9 @@ private:
         tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
     };
 
+
+    QVariant getDisplayData(const Frame4 &frame, int column) const override;
+
 };
 
 #endif // EGG4MODEL_HPP
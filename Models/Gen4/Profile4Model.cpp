@@ -33,7 +33,7 @@ QVariant Profile4Model::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto profile = model.at(index.row());
+        auto profile = itemAt(index.row());
         switch (index.column())
         {
             case 0:
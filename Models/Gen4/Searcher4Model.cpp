@@ -25,497 +25,149 @@ Searcher4Model::Searcher4Model(QObject *parent, Method method, bool stationary)
 {
     this->method = method;
     this->stationary = stationary;
+    columns = Searcher4Columns(method, stationary);
+    header = columns.getHeader();
 }
 
 void Searcher4Model::setMethod(Method method)
 {
     this->method = method;
+    columns = Searcher4Columns(method, stationary);
+    header = columns.getHeader();
+    clearCache();
     emit headerDataChanged(Qt::Horizontal, 0, columnCount());
 }
 
-void Searcher4Model::sort(int column, Qt::SortOrder order)
+int Searcher4Model::columnCount(const QModelIndex & /*parent*/) const
 {
-    if (!model.empty())
-    {
-        emit layoutAboutToBeChanged();
-        bool flag = order == Qt::AscendingOrder;
-        bool stat = stationary;
+    return columns.getColumnCount();
+}
 
-        switch (method)
-        {
-            case Method::Method1:
-            case Method::ChainedShiny:
-                switch (column)
-                {
-                    case 0:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getSeed() < frame2.getSeed() : frame1.getSeed() > frame2.getSeed();
-                        });
-                        break;
-                    case 1:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getFrame() < frame2.getFrame() : frame1.getFrame() > frame1.getFrame();
-                        });
-                        break;
-                    case 2:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getPID() < frame2.getPID() : frame1.getPID() > frame2.getPID();
-                        });
-                        break;
-                    case 3:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getShiny() < frame2.getShiny() : frame1.getShiny() > frame2.getShiny();
-                        });
-                        break;
-                    case 4:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getNature() < frame2.getNature() : frame1.getNature() > frame2.getNature();
-                        });
-                        break;
-                    case 5:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getAbility() < frame2.getAbility() : frame1.getAbility() > frame2.getAbility();
-                        });
-                        break;
-                    case 6:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(0) < frame2.getIV(0) : frame1.getIV(0) > frame2.getIV(0);
-                        });
-                        break;
-                    case 7:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(1) < frame2.getIV(1) : frame1.getIV(1) > frame2.getIV(1);
-                        });
-                        break;
-                    case 8:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(2) < frame2.getIV(2) : frame1.getIV(2) > frame2.getIV(2);
-                        });
-                        break;
-                    case 9:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(3) < frame2.getIV(3) : frame1.getIV(3) > frame2.getIV(3);
-                        });
-                        break;
-                    case 10:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(4) < frame2.getIV(4) : frame1.getIV(4) > frame2.getIV(4);
-                        });
-                        break;
-                    case 11:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(5) < frame2.getIV(5) : frame1.getIV(5) > frame2.getIV(5);
-                        });
-                        break;
-                    case 12:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getHidden() < frame2.getHidden() : frame1.getHidden() > frame2.getHidden();
-                        });
-                        break;
-                    case 13:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getPower() < frame2.getPower() : frame1.getPower() > frame2.getPower();
-                        });
-                        break;
-                    case 14:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getGender() < frame2.getGender() : frame1.getGender() > frame2.getGender();
-                        });
-                        break;
-                }
-                break;
-            case Method::WondercardIVs:
-                switch (column)
-                {
-                    case 0:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getSeed() < frame2.getSeed() : frame1.getSeed() > frame2.getSeed();
-                        });
-                        break;
-                    case 1:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getFrame() < frame2.getFrame() : frame1.getFrame() > frame1.getFrame();
-                        });
-                        break;
-                    case 2:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(0) < frame2.getIV(0) : frame1.getIV(0) > frame2.getIV(0);
-                        });
-                        break;
-                    case 3:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(1) < frame2.getIV(1) : frame1.getIV(1) > frame2.getIV(1);
-                        });
-                        break;
-                    case 4:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(2) < frame2.getIV(2) : frame1.getIV(2) > frame2.getIV(2);
-                        });
-                        break;
-                    case 5:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(3) < frame2.getIV(3) : frame1.getIV(3) > frame2.getIV(3);
-                        });
-                        break;
-                    case 6:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(4) < frame2.getIV(4) : frame1.getIV(4) > frame2.getIV(4);
-                        });
-                        break;
-                    case 7:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getIV(5) < frame2.getIV(5) : frame1.getIV(5) > frame2.getIV(5);
-                        });
-                        break;
-                    case 8:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getHidden() < frame2.getHidden() : frame1.getHidden() > frame2.getHidden();
-                        });
-                        break;
-                    case 9:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getPower() < frame2.getPower() : frame1.getPower() > frame2.getPower();
-                        });
-                        break;
-                }
-                break;
-            case Method::MethodJ:
-            case Method::MethodK:
-                switch (column)
-                {
-                    case 0:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getSeed() < frame2.getSeed() : frame1.getSeed() > frame2.getSeed();
-                        });
-                        break;
-                    case 1:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getFrame() < frame2.getFrame() : frame1.getFrame() > frame2.getFrame();
-                        });
-                        break;
-                    case 2:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getLeadType() < frame2.getLeadType() : frame1.getLeadType() > frame2.getLeadType();
-                        });
-                        break;
-                    case 3:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getPID() < frame2.getPID() : frame1.getPID() > frame2.getPID();
-                        });
-                        break;
-                    case 4:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getShiny() < frame2.getShiny() : frame1.getShiny() > frame2.getShiny() :
-                                   flag ? frame1.getEncounterSlot() < frame2.getEncounterSlot() : frame1.getEncounterSlot() > frame2.getEncounterSlot();
-                        });
-                        break;
-                    case 5:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getNature() < frame2.getNature() : frame1.getNature() > frame2.getNature() :
-                                   flag ? frame1.getLevel() < frame2.getLevel() : frame1.getLevel() > frame2.getLevel();
-                        });
-                        break;
-                    case 6:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getAbility() < frame2.getAbility() : frame1.getAbility() > frame2.getAbility() :
-                                   flag ? frame1.getShiny() < frame2.getShiny() : frame1.getShiny() > frame2.getShiny();
-                        });
-                        break;
-                    case 7:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getIV(0) < frame2.getIV(0) : frame1.getIV(0) > frame2.getIV(0) :
-                                   flag ? frame1.getNature() < frame2.getNature() : frame1.getNature() > frame2.getNature();
-                        });
-                        break;
-                    case 8:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getIV(1) < frame2.getIV(1) : frame1.getIV(1) > frame2.getIV(1) :
-                                   flag ? frame1.getAbility() < frame2.getAbility() : frame1.getAbility() > frame2.getAbility();
-                        });
-                        break;
-                    case 9:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getIV(2) < frame2.getIV(2) : frame1.getIV(2) > frame2.getIV(2) :
-                                   flag ? frame1.getIV(0) < frame2.getIV(0) : frame1.getIV(0) > frame2.getIV(0);
-                        });
-                        break;
-                    case 10:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getIV(3) < frame2.getIV(3) : frame1.getIV(3) > frame2.getIV(3) :
-                                   flag ? frame1.getIV(1) < frame2.getIV(1) : frame1.getIV(1) > frame2.getIV(1);
-                        });
-                        break;
-                    case 11:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getIV(4) < frame2.getIV(4) : frame1.getIV(4) > frame2.getIV(4) :
-                                   flag ? frame1.getIV(2) < frame2.getIV(2) : frame1.getIV(2) > frame2.getIV(2);
-                        });
-                        break;
-                    case 12:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getIV(5) < frame2.getIV(5) : frame1.getIV(5) > frame2.getIV(5) :
-                                   flag ? frame1.getIV(3) < frame2.getIV(3) : frame1.getIV(3) > frame2.getIV(3);
-                        });
-                        break;
-                    case 13:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getHidden() < frame2.getHidden() : frame1.getHidden() > frame2.getHidden() :
-                                   flag ? frame1.getIV(4) < frame2.getIV(4) : frame1.getIV(4) > frame2.getIV(4);
-                        });
-                        break;
-                    case 14:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getPower() < frame2.getPower() : frame1.getPower() > frame2.getPower() :
-                                   flag ? frame1.getIV(5) < frame2.getIV(5) : frame1.getIV(5) > frame2.getIV(5);
-                        });
-                        break;
-                    case 15:
-                        std::sort(model.begin(), model.end(), [flag, stat] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return stat ?
-                                   flag ? frame1.getGender() < frame2.getGender() : frame1.getGender() > frame2.getGender() :
-                                   flag ? frame1.getHidden() < frame2.getHidden() : frame1.getHidden() > frame2.getHidden();
-                        });
-                        break;
-                    case 16:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getPower() < frame2.getPower() : frame1.getPower() > frame2.getPower();
-                        });
-                        break;
-                    case 17:
-                        std::sort(model.begin(), model.end(), [flag] (const Frame4 & frame1, const Frame4 & frame2)
-                        {
-                            return flag ? frame1.getGender() < frame2.getGender() : frame1.getGender() > frame2.getGender();
-                        });
-                        break;
-                }
-                break;
-            default:
-                break;
-        }
+QVariant Searcher4Model::getDisplayData(const Frame4 &frame, int column) const
+{
+    return columns.getData(frame, column);
+}
 
-        emit layoutChanged();
-    }
+std::function<QVariant(const Frame4 &, int)> Searcher4Model::getFormatter() const
+{
+    return [columns = columns](const Frame4 &frame, int column)
+    {
+        return columns.getData(frame, column);
+    };
 }
 
-int Searcher4Model::columnCount(const QModelIndex & /*parent*/) const
+u32 Searcher4Model::getSortKey(const Frame4 &frame, int column) const
 {
     switch (method)
     {
+        case Method::WondercardIVs:
+            switch (column)
+            {
+                case 0:
+                    return frame.getSeed();
+                case 1:
+                    return frame.getFrame();
+                case 2:
+                case 3:
+                case 4:
+                case 5:
+                case 6:
+                case 7:
+                    return frame.getIV(column - 2);
+                case 8:
+                    return frame.getHidden();
+                case 9:
+                    return frame.getPower();
+            }
+            break;
         case Method::Method1:
         case Method::ChainedShiny:
-            return 15;
-        case Method::WondercardIVs:
-            return 10;
+            switch (column)
+            {
+                case 0:
+                    return frame.getSeed();
+                case 1:
+                    return frame.getFrame();
+                case 2:
+                    return frame.getPID();
+                case 3:
+                    return frame.getShiny();
+                case 4:
+                    return frame.getNature();
+                case 5:
+                    return frame.getAbility();
+                case 6:
+                case 7:
+                case 8:
+                case 9:
+                case 10:
+                case 11:
+                    return frame.getIV(column - 6);
+                case 12:
+                    return frame.getHidden();
+                case 13:
+                    return frame.getPower();
+                case 14:
+                    return frame.getGender();
+            }
+            break;
         case Method::MethodJ:
         case Method::MethodK:
-            return stationary ? 16 : 18;
+            // Stationary tables have no slot and level columns
+            if (stationary && column > 3)
+            {
+                column += 2;
+            }
+            switch (column)
+            {
+                case 0:
+                    return frame.getSeed();
+                case 1:
+                    return frame.getFrame();
+                case 2:
+                    return frame.getLeadType();
+                case 3:
+                    return frame.getPID();
+                case 4:
+                    return frame.getEncounterSlot();
+                case 5:
+                    return frame.getLevel();
+                case 6:
+                    return frame.getShiny();
+                case 7:
+                    return frame.getNature();
+                case 8:
+                    return frame.getAbility();
+                case 9:
+                case 10:
+                case 11:
+                case 12:
+                case 13:
+                case 14:
+                    return frame.getIV(column - 9);
+                case 15:
+                    return frame.getHidden();
+                case 16:
+                    return frame.getPower();
+                case 17:
+                    return frame.getGender();
+            }
+            break;
         default:
-            return 0;
+            break;
     }
+    return 0;
 }
 
 QVariant Searcher4Model::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto frame = model.at(index.row());
-        switch (method)
-        {
-            case Method::WondercardIVs:
-                switch (index.column())
-                {
-                    case 0:
-                        return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
-                    case 1:
-                        return frame.getFrame();
-                    case 2:
-                        return frame.getIV(0);
-                    case 3:
-                        return frame.getIV(1);
-                    case 4:
-                        return frame.getIV(2);
-                    case 5:
-                        return frame.getIV(3);
-                    case 6:
-                        return frame.getIV(4);
-                    case 7:
-                        return frame.getIV(5);
-                    case 8:
-                        return frame.getPowerString();
-                    case 9:
-                        return frame.getPower();
-                }
-                break;
-            case Method::Method1:
-            case Method::ChainedShiny:
-                switch (index.column())
-                {
-                    case 0:
-                        return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
-                    case 1:
-                        return frame.getFrame();
-                    case 2:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 3:
-                        return frame.getShinyString();
-                    case 4:
-                        return frame.getNatureString();
-                    case 5:
-                        return frame.getAbility();
-                    case 6:
-                        return frame.getIV(0);
-                    case 7:
-                        return frame.getIV(1);
-                    case 8:
-                        return frame.getIV(2);
-                    case 9:
-                        return frame.getIV(3);
-                    case 10:
-                        return frame.getIV(4);
-                    case 11:
-                        return frame.getIV(5);
-                    case 12:
-                        return frame.getPowerString();
-                    case 13:
-                        return frame.getPower();
-                    case 14:
-                        return frame.getGenderString();
-
-                }
-                break;
-            case Method::MethodJ:
-            case Method::MethodK:
-                switch (index.column())
-                {
-                    case 0:
-                        return QString::number(frame.getSeed(), 16).toUpper().rightJustified(8, '0');
-                    case 1:
-                        return frame.getFrame();
-                    case 2:
-                        switch (frame.getLeadType())
-                        {
-                            case Lead::None:
-                                return tr("None");
-                            case Lead::Synchronize:
-                                return tr("Synchronize");
-                            case Lead::SuctionCups:
-                                return tr("Suction Cups");
-                            case Lead::CuteCharmFemale:
-                                return tr("Cute Charm (♀)");
-                            case Lead::CuteCharm25M:
-                                return tr("Cute Charm (25% ♂)");
-                            case Lead::CuteCharm50M:
-                                return tr("Cute Charm (50% ♂)");
-                            case Lead::CuteCharm75M:
-                                return tr("Cute Charm (75% ♂)");
-                            case Lead::CuteCharm875M:
-                            default:
-                                return tr("Cute Charm (87.5% ♂)");
-                        }
-                    case 3:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 4:
-                        if (stationary) return frame.getShinyString();
-                        return frame.getEncounterSlot();
-                    case 5:
-                        if (stationary) return frame.getNatureString();
-                        return frame.getLevel();
-                    case 6:
-                        if (stationary) return frame.getAbility();
-                        return frame.getShinyString();
-                    case 7:
-                        if (stationary) return frame.getIV(0);
-                        return frame.getNatureString();
-                    case 8:
-                        if (stationary) return frame.getIV(1);
-                        return frame.getAbility();
-                    case 9:
-                        if (stationary) return frame.getIV(2);
-                        return frame.getIV(0);
-                    case 10:
-                        if (stationary) return frame.getIV(3);
-                        return frame.getIV(1);
-                    case 11:
-                        if (stationary) return frame.getIV(4);
-                        return frame.getIV(2);
-                    case 12:
-                        if (stationary) return frame.getIV(5);
-                        return frame.getIV(3);
-                    case 13:
-                        if (stationary) return frame.getPowerString();
-                        return frame.getIV(4);
-                    case 14:
-                        if (stationary) return frame.getPower();
-                        return frame.getIV(5);
-                    case 15:
-                        if (stationary) return frame.getGenderString();
-                        return frame.getPowerString();
-                    case 16:
-                        return frame.getPower();
-                    case 17:
-                        return frame.getGenderString();
-                }
-                break;
-            default:
-                break;
-        }
+        return getCachedData(index);
     }
     else if (role == Qt::FontRole)
     {
-        auto frame = model.at(index.row());
+        auto frame = itemAt(index.row());
         switch (method)
         {
             case Method::WondercardIVs:
@@ -602,21 +254,7 @@ QVariant Searcher4Model::headerData(int section, Qt::Orientation orientation, in
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
     {
-        switch (method)
-        {
-            case Method::Method1:
-            case Method::ChainedShiny:
-                return header1.at(section);
-                break;
-            case Method::WondercardIVs:
-                return header2.at(section);
-                break;
-            case Method::MethodJ:
-            case Method::MethodK:
-                return stationary ? header4.at(section) : header3.at(section);
-            default:
-                break;
-        }
+        return header.value(section);
     }
     return QVariant();
 }
@@ -20,7 +20,7 @@
 #ifndef SEARCHER4MODEL_HPP
 #define SEARCHER4MODEL_HPP
 
-#include <Core/Gen4/Frame4.hpp>
+#include <Core/Gen4/Frame4Columns.hpp>
 #include <Models/TableModel.hpp>
 
 class Searcher4Model : public TableModel<Frame4>
@@ -30,7 +30,6 @@ class Searcher4Model : public TableModel<Frame4>
 public:
     Searcher4Model(QObject *parent, Method method, bool stationary = false);
     void setMethod(Method method);
-    void sort(int column, Qt::SortOrder order) override;
     int columnCount(const QModelIndex &parent = QModelIndex()) const override;
     QVariant data(const QModelIndex &index, int role) const override;
     QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
@@ -38,25 +37,12 @@ public:
 private:
     Method method;
     bool stationary;
-    QStringList header1 =
-    {
-        tr("Seed"), tr("Frame"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"),
-        tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
-    };
-    QStringList header2 =
-    {
-        tr("Seed"), tr("Frame"), tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power")
-    };
-    QStringList header3 =
-    {
-        tr("Seed"), tr("Frame"), tr("Lead"), tr("PID"), tr("Slot"), tr("Level"), "!!!", tr("Nature"), tr("Ability"),
-        tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
-    };
-    QStringList header4 =
-    {
-        tr("Seed"), tr("Frame"), tr("Lead"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"),
-        tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
-    };
+    Searcher4Columns columns;
+    QStringList header;
+
+    QVariant getDisplayData(const Frame4 &frame, int column) const override;
+    std::function<QVariant(const Frame4 &, int)> getFormatter() const override;
+    u32 getSortKey(const Frame4 &frame, int column) const override;
 
 };
 
@@ -47,7 +47,7 @@ QVariant SeedtoTime4Model::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto frame = model.at(index.row());
+        auto frame = itemAt(index.row());
         if (calibrate)
         {
             switch (index.column())
@@ -20,8 +20,8 @@
 #ifndef SEEDTOTIME4MODEL_HPP
 #define SEEDTOTIME4MODEL_HPP
 
+#include <Core/Gen4/DateTime.hpp>
 #include <Models/TableModel.hpp>
-#include <Util/DateTime.hpp>
 
 class SeedtoTime4Model : public TableModel<DateTime>
 {
@@ -24,176 +24,46 @@ Stationary4Model::Stationary4Model(QObject *parent, Method method) :
     TableModel<Frame4>(parent)
 {
     this->method = method;
+    columns = Stationary4Columns(method);
+    header = columns.getHeader();
 }
 
 void Stationary4Model::setMethod(Method method)
 {
     this->method = method;
+    columns = Stationary4Columns(method);
+    header = columns.getHeader();
+    clearCache();
     emit headerDataChanged(Qt::Horizontal, 0, columnCount());
 }
 
 int Stationary4Model::columnCount(const QModelIndex & /*parent*/) const
 {
-    switch (method)
+    return columns.getColumnCount();
+}
+
+QVariant Stationary4Model::getDisplayData(const Frame4 &frame, int column) const
+{
+    return columns.getData(frame, column);
+}
+
+std::function<QVariant(const Frame4 &, int)> Stationary4Model::getFormatter() const
+{
+    return [columns = columns](const Frame4 &frame, int column)
     {
-        case Method::Method1:
-        case Method::MethodK:
-            return 16;
-        case Method::MethodJ:
-            return 15;
-        case Method::WondercardIVs:
-            return 11;
-        default:
-            return 0;
-    }
+        return columns.getData(frame, column);
+    };
 }
 
 QVariant Stationary4Model::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto frame = model.at(index.row());
-        switch (method)
-        {
-            case Method::Method1:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.getCall();
-                    case 2:
-                        return frame.chatotPitch();
-                    case 3:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 4:
-                        return frame.getShinyString();
-                    case 5:
-                        return frame.getNatureString();
-                    case 6:
-                        return frame.getAbility();
-                    case 7:
-                        return frame.getIV(0);
-                    case 8:
-                        return frame.getIV(1);
-                    case 9:
-                        return frame.getIV(2);
-                    case 10:
-                        return frame.getIV(3);
-                    case 11:
-                        return frame.getIV(4);
-                    case 12:
-                        return frame.getIV(5);
-                    case 13:
-                        return frame.getPowerString();
-                    case 14:
-                        return frame.getPower();
-                    case 15:
-                        return frame.getGenderString();
-                }
-            case Method::MethodJ:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.chatotPitch();
-                    case 2:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 3:
-                        return frame.getShinyString();
-                    case 4:
-                        return frame.getNatureString();
-                    case 5:
-                        return frame.getAbility();
-                    case 6:
-                        return frame.getIV(0);
-                    case 7:
-                        return frame.getIV(1);
-                    case 8:
-                        return frame.getIV(2);
-                    case 9:
-                        return frame.getIV(3);
-                    case 10:
-                        return frame.getIV(4);
-                    case 11:
-                        return frame.getIV(5);
-                    case 12:
-                        return frame.getPowerString();
-                    case 13:
-                        return frame.getPower();
-                    case 14:
-                        return frame.getGenderString();
-                }
-            case Method::MethodK:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.getCall();
-                    case 2:
-                        return frame.chatotPitch();
-                    case 3:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 4:
-                        return frame.getShinyString();
-                    case 5:
-                        return frame.getNatureString();
-                    case 6:
-                        return frame.getAbility();
-                    case 7:
-                        return frame.getIV(0);
-                    case 8:
-                        return frame.getIV(1);
-                    case 9:
-                        return frame.getIV(2);
-                    case 10:
-                        return frame.getIV(3);
-                    case 11:
-                        return frame.getIV(4);
-                    case 12:
-                        return frame.getIV(5);
-                    case 13:
-                        return frame.getPowerString();
-                    case 14:
-                        return frame.getPower();
-                    case 15:
-                        return frame.getGenderString();
-                }
-            case Method::WondercardIVs:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.getCall();
-                    case 2:
-                        return frame.chatotPitch();
-                    case 3:
-                        return frame.getIV(0);
-                    case 4:
-                        return frame.getIV(1);
-                    case 5:
-                        return frame.getIV(2);
-                    case 6:
-                        return frame.getIV(3);
-                    case 7:
-                        return frame.getIV(4);
-                    case 8:
-                        return frame.getIV(5);
-                    case 9:
-                        return frame.getPowerString();
-                    case 10:
-                        return frame.getPower();
-                }
-            default:
-                break;
-        }
+        return getCachedData(index);
     }
     else if (role == Qt::FontRole)
     {
-        auto frame = model.at(index.row());
+        auto frame = itemAt(index.row());
         switch (method)
         {
             case Method::Method1:
@@ -258,19 +128,7 @@ QVariant Stationary4Model::headerData(int section, Qt::Orientation orientation,
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
     {
-        switch (method)
-        {
-            case Method::Method1:
-                return header1.at(section);
-            case Method::MethodJ:
-                return header2.at(section);
-            case Method::MethodK:
-                return header3.at(section);
-            case Method::WondercardIVs:
-                return header4.at(section);
-            default:
-                break;
-        }
+        return header.value(section);
     }
     return QVariant();
 }
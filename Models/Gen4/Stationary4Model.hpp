@@ -20,7 +20,7 @@
 #ifndef STATIONARY4MODEL_HPP
 #define STATIONARY4MODEL_HPP
 
-#include <Core/Gen4/Frame4.hpp>
+#include <Core/Gen4/Frame4Columns.hpp>
 #include <Models/TableModel.hpp>
 
 class Stationary4Model : public TableModel<Frame4>
@@ -37,25 +37,11 @@ public:
 private:
     Method method;
 
-    QStringList header1 =
-    {
-        tr("Frame"), tr("Call"), tr("Chatot"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"),
-        tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
-    };
-    QStringList header2 =
-    {
-        tr("Frame"), tr("Chatot"), tr("PID"), "!!!", tr("Nature"), tr("Ability"), tr("HP"),
-        tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
-    };
-    QStringList header3 =
-    {
-        tr("Frame"), tr("Call"), tr("Chatot"), tr("PID"), "!!!", tr("Nature"), tr("Ability"),
-        tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power"), tr("Gender")
-    };
-    QStringList header4 =
-    {
-        tr("Frame"), tr("Call"), tr("Chatot"), tr("HP"), tr("Atk"), tr("Def"), tr("SpA"), tr("SpD"), tr("Spe"), tr("Hidden"), tr("Power")
-    };
+    Stationary4Columns columns;
+    QStringList header;
+
+    QVariant getDisplayData(const Frame4 &frame, int column) const override;
+    std::function<QVariant(const Frame4 &, int)> getFormatter() const override;
 
 };
 
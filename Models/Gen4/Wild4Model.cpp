@@ -24,159 +24,46 @@ Wild4Model::Wild4Model(QObject *parent, Method method) :
     TableModel<Frame4>(parent)
 {
     this->method = method;
+    columns = Wild4Columns(method);
+    header = columns.getHeader();
 }
 
 void Wild4Model::setMethod(Method method)
 {
     this->method = method;
+    columns = Wild4Columns(method);
+    header = columns.getHeader();
+    clearCache();
     emit headerDataChanged(Qt::Horizontal, 0, columnCount());
 }
 
 int Wild4Model::columnCount(const QModelIndex & /*parent*/) const
 {
-    switch (method)
+    return columns.getColumnCount();
+}
+
+QVariant Wild4Model::getDisplayData(const Frame4 &frame, int column) const
+{
+    return columns.getData(frame, column);
+}
+
+std::function<QVariant(const Frame4 &, int)> Wild4Model::getFormatter() const
+{
+    return [columns = columns](const Frame4 &frame, int column)
     {
-        case Method::MethodJ:
-            return 18;
-        case Method::MethodK:
-            return 19;
-        case Method::ChainedShiny:
-            return 15;
-        default:
-            return 0;
-    }
+        return columns.getData(frame, column);
+    };
 }
 
 QVariant Wild4Model::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto frame = model.at(index.row());
-        switch (method)
-        {
-            case Method::MethodJ:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.getOccidentary();
-                    case 2:
-                        return frame.chatotPitch();
-                    case 3:
-                        return frame.getEncounterSlot();
-                    case 4:
-                        return frame.getLevel();
-                    case 5:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 6:
-                        return frame.getShinyString();
-                    case 7:
-                        return frame.getNatureString();
-                    case 8:
-                        return frame.getAbility();
-                    case 9:
-                        return frame.getIV(0);
-                    case 10:
-                        return frame.getIV(1);
-                    case 11:
-                        return frame.getIV(2);
-                    case 12:
-                        return frame.getIV(3);
-                    case 13:
-                        return frame.getIV(4);
-                    case 14:
-                        return frame.getIV(5);
-                    case 15:
-                        return frame.getPowerString();
-                    case 16:
-                        return frame.getPower();
-                    case 17:
-                        return frame.getGenderString();
-                }
-            case Method::MethodK:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.getOccidentary();
-                    case 2:
-                        return frame.getCall();
-                    case 3:
-                        return frame.chatotPitch();
-                    case 4:
-                        return frame.getEncounterSlot();
-                    case 5:
-                        return frame.getLevel();
-                    case 6:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 7:
-                        return frame.getShinyString();
-                    case 8:
-                        return frame.getNatureString();
-                    case 9:
-                        return frame.getAbility();
-                    case 10:
-                        return frame.getIV(0);
-                    case 11:
-                        return frame.getIV(1);
-                    case 12:
-                        return frame.getIV(2);
-                    case 13:
-                        return frame.getIV(3);
-                    case 14:
-                        return frame.getIV(4);
-                    case 15:
-                        return frame.getIV(5);
-                    case 16:
-                        return frame.getPowerString();
-                    case 17:
-                        return frame.getPower();
-                    case 18:
-                        return frame.getGenderString();
-                }
-            case Method::ChainedShiny:
-                switch (index.column())
-                {
-                    case 0:
-                        return frame.getFrame();
-                    case 1:
-                        return frame.chatotPitch();
-                    case 2:
-                        return QString::number(frame.getPID(), 16).toUpper().rightJustified(8, '0');
-                    case 3:
-                        return frame.getShinyString();
-                    case 4:
-                        return frame.getNatureString();
-                    case 5:
-                        return frame.getAbility();
-                    case 6:
-                        return frame.getIV(0);
-                    case 7:
-                        return frame.getIV(1);
-                    case 8:
-                        return frame.getIV(2);
-                    case 9:
-                        return frame.getIV(3);
-                    case 10:
-                        return frame.getIV(4);
-                    case 11:
-                        return frame.getIV(5);
-                    case 12:
-                        return frame.getPowerString();
-                    case 13:
-                        return frame.getPower();
-                    case 14:
-                        return frame.getGenderString();
-                }
-            default:
-                break;
-        }
+        return getCachedData(index);
     }
     else if (role == Qt::FontRole)
     {
-        auto frame = model.at(index.row());
+        auto frame = itemAt(index.row());
         switch (method)
         {
             case Method::MethodJ:
@@ -240,17 +127,7 @@ QVariant Wild4Model::headerData(int section, Qt::Orientation orientation, int ro
 {
     if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
     {
-        switch (method)
-        {
-            case Method::MethodJ:
-                return header1.at(section);
-            case Method::MethodK:
-                return header2.at(section);
-            case Method::ChainedShiny:
-                return header3.at(section);
-            default:
-                break;
-        }
+        return header.value(section);
     }
     return QVariant();
 }
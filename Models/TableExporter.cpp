@@ -0,0 +1,186 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QFile>
+#include <QTimer>
+#include <QtConcurrent>
+#include "TableExporter.hpp"
+
+#define BUFFER_SIZE 0x100000
+
+TableExporter::TableExporter(const QString &fileName, Format format, const QStringList &header, int rows)
+{
+    this->fileName = fileName;
+    this->format = format;
+    this->header = header;
+    this->rows = rows;
+    exporting = false;
+    cancel = false;
+    progress = 0;
+
+    connect(this, &TableExporter::finished, this, [ = ]
+    {
+        exporting = false;
+        emit updateProgress(progress);
+        QTimer::singleShot(1000, this, &TableExporter::deleteLater);
+    });
+}
+
+void TableExporter::setProvenance(const QJsonObject &provenance)
+{
+    this->provenance = provenance;
+}
+
+void TableExporter::startExport()
+{
+    if (!exporting)
+    {
+        progress = 0;
+        exporting = true;
+        cancel = false;
+
+        auto *timer = new QTimer(this);
+        connect(this, &TableExporter::finished, timer, &QTimer::stop);
+        connect(timer, &QTimer::timeout, this, [ = ] { emit updateProgress(progress); });
+        timer->start(250);
+
+        // Takes one thread of the global pool, which the search scheduler also runs its chunks on
+        future = QtConcurrent::run([ = ] { write(); });
+    }
+}
+
+void TableExporter::waitForExport()
+{
+    future.waitForFinished();
+}
+
+int TableExporter::getMaxProgress() const
+{
+    return rows;
+}
+
+void TableExporter::cancelExport()
+{
+    cancel = true;
+}
+
+void TableExporter::write()
+{
+    if (format == TableWriter::Session)
+    {
+        writeSession();
+        return;
+    }
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        emit failed();
+        emit finished();
+        return;
+    }
+
+    // Rows are collected in one buffer that is flushed whenever it grows past BUFFER_SIZE
+    QByteArray buffer;
+    buffer.reserve(BUFFER_SIZE + 0x1000);
+    TableWriter::appendHeader(buffer, format, header, getRecordType(), getRecordSize(), static_cast<u64>(rows));
+
+    bool success = true;
+    for (int row = 0; row < rows && success && !cancel; row++)
+    {
+        appendRow(buffer, row);
+        if (buffer.size() >= BUFFER_SIZE)
+        {
+            success = file.write(buffer) == buffer.size();
+            buffer.resize(0);
+        }
+        progress = row + 1;
+    }
+
+    if (success && !cancel)
+    {
+        success = file.write(buffer) == buffer.size();
+    }
+    file.close();
+
+    // Do not leave a truncated file behind
+    if (cancel || !success)
+    {
+        file.remove();
+    }
+
+    if (!success)
+    {
+        emit failed();
+    }
+    emit finished();
+}
+
+void TableExporter::writeSession()
+{
+    SessionWriter writer(fileName, getRecordType(), getRecordSize(), rows, provenance);
+    bool success = writer.open();
+
+    QByteArray buffer;
+    buffer.reserve(BUFFER_SIZE + 0x1000);
+
+    int start = 0;
+    for (int row = 0; row < rows && success && !cancel; row++)
+    {
+        appendRecord(buffer, row);
+        if (buffer.size() >= BUFFER_SIZE || row == rows - 1)
+        {
+            success = writer.append(buffer.constData(), row + 1 - start);
+            buffer.resize(0);
+            start = row + 1;
+        }
+        progress = row + 1;
+    }
+
+    writer.close();
+    if (cancel || !success)
+    {
+        writer.remove();
+    }
+
+    if (!success)
+    {
+        emit failed();
+    }
+    emit finished();
+}
+
+void TableExporter::appendRow(QByteArray &buffer, int row) const
+{
+    if (format == TableWriter::Binary)
+    {
+        appendRecord(buffer, row);
+        return;
+    }
+
+    for (int column = 0; column < header.size(); column++)
+    {
+        TableWriter::appendCell(buffer, format, getText(row, column), column == header.size() - 1);
+    }
+
+    if (row != rows - 1)
+    {
+        buffer.append('\n');
+    }
+}
@@ -0,0 +1,130 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TABLEEXPORTER_HPP
+#define TABLEEXPORTER_HPP
+
+#include <QFuture>
+#include <QJsonObject>
+#include <QObject>
+#include <QStringList>
+#include <QSharedPointer>
+#include <Core/Util/SessionFile.hpp>
+#include <Core/Util/TableWriter.hpp>
+#include <atomic>
+#include <functional>
+
+// Writes a snapshot of a table to disk on the thread pool in one of the TableWriter layouts
+class TableExporter : public QObject
+{
+    Q_OBJECT
+
+signals:
+    void finished();
+    void failed();
+    void updateProgress(int);
+
+public:
+    using Format = TableWriter::Format;
+
+    TableExporter(const QString &fileName, Format format, const QStringList &header, int rows);
+    void setProvenance(const QJsonObject &provenance);
+    void startExport();
+    void waitForExport();
+    int getMaxProgress() const;
+
+public slots:
+    void cancelExport();
+
+protected:
+    virtual QString getText(int row, int column) const = 0;
+    virtual u32 getRecordType() const = 0;
+    virtual u32 getRecordSize() const = 0;
+    virtual void appendRecord(QByteArray &buffer, int row) const = 0;
+
+private:
+    QString fileName;
+    Format format;
+    QStringList header;
+    QJsonObject provenance;
+    int rows;
+    QFuture<void> future;
+    bool exporting;
+    std::atomic<bool> cancel;
+    std::atomic<int> progress;
+
+    void write();
+    void writeSession();
+    void appendRow(QByteArray &buffer, int row) const;
+
+};
+
+template <typename T>
+class ModelExporter : public TableExporter
+{
+
+public:
+    ModelExporter(const QString &fileName, Format format, const QStringList &header, const QVector<T> &items,
+                  const std::function<QVariant(const T &, int)> &formatter) :
+        TableExporter(fileName, format, header, items.size()), items(items), formatter(formatter)
+    {
+    }
+
+protected:
+    QString getText(int row, int column) const override
+    {
+        return formatter(items.at(row), column).toString();
+    }
+
+    u32 getRecordType() const override
+    {
+        return sessionRecordType<T>;
+    }
+
+    u32 getRecordSize() const override
+    {
+        return isRawRecord<T> ? sizeof(T) : 0;
+    }
+
+    void appendRecord(QByteArray &buffer, int row) const override
+    {
+        if constexpr (isRawRecord<T>)
+        {
+            buffer.append(reinterpret_cast<const char *>(&items.at(row)), sizeof(T));
+        }
+    }
+
+private:
+    QVector<T> items;
+    std::function<QVariant(const T &, int)> formatter;
+
+};
+
+// Implemented by models whose rows can be exported off the GUI thread or read back from a session
+class ExportSource
+{
+
+public:
+    virtual ~ExportSource() = default;
+    virtual TableExporter *createExporter(const QString &fileName, TableWriter::Format format) const = 0;
+    virtual bool setSession(const QSharedPointer<SessionFile> &session) = 0;
+
+};
+
+#endif // TABLEEXPORTER_HPP
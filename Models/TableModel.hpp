@@ -21,14 +21,21 @@
 #define TABLEMODEL_HPP
 
 #include <QAbstractTableModel>
+#include <QCache>
+#include <QtConcurrent>
+#include <Core/Util/Global.hpp>
+#include <Core/Util/SearchScheduler.hpp>
+#include <Models/TableExporter.hpp>
+#include <numeric>
 
 template <typename T>
-class TableModel : public QAbstractTableModel
+class TableModel : public QAbstractTableModel, public ExportSource
 {
 
 public:
+    // Formatted rows are kept for the most recently displayed 2048 rows
     TableModel(QObject *parent = nullptr) :
-        QAbstractTableModel(parent)
+        QAbstractTableModel(parent), cache(2048)
     {
     }
 
@@ -36,64 +43,331 @@ public:
     {
         if (!items.isEmpty())
         {
+            detachSession();
             int i = rowCount();
             emit beginInsertRows(QModelIndex(), i, i + items.size() - 1);
             model.append(items);
+            if (!rows.isEmpty())
+            {
+                for (; i < model.size(); i++)
+                {
+                    rows.append(i);
+                }
+            }
             emit endInsertRows();
         }
     }
 
     void addItem(const T &item)
     {
+        detachSession();
         int i = rowCount();
         emit beginInsertRows(QModelIndex(), i, i);
         model.push_back(item);
+        if (!rows.isEmpty())
+        {
+            rows.append(i);
+        }
         emit endInsertRows();
     }
 
     void updateItem(const T &item, int row)
     {
-        model[row] = item;
-        emit dataChanged(index(row, 0), index(row, columnCount()));
+        detachSession();
+        model[sourceRow(row)] = item;
+        cache.remove(row);
+        emit dataChanged(index(row, 0), index(row, columnCount() - 1));
     }
 
     void removeItem(int row)
     {
+        detachSession();
         emit beginRemoveRows(QModelIndex(), row, row);
-        model.erase(model.begin() + row);
+        int source = sourceRow(row);
+        model.erase(model.begin() + source);
+        if (!rows.isEmpty())
+        {
+            rows.removeAt(row);
+            for (int &i : rows)
+            {
+                if (i > source)
+                {
+                    i--;
+                }
+            }
+        }
+        cache.clear();
         model.squeeze();
         emit endRemoveRows();
     }
 
     T getItem(int row) const
     {
-        return model.at(row);
+        return itemAt(row);
     }
 
+    // Rows in the order they are displayed
     QVector<T> getModel() const
     {
-        return model;
+        if (rows.isEmpty() && !session)
+        {
+            return model;
+        }
+
+        QVector<T> items;
+        items.reserve(rowCount());
+        for (int row = 0; row < rowCount(); row++)
+        {
+            items.append(itemAt(row));
+        }
+        return items;
     }
 
     void clearModel()
     {
-        if (!model.isEmpty())
+        if (rowCount() > 0)
         {
             emit beginRemoveRows(QModelIndex(), 0, rowCount() - 1);
             model.clear();
             model.squeeze();
+            rows.clear();
+            session.clear();
+            cache.clear();
             emit endRemoveRows();
         }
     }
 
     int rowCount(const QModelIndex & /*parent*/ = QModelIndex()) const override
     {
-        return model.size();
+        return session ? session->getRows() : model.size();
+    }
+
+    // Rows are read from the mapped file on demand until the model is edited
+    bool setSession(const QSharedPointer<SessionFile> &session) override
+    {
+        if (sessionRecordType<T> == 0 || session->getRecordType() != sessionRecordType<T> || session->getRecordSize() != sizeof(T))
+        {
+            return false;
+        }
+
+        emit beginResetModel();
+        model.clear();
+        model.squeeze();
+        rows.clear();
+        cache.clear();
+        this->session = session;
+        emit endResetModel();
+        return true;
+    }
+
+    // Sorting only reorders the row index, the stored items are never moved.
+    // Equal keys keep their previous order so sorting one column after another
+    // gives a multi-column ordering.
+    void sort(int column, Qt::SortOrder order) override
+    {
+        if (rowCount() > 0)
+        {
+            emit layoutAboutToBeChanged();
+
+            if (rows.isEmpty())
+            {
+                rows.resize(rowCount());
+                std::iota(rows.begin(), rows.end(), 0);
+            }
+
+            // Each key is packed with the row's current position, so every value is
+            // unique and ties fall back to the previous order
+            QVector<u64> keys(rows.size());
+            for (int i = 0; i < rows.size(); i++)
+            {
+                u32 key = getSortKey(getRow(rows.at(i)), column);
+                keys[i] = (static_cast<u64>(order == Qt::AscendingOrder ? key : ~key) << 32) | static_cast<u32>(i);
+            }
+            sortKeys(keys);
+
+            QVector<int> sorted(rows.size());
+            for (int i = 0; i < keys.size(); i++)
+            {
+                sorted[i] = rows.at(static_cast<int>(keys.at(i) & 0xffffffff));
+            }
+            rows = sorted;
+
+            clearCache();
+            emit layoutChanged();
+        }
+    }
+
+    // The exporter formats a copy of the displayed rows with a copy of the formatting,
+    // binary and session output need rows that are raw records
+    TableExporter *createExporter(const QString &fileName, TableWriter::Format format) const override
+    {
+        bool raw = format == TableWriter::Binary || format == TableWriter::Session;
+        if (raw && (!isRawRecord<T> || (format == TableWriter::Session && sizeof(T) % 4 != 0)))
+        {
+            return nullptr;
+        }
+
+        std::function<QVariant(const T &, int)> formatter = getFormatter();
+        if (!raw && !formatter)
+        {
+            return nullptr;
+        }
+
+        return new ModelExporter<T>(fileName, format, getHeader(), getModel(), formatter);
+    }
+
+    QStringList getHeader() const
+    {
+        QStringList header;
+        for (int column = 0; column < columnCount(); column++)
+        {
+            header.append(headerData(column, Qt::Horizontal, Qt::DisplayRole).toString());
+        }
+        return header;
     }
 
 protected:
     QVector<T> model;
 
+    // Maps a displayed row to its position in model
+    int sourceRow(int row) const
+    {
+        return rows.isEmpty() ? row : rows.at(row);
+    }
+
+    T itemAt(int row) const
+    {
+        return getRow(sourceRow(row));
+    }
+
+    // Value a column is ordered by, models that can be sorted override this
+    virtual u32 getSortKey(const T & /*item*/, int /*column*/) const
+    {
+        return 0;
+    }
+
+    // Display text of one column, only called when a row is not cached
+    virtual QVariant getDisplayData(const T & /*item*/, int /*column*/) const
+    {
+        return QVariant();
+    }
+
+    // Display text for the export thread, it must only capture copies of the formatting state.
+    // Models without one can only be exported as raw records.
+    virtual std::function<QVariant(const T &, int)> getFormatter() const
+    {
+        return nullptr;
+    }
+
+    QVariant getCachedData(const QModelIndex &index) const
+    {
+        QVector<QVariant> *row = cache.object(index.row());
+        if (row == nullptr)
+        {
+            row = new QVector<QVariant>(columnCount());
+
+            const T &item = itemAt(index.row());
+            for (int column = 0; column < row->size(); column++)
+            {
+                (*row)[column] = getDisplayData(item, column);
+            }
+
+            QVariant value = row->value(index.column());
+            cache.insert(index.row(), row);
+            return value;
+        }
+        return row->value(index.column());
+    }
+
+    // Must be called whenever rows move or the columns/formatting change
+    void clearCache()
+    {
+        cache.clear();
+    }
+
+private:
+    mutable QCache<int, QVector<QVariant>> cache;
+    QVector<int> rows;
+    QSharedPointer<SessionFile> session;
+
+    T getRow(int source) const
+    {
+        if constexpr (std::is_trivially_copyable<T>::value && sizeof(T) % 4 == 0)
+        {
+            if (session)
+            {
+                return session->getFrame<T>(source);
+            }
+        }
+        return model.at(source);
+    }
+
+    // Edits need the rows in memory, so a session is copied in before the first one
+    void detachSession()
+    {
+        if (session)
+        {
+            QVector<T> items;
+            items.reserve(session->getRows());
+            for (int row = 0; row < session->getRows(); row++)
+            {
+                items.append(getRow(row));
+            }
+            session.clear();
+            model = items;
+        }
+    }
+
+    // Large results are sorted in chunks on the global pool the searches run on and then merged pairwise
+    static void sortKeys(QVector<u64> &keys)
+    {
+        int threads = SearchScheduler::getInstance().getThreadCount();
+        if (keys.size() < 0x10000 || threads < 2)
+        {
+            std::sort(keys.begin(), keys.end());
+            return;
+        }
+
+        u64 *data = keys.data();
+        int size = keys.size();
+        int chunk = (size + threads - 1) / threads;
+
+        QVector<QPair<int, int>> ranges;
+        for (int start = 0; start < size; start += chunk)
+        {
+            ranges.append(qMakePair(start, qMin(start + chunk, size)));
+        }
+
+        QtConcurrent::blockingMap(ranges, [data](const QPair<int, int> &range)
+        {
+            std::sort(data + range.first, data + range.second);
+        });
+
+        while (ranges.size() > 1)
+        {
+            QVector<QPair<int, int>> merged;
+            QVector<QPair<int, int>> pairs;
+            for (int i = 0; i + 1 < ranges.size(); i += 2)
+            {
+                pairs.append(qMakePair(i, i + 1));
+                merged.append(qMakePair(ranges.at(i).first, ranges.at(i + 1).second));
+            }
+            if (ranges.size() % 2 == 1)
+            {
+                merged.append(ranges.last());
+            }
+
+            QtConcurrent::blockingMap(pairs, [data, &ranges](const QPair<int, int> &pair)
+            {
+                const QPair<int, int> &left = ranges.at(pair.first);
+                const QPair<int, int> &right = ranges.at(pair.second);
+                std::inplace_merge(data + left.first, data + left.second, data + right.second);
+            });
+
+            ranges = merged;
+        }
+    }
+
 };
 
 #endif // TABLEMODEL_HPP
@@ -0,0 +1,94 @@
+/*
+ * This file is part of PokéFinder
+ * Copyright (C) 2017-2019 by Admiral_Fish, bumba, and EzPzStreamz
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "IVtoPIDModel.hpp"
+
+IVtoPIDModel::IVtoPIDModel(QObject *parent) :
+    TableModel<IVtoPIDFrame>(parent)
+{
+}
+
+int IVtoPIDModel::columnCount(const QModelIndex & /*parent*/) const
+{
+    return 9;
+}
+
+QVariant IVtoPIDModel::data(const QModelIndex &index, int role) const
+{
+    if (role == Qt::DisplayRole)
+    {
+        auto frame = itemAt(index.row());
+        switch (index.column())
+        {
+            case 0:
+                return QString::number(frame.getSeed(), 16).toUpper();
+            case 1:
+                return QString::number(frame.getPID(), 16).toUpper();
+            case 2:
+                return getMethodString(frame.getMethod());
+            case 3:
+                return frame.getAbility();
+            case 4:
+                return frame.isMale(126) ? "M" : "F";
+            case 5:
+                return frame.isMale(30) ? "M" : "F";
+            case 6:
+                return frame.isMale(63) ? "M" : "F";
+            case 7:
+                return frame.isMale(190) ? "M" : "F";
+            case 8:
+                return frame.getSID();
+        }
+    }
+    return QVariant();
+}
+
+QVariant IVtoPIDModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
+    {
+        return header.at(section);
+    }
+    return QVariant();
+}
+
+QString IVtoPIDModel::getMethodString(Method method) const
+{
+    switch (method)
+    {
+        case Method::Method1:
+            return tr("Method 1");
+        case Method::Method1Reverse:
+            return tr("Reverse Method 1");
+        case Method::Method2:
+            return tr("Method 2");
+        case Method::Method4:
+            return tr("Method 4");
+        case Method::XDColo:
+            return tr("XD/Colo");
+        case Method::Channel:
+            return tr("Channel");
+        case Method::CuteCharmDPPt:
+            return tr("Cute Charm (DPPt)");
+        case Method::CuteCharmHGSS:
+            return tr("Cute Charm (HGSS)");
+        default:
+            return QString();
+    }
+}
@@ -45,7 +45,7 @@ QVariant ResearcherModel::data(const QModelIndex &index, int role) const
 {
     if (role == Qt::DisplayRole)
     {
-        auto frame = model.at(index.row());
+        auto frame = itemAt(index.row());
         if (flag)
         {
             switch (index.column())
@@ -193,7 +193,7 @@ QModelIndex ResearcherModel::search(const QString &string, u64 result, int row)
     int size = rowCount();
     for (; row < size; row++)
     {
-        u64 value = getResult(model.at(row));
+        u64 value = getResult(itemAt(row));
         if (value == result)
         {
             return index(row, column, QModelIndex());
@@ -18,14 +18,24 @@
  */
 
 #include <QApplication>
+#include <QElapsedTimer>
 #include <QFile>
+#include <QLoggingCategory>
 #include <QSettings>
 #include <QTextStream>
+#include <QTimer>
 #include <QTranslator>
+#include <Core/Util/Translator.hpp>
 #include <Forms/MainWindow.hpp>
 
+// Enable with QT_LOGGING_RULES="pokefinder.startup.info=true"
+Q_LOGGING_CATEGORY(startup, "pokefinder.startup", QtWarningMsg)
+
 int main(int argc, char *argv[])
 {
+    QElapsedTimer total;
+    total.start();
+
     QApplication a(argc, argv);
     a.setApplicationName("PokeFinder");
     a.setOrganizationName("PokeFinder Team");
@@ -33,6 +43,9 @@ int main(int argc, char *argv[])
     QSettings setting;
     if (setting.contains("style")) setting.clear();
 
+    QElapsedTimer timer;
+    timer.start();
+
     QString style = setting.value("settings/style", "dark").toString();
     if (style == "dark")
     {
@@ -45,15 +58,26 @@ int main(int argc, char *argv[])
         }
     }
 
+    qCInfo(startup) << "Stylesheet loaded in" << timer.restart() << "ms";
+
+    QString locale = setting.value("settings/locale", "en").toString();
+    Translator::setLocale(locale);
+
     QTranslator translator;
-    if (translator.load(QString(":/i18n/PokeFinder_%1.qm").arg(setting.value("settings/locale", "en").toString())))
+    if (translator.load(QString(":/i18n/PokeFinder_%1.qm").arg(locale)))
     {
         QApplication::installTranslator(&translator);
     }
+    qCInfo(startup) << "Translator set up in" << timer.restart() << "ms";
 
     MainWindow w;
+    qCInfo(startup) << "Main window constructed in" << timer.restart() << "ms";
+
     w.show();
     w.raise();
 
+    // Runs once the event loop has processed the initial show and paint events
+    QTimer::singleShot(0, [&total] { qCInfo(startup) << "First paint after" << total.elapsed() << "ms"; });
+
     return a.exec();
 }